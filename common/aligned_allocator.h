@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_COMMON_ALIGNED_ALLOCATOR_H
+#define AUTO_TRADER_COMMON_ALIGNED_ALLOCATOR_H
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <new>
+
+#ifdef WIN32
+#include <malloc.h>
+#endif
+
+namespace auto_trader {
+namespace common {
+
+// Allocator for std::vector whose storage starts on an `Alignment`-byte boundary, so that
+// vectorized kernels can use aligned loads on the first element.
+template <typename T, size_t Alignment>
+class AlignedAllocator {
+ public:
+  using value_type = T;
+
+  template <typename U>
+  struct rebind {
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  AlignedAllocator() = default;
+
+  template <typename U>
+  AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+  T* allocate(size_t count) {
+    if (count == 0) return nullptr;
+
+    void* memory = nullptr;
+#ifdef WIN32
+    memory = _aligned_malloc(count * sizeof(T), Alignment);
+#else
+    if (posix_memalign(&memory, Alignment, count * sizeof(T)) != 0) memory = nullptr;
+#endif
+    if (!memory) throw std::bad_alloc();
+
+    return static_cast<T*>(memory);
+  }
+
+  void deallocate(T* memory, size_t) {
+#ifdef WIN32
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+  }
+
+  template <typename U>
+  bool operator==(const AlignedAllocator<U, Alignment>&) const {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(const AlignedAllocator<U, Alignment>&) const {
+    return false;
+  }
+};
+
+}  // namespace common
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_COMMON_ALIGNED_ALLOCATOR_H
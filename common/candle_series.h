@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_COMMON_CANDLE_SERIES_H
+#define AUTO_TRADER_COMMON_CANDLE_SERIES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "aligned_allocator.h"
+#include "date.h"
+#include "market_data.h"
+
+namespace auto_trader {
+namespace common {
+
+// Candles stored column by column. Indicators mostly read one price field, so keeping every
+// field in its own contiguous array lets them stream through dense doubles instead of strided
+// 48-byte MarketData records. Columns are 32-byte aligned (one AVX register).
+class CandleSeries {
+ public:
+  static constexpr size_t COLUMN_ALIGNMENT = 32;
+
+  using PriceColumn = std::vector<double, AlignedAllocator<double, COLUMN_ALIGNMENT>>;
+  using TimeColumn = std::vector<int64_t, AlignedAllocator<int64_t, COLUMN_ALIGNMENT>>;
+
+  CandleSeries() = default;
+
+  explicit CandleSeries(const std::vector<MarketData>& candles) {
+    reserve(candles.size());
+    for (const auto& candle : candles) {
+      addCandle(candle);
+    }
+  }
+
+  void reserve(size_t count) {
+    openPrices_.reserve(count);
+    closePrices_.reserve(count);
+    lowPrices_.reserve(count);
+    highPrices_.reserve(count);
+    volumes_.reserve(count);
+    times_.reserve(count);
+  }
+
+  void clear() {
+    openPrices_.clear();
+    closePrices_.clear();
+    lowPrices_.clear();
+    highPrices_.clear();
+    volumes_.clear();
+    times_.clear();
+  }
+
+  void addCandle(int64_t openTime, double openPrice, double closePrice, double lowPrice,
+                 double highPrice, double volume) {
+    times_.push_back(openTime);
+    openPrices_.push_back(openPrice);
+    closePrices_.push_back(closePrice);
+    lowPrices_.push_back(lowPrice);
+    highPrices_.push_back(highPrice);
+    volumes_.push_back(volume);
+  }
+
+  void addCandle(const MarketData& candle) {
+    addCandle(Date::toEpochMilliseconds(candle.date_), candle.openPrice_, candle.closePrice_,
+              candle.lowPrice_, candle.highPrice_, candle.volume_);
+  }
+
+  inline size_t size() const { return closePrices_.size(); }
+  inline bool empty() const { return closePrices_.empty(); }
+
+  inline const double* getOpenPrices() const { return openPrices_.data(); }
+  inline const double* getClosePrices() const { return closePrices_.data(); }
+  inline const double* getLowPrices() const { return lowPrices_.data(); }
+  inline const double* getHighPrices() const { return highPrices_.data(); }
+  inline const double* getVolumes() const { return volumes_.data(); }
+  inline const int64_t* getOpenTimes() const { return times_.data(); }
+
+  const double* getPrices(MarketDataField field) const {
+    switch (field) {
+      case OPEN_PRICE:
+        return getOpenPrices();
+      case LOW_PRICE:
+        return getLowPrices();
+      case HIGH_PRICE:
+        return getHighPrices();
+      case CLOSE_PRICE:
+      default:
+        return getClosePrices();
+    }
+  }
+
+  MarketData getCandle(size_t index) const {
+    MarketData candle(openPrices_.at(index), closePrices_.at(index), lowPrices_.at(index),
+                      highPrices_.at(index), volumes_.at(index));
+    candle.date_ = Date::fromEpochMilliseconds(times_.at(index));
+    return candle;
+  }
+
+  std::vector<MarketData> toMarketData() const {
+    std::vector<MarketData> candles;
+    candles.reserve(size());
+    for (size_t index = 0; index < size(); ++index) {
+      candles.emplace_back(getCandle(index));
+    }
+
+    return candles;
+  }
+
+ private:
+  PriceColumn openPrices_;
+  PriceColumn closePrices_;
+  PriceColumn lowPrices_;
+  PriceColumn highPrices_;
+  PriceColumn volumes_;
+  TimeColumn times_;
+};
+
+}  // namespace common
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_COMMON_CANDLE_SERIES_H
@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_COMMON_DATE_H
 #define AUTO_TRADER_COMMON_DATE_H
 
+#include <stdint.h>
 #include <chrono>
 #include <ctime>
 #include <sstream>
@@ -107,6 +108,45 @@ struct Date {
     return time;
   }
 
+  // UTC milliseconds since 1970-01-01, the time format of exchange kline payloads.
+  static int64_t toEpochMilliseconds(const Date& date) {
+    int64_t year = date.year_ - (date.month_ <= 2 ? 1 : 0);
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t yearOfEra = year - era * 400;
+    int64_t dayOfYear = (153 * (date.month_ + (date.month_ > 2 ? -3 : 9)) + 2) / 5 + date.day_ - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    int64_t days = era * 146097 + dayOfEra - 719468;
+
+    int64_t seconds = days * 86400 + date.hour_ * 3600 + date.minute_ * 60 + date.second_;
+    return seconds * 1000;
+  }
+
+  static Date fromEpochMilliseconds(int64_t milliseconds) {
+    int64_t seconds = milliseconds / 1000;
+    int64_t days = seconds / 86400;
+    int64_t secondsOfDay = seconds % 86400;
+    if (secondsOfDay < 0) {
+      secondsOfDay += 86400;
+      --days;
+    }
+
+    days += 719468;
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t dayOfEra = days - era * 146097;
+    int64_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    int64_t monthPosition = (5 * dayOfYear + 2) / 153;
+
+    Date date;
+    date.day_ = static_cast<int>(dayOfYear - (153 * monthPosition + 2) / 5 + 1);
+    date.month_ = static_cast<int>(monthPosition < 10 ? monthPosition + 3 : monthPosition - 9);
+    date.year_ = static_cast<int>(yearOfEra + era * 400 + (date.month_ <= 2 ? 1 : 0));
+    date.hour_ = static_cast<int>(secondsOfDay / 3600);
+    date.minute_ = static_cast<int>(secondsOfDay % 3600 / 60);
+    date.second_ = static_cast<int>(secondsOfDay % 60);
+    return date;
+  }
+
   static Date convertTimestampToDate(const time_t& timestamp) {
     std::tm* now = std::localtime(&timestamp);
     Date currentDate;
@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_COMMON_TICK_INTERVAL_H
 #define AUTO_TRADER_COMMON_TICK_INTERVAL_H
 
+#include <stdint.h>
 #include <string>
 
 namespace auto_trader {
@@ -94,6 +95,51 @@ class TickInterval {
     }
   }
 
+  static int64_t toSeconds(Enum tickInteval) {
+    const int64_t minute = 60;
+    const int64_t hour = 60 * minute;
+    const int64_t day = 24 * hour;
+
+    switch (tickInteval) {
+      case ONE_MIN:
+        return minute;
+      case THREE_MIN:
+        return 3 * minute;
+      case FIVE_MIN:
+        return 5 * minute;
+      case FIFTEEN_MIN:
+        return 15 * minute;
+      case THIRTY_MIN:
+        return 30 * minute;
+      case ONE_HOUR:
+        return hour;
+      case TWO_HOURS:
+        return 2 * hour;
+      case FOUR_HOURS:
+        return 4 * hour;
+      case SIX_HOURS:
+        return 6 * hour;
+      case EIGHT_HOURS:
+        return 8 * hour;
+      case TWELVE_HOURS:
+        return 12 * hour;
+      case ONE_DAY:
+        return day;
+      case THREE_DAYS:
+        return 3 * day;
+      case ONE_WEEK:
+        return 7 * day;
+      case TWO_WEEKS:
+        return 14 * day;
+      case ONE_MONTH:
+        return 30 * day;
+      case ONE_YEAR:
+        return 365 * day;
+      default:
+        return 0;
+    }
+  }
+
   static TickInterval::Enum fromString(const std::string& tickInteval) {
     if (tickInteval == "ONE MIN") {
       return TickInterval::ONE_MIN;
@@ -30,6 +30,7 @@
 #include <QDebug>
 #include <QtWidgets/QApplication>
 #include <fstream>
+#include <mutex>
 
 #include "common/crossplatform_functions.h"
 #include "logger.h"
@@ -46,6 +47,9 @@ class FileLogger : public Logger {
   }
 
   Logger &operator<<(const std::string &message) override {
+    // Exchange queries, the clock thread and the database writer log from their own threads.
+    std::lock_guard<std::mutex> lock(mutex_);
+
     std::string dirPath;
     if (QCoreApplication::instance()) {
       auto applicationDir = QApplication::applicationDirPath();
@@ -91,6 +95,7 @@ class FileLogger : public Logger {
 
  private:
   std::fstream file_;
+  std::mutex mutex_;
 };
 
 class TradingFileLogger : public Logger {
@@ -101,6 +106,9 @@ class TradingFileLogger : public Logger {
   }
 
   Logger &operator<<(const std::string &message) override {
+    // Exchange queries, the clock thread and the database writer log from their own threads.
+    std::lock_guard<std::mutex> lock(mutex_);
+
     std::string dirPath;
     if (QCoreApplication::instance()) {
       auto applicationDir = QApplication::applicationDirPath();
@@ -145,6 +153,7 @@ class TradingFileLogger : public Logger {
 
  private:
   std::fstream file_;
+  std::mutex mutex_;
 };
 
 }  // namespace loggers
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_COMMON_RESULT_KEY_UTILS_H
+#define AUTO_TRADER_COMMON_RESULT_KEY_UTILS_H
+
+#include <ostream>
+#include <type_traits>
+
+namespace auto_trader {
+namespace common {
+
+template <typename T>
+inline typename std::enable_if<std::is_enum<T>::value, typename std::underlying_type<T>::type>::type
+getResultKeyValue(const T& value) {
+  return static_cast<typename std::underlying_type<T>::type>(value);
+}
+
+template <typename T>
+inline typename std::enable_if<!std::is_enum<T>::value, const T&>::type getResultKeyValue(
+    const T& value) {
+  return value;
+}
+
+inline void writeResultKeyValues(std::ostream& stream) {}
+
+// Writes every value after a space. The caller sets std::hexfloat, so each double is written
+// exactly and two different settings never produce the same text.
+template <typename T, typename... Rest>
+inline void writeResultKeyValues(std::ostream& stream, const T& value, const Rest&... rest) {
+  stream << ' ' << getResultKeyValue(value);
+  writeResultKeyValues(stream, rest...);
+}
+
+}  // namespace common
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_COMMON_RESULT_KEY_UTILS_H
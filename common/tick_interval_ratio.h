@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_TICK_INTERVAL_RATIO_H
 #define AUTO_TRADER_TICK_INTERVAL_RATIO_H
 
+#include <chrono>
 #include <map>
 
 #include "common/exceptions/undefined_type_exception.h"
@@ -110,6 +111,18 @@ inline std::map<common::TickInterval::Enum, const char *> getStockExchangeInterv
   }
 }
 
+// The time zone in which an exchange cuts its daily and longer candles. Huobi starts them at
+// 00:00 UTC+8, the others at 00:00 UTC.
+inline std::chrono::seconds getStockExchangeCandlesUtcOffset(common::StockExchangeType type) {
+  switch (type) {
+    case common::StockExchangeType::Huobi:
+      return std::chrono::hours(8);
+
+    default:
+      return std::chrono::seconds(0);
+  }
+}
+
 }  // namespace common
 }  // namespace auto_trader
 
@@ -29,21 +29,28 @@
 
 #include <sqlite3.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+
 #include "common/enumerations/strategies_type.h"
 #include "common/market_data.h"
 #include "common/market_order.h"
 #include "model/include/orders/orders_matching.h"
 #include "model/include/orders/orders_profit.h"
+#include "database_writer.h"
 
 namespace auto_trader {
 namespace database {
 
 class Database {
  public:
-  Database();
+  // A write-behind database queues its writes on a DatabaseWriter; reads still see them.
+  explicit Database(bool isWriteBehind = false);
   ~Database();
 
-  void insertMarketOrder(const common::MarketOrder &order);
+  // Returns the database id of the inserted order.
+  int insertMarketOrder(const common::MarketOrder &order);
   void removeMarketOrder(const common::MarketOrder &order);
 
   typedef std::vector<common::MarketOrder> MarketOrdersCollection;
@@ -101,11 +108,18 @@ class Database {
 
   int getLastInsertRowId() const;
 
+  // Commits the writes queued so far in one transaction, without waiting for the disk.
+  void commit();
+  // Waits until the writes queued so far are committed.
+  void flush();
+
  private:
   MarketOrdersCollection browseMarketOrdersWithId(int64_t orderId);
 
   typedef int (*SqlCallback)(void *, int, char **, char **);
   void executeStmt(const char *sqlStmt, SqlCallback callback, void *param);
+  void executeLockedStmt(const char *sqlStmt, SqlCallback callback, void *param);
+  void executeWriteStmt(const std::string &sqlStmt);
 
   friend int browseMarketOrderCallback(void *data, int argc, char **argv, char **azColName);
   friend int browseOrdersProfitCallback(void *data, int argc, char **argv, char **azColName);
@@ -113,6 +127,11 @@ class Database {
 
  private:
   sqlite3 *dbHandler_;
+
+  // Trading sessions share the connection; an insert and its row id are read under one lock.
+  std::mutex mutex_;
+
+  std::unique_ptr<DatabaseWriter> writer_;
 };
 
 }  // namespace database
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_DATABASE_DATABASE_WRITER_H
+#define AUTO_TRADER_DATABASE_DATABASE_WRITER_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace auto_trader {
+namespace database {
+
+// Runs write statements on its own thread, so the trading thread does not wait for them. The
+// statements queued between two commits run in one transaction, which is synced to disk once.
+// A write that must survive a crash goes through callDurable() instead.
+class DatabaseWriter {
+ public:
+  typedef std::function<void()> Statement;
+
+  DatabaseWriter(Statement beginTransaction, Statement commitTransaction);
+  ~DatabaseWriter();
+
+  DatabaseWriter(const DatabaseWriter &) = delete;
+  DatabaseWriter &operator=(const DatabaseWriter &) = delete;
+
+  void post(Statement statement);
+
+  // Returns what the statement produced once the transaction holding it is committed, so the
+  // caller waits for the queued statements and for the disk.
+  template <typename Result>
+  Result callDurable(std::function<Result()> statement);
+
+  // Closes the transaction of the statements queued so far without waiting for it.
+  void commit();
+
+  // Waits until the statements queued so far ran; they are visible on the connection then.
+  void waitExecuted();
+
+  // Waits until the statements queued so far are committed.
+  void flush();
+
+ private:
+  enum class CommandType { EXECUTE, COMMIT };
+
+  struct Command {
+    CommandType type_;
+    Statement statement_;
+  };
+
+  void push(Command command);
+  void waitExecuted(uint64_t commandsCount);
+  void run();
+
+ private:
+  const Statement beginTransaction_;
+  const Statement commitTransaction_;
+
+  std::deque<Command> commands_;
+  uint64_t postedCount_;
+  uint64_t executedCount_;
+  bool isStopping_;
+
+  std::mutex mutex_;
+  std::condition_variable commandPosted_;
+  std::condition_variable commandExecuted_;
+  std::thread thread_;
+};
+
+template <typename Result>
+Result DatabaseWriter::callDurable(std::function<Result()> statement) {
+  auto result = std::make_shared<std::promise<Result>>();
+  auto resultFuture = result->get_future();
+  post([statement, result]() { result->set_value(statement()); });
+  flush();
+  return resultFuture.get();
+}
+
+}  // namespace database
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_DATABASE_DATABASE_WRITER_H
@@ -83,6 +83,9 @@ constexpr char CREATE_LAST_MARKET_DATA_TABLE[] =
     "HIGH_PRICE REAL NOT NULL, "
     "VOLUME REAL NOT NULL);";
 
+constexpr char BEGIN_TRANSACTION[] = "BEGIN TRANSACTION;";
+constexpr char COMMIT_TRANSACTION[] = "COMMIT TRANSACTION;";
+
 constexpr char MARKET_ORDER_TABLE[] = "MARKET_ORDER";
 constexpr char ORDERS_PROFIT_TABLE[] = "ORDERS_PROFIT";
 constexpr char ORDERS_MATCHING_TABLE[] = "ORDERS_MATCHING";
@@ -195,7 +198,7 @@ int browseLastMarketDataCallback(void *data, int argumentsCount, char **argument
   return 0;
 }
 
-Database::Database() {
+Database::Database(bool isWriteBehind) {
   std::string filePath;
   if (QCoreApplication::instance()) {
     auto applicationDir = QCoreApplication::applicationDirPath();
@@ -216,11 +219,26 @@ Database::Database() {
   executeStmt(statement::CREATE_ORDERS_PROFIT_TABLE, NULL, 0);
   executeStmt(statement::CREATE_ORDERS_MATCHING_TABLE, NULL, 0);
   executeStmt(statement::CREATE_LAST_MARKET_DATA_TABLE, NULL, 0);
+
+  if (isWriteBehind) {
+    writer_ = std::make_unique<DatabaseWriter>(
+        [this]() {
+          std::lock_guard<std::mutex> lock(mutex_);
+          executeLockedStmt(statement::BEGIN_TRANSACTION, NULL, 0);
+        },
+        [this]() {
+          std::lock_guard<std::mutex> lock(mutex_);
+          executeLockedStmt(statement::COMMIT_TRANSACTION, NULL, 0);
+        });
+  }
 }
 
-Database::~Database() { sqlite3_close(dbHandler_); }
+Database::~Database() {
+  writer_.reset();
+  sqlite3_close(dbHandler_);
+}
 
-void Database::insertMarketOrder(const common::MarketOrder &order) {
+int Database::insertMarketOrder(const common::MarketOrder &order) {
   std::stringstream stream;
   stream << "INSERT INTO " << statement::MARKET_ORDER_TABLE
          << " (UUID, TO_CURRENCY, FROM_CURRENCY, ORDER_TYPE, STOCK_EXCHANGE, QUANTITY, PRICE, "
@@ -237,7 +255,13 @@ void Database::insertMarketOrder(const common::MarketOrder &order) {
          << ", " << order.isCanceled_ << ");";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  std::function<int()> insertStmt = [this, sqlStmt]() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    executeLockedStmt(sqlStmt.c_str(), NULL, 0);
+    return static_cast<int>(sqlite3_last_insert_rowid(dbHandler_));
+  };
+
+  return writer_ ? writer_->callDurable(insertStmt) : insertStmt();
 }
 
 void Database::removeMarketOrder(const common::MarketOrder &order) {
@@ -248,7 +272,7 @@ void Database::removeMarketOrder(const common::MarketOrder &order) {
          << " AND STOCK_EXCHANGE = " << int(order.stockExchangeType_) << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 Database::MarketOrdersCollection Database::browseMarketOrders(
@@ -301,7 +325,7 @@ void Database::insertOrderProfit(common::StockExchangeType stockExchangeType,
          << "(" << orderId << ", " << currency << ", " << int(stockExchangeType) << ");";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeOrderProfit(common::StockExchangeType stockExchangeType,
@@ -312,7 +336,7 @@ void Database::removeOrderProfit(common::StockExchangeType stockExchangeType,
          << " AND STOCK_EXCHANGE = " << int(stockExchangeType) << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 Database::OrdersProfitCollection Database::browseOrdersProfit(
@@ -355,7 +379,7 @@ void Database::insertOrderMatching(common::StockExchangeType stockExchangeType,
       << ");";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeOrderMatching(common::StockExchangeType stockExchangeType,
@@ -368,7 +392,7 @@ void Database::removeOrderMatching(common::StockExchangeType stockExchangeType,
          << " AND STOCK_EXCHANGE = " << int(stockExchangeType) << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 model::OrderMatching Database::browseOrdersMatching(common::OrderType fromType,
@@ -407,7 +431,7 @@ void Database::removeCurrencyProfit(common::Currency::Enum currency,
          << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeCurrencyOrdersMatching(const std::string &currencyPair,
@@ -418,7 +442,7 @@ void Database::removeCurrencyOrdersMatching(const std::string &currencyPair,
          << " AND CURRENCY_PAIR = " << currencyPair << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeMarketOrders(common::Currency::Enum baseCurrency,
@@ -431,7 +455,7 @@ void Database::removeMarketOrders(common::Currency::Enum baseCurrency,
          << " AND STOCK_EXCHANGE = " << int(stockExchangeType) << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::insertMarketData(common::StockExchangeType stockExchangeType,
@@ -452,7 +476,7 @@ void Database::insertMarketData(common::StockExchangeType stockExchangeType,
          << ", " << std::to_string(data.volume_) << "); ";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeMarketData(common::StockExchangeType stockExchangeType,
@@ -466,7 +490,7 @@ void Database::removeMarketData(common::StockExchangeType stockExchangeType,
          << " AND STRATEGY_TYPE = " << int(strategiesType) << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 void Database::removeMarketData(common::StockExchangeType stockExchangeType,
@@ -479,7 +503,7 @@ void Database::removeMarketData(common::StockExchangeType stockExchangeType,
          << ";";
 
   const std::string sqlStmt = stream.str();
-  executeStmt(sqlStmt.c_str(), NULL, 0);
+  executeWriteStmt(sqlStmt);
 }
 
 Database::LastMarketDataCollection Database::browseLastMarketData(
@@ -500,11 +524,45 @@ Database::LastMarketDataCollection Database::browseLastMarketData(
 
 int Database::getLastInsertRowId() const { return sqlite3_last_insert_rowid(dbHandler_); }
 
+void Database::commit() {
+  if (writer_) {
+    writer_->commit();
+  }
+}
+
+void Database::flush() {
+  if (writer_) {
+    writer_->flush();
+  }
+}
+
 void Database::executeStmt(const char *sqlStmt, SqlCallback callback, void *param) {
+  if (writer_) {
+    writer_->waitExecuted();
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  executeLockedStmt(sqlStmt, callback, param);
+}
+
+void Database::executeWriteStmt(const std::string &sqlStmt) {
+  if (!writer_) {
+    executeStmt(sqlStmt.c_str(), NULL, 0);
+    return;
+  }
+
+  writer_->post([this, sqlStmt]() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    executeLockedStmt(sqlStmt.c_str(), NULL, 0);
+  });
+}
+
+void Database::executeLockedStmt(const char *sqlStmt, SqlCallback callback, void *param) {
   char *errMsg = nullptr;
   int result = sqlite3_exec(dbHandler_, sqlStmt, callback, param, &errMsg);
   if (result != SQLITE_OK) {
-    common::loggers::FileLogger::getLogger() << "SQL ERROR " << errMsg;
+    const std::string message = errMsg ? errMsg : sqlite3_errstr(result);
+    common::loggers::FileLogger::getLogger() << "SQL ERROR " + message;
     sqlite3_free(errMsg);
   }
 }
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/database_writer.h"
+
+#include <utility>
+
+namespace auto_trader {
+namespace database {
+
+DatabaseWriter::DatabaseWriter(Statement beginTransaction, Statement commitTransaction)
+    : beginTransaction_(std::move(beginTransaction)),
+      commitTransaction_(std::move(commitTransaction)),
+      postedCount_(0),
+      executedCount_(0),
+      isStopping_(false),
+      thread_(&DatabaseWriter::run, this) {}
+
+DatabaseWriter::~DatabaseWriter() {
+  commit();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  commandPosted_.notify_one();
+  thread_.join();
+}
+
+void DatabaseWriter::post(Statement statement) {
+  push(Command{CommandType::EXECUTE, std::move(statement)});
+}
+
+void DatabaseWriter::commit() { push(Command{CommandType::COMMIT, Statement()}); }
+
+void DatabaseWriter::waitExecuted() {
+  uint64_t commandsCount;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commandsCount = postedCount_;
+  }
+  waitExecuted(commandsCount);
+}
+
+void DatabaseWriter::flush() {
+  commit();
+  waitExecuted();
+}
+
+void DatabaseWriter::push(Command command) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    commands_.push_back(std::move(command));
+    ++postedCount_;
+  }
+  commandPosted_.notify_one();
+}
+
+void DatabaseWriter::waitExecuted(uint64_t commandsCount) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  commandExecuted_.wait(lock, [&]() { return executedCount_ >= commandsCount; });
+}
+
+void DatabaseWriter::run() {
+  bool isInTransaction = false;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    commandPosted_.wait(lock, [this]() { return isStopping_ || !commands_.empty(); });
+    if (commands_.empty()) {
+      break;
+    }
+
+    auto command = std::move(commands_.front());
+    commands_.pop_front();
+    lock.unlock();
+
+    if (command.type_ == CommandType::EXECUTE) {
+      if (!isInTransaction) {
+        beginTransaction_();
+        isInTransaction = true;
+      }
+      command.statement_();
+    } else if (isInTransaction) {
+      commitTransaction_();
+      isInTransaction = false;
+    }
+
+    lock.lock();
+    ++executedCount_;
+    commandExecuted_.notify_all();
+  }
+}
+
+}  // namespace database
+}  // namespace auto_trader
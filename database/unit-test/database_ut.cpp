@@ -49,6 +49,7 @@ namespace unit_test {
  *  12. Add last market data and check db.
  *  13. Remove last market data and check db.
  *  14. Remove market orders.
+ *  15. Insert market order to write-behind database and check it is committed.
  *
  **/
 
@@ -512,6 +513,29 @@ TEST_F(DatabaseUTFixture, Remove_Market_Orders_14) {
   EXPECT_EQ(orders.size(), 0);
 }
 
+TEST_F(DatabaseUTFixture, Insert_MarketOrder_Write_Behind_15) {
+  common::Date opened{1, 2, 3, 4, 5, 6};
+
+  common::MarketOrder order{0,
+                            "ff-01",
+                            common::Currency::BTC,
+                            common::Currency::USD,
+                            common::OrderType::BUY,
+                            common::StockExchangeType::Bittrex,
+                            1.45,
+                            2.21,
+                            opened,
+                            false};
+
+  Database writeBehindDatabase(/*isWriteBehind=*/true);
+  writeBehindDatabase.insertMarketOrder(order);
+
+  // Another connection sees committed rows only.
+  auto orders = GetDatabase().browseMarketOrders(common::StockExchangeType::Bittrex);
+
+  EXPECT_EQ(orders.size(), 1);
+}
+
 }  // namespace unit_test
 }  // namespace database
 }  // namespace auto_trader
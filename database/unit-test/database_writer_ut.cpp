@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/loggers/file_logger.h"
+#include "include/database_writer.h"
+
+namespace auto_trader {
+namespace database {
+namespace unit_test {
+
+namespace {
+
+// FileLogger writes to logging/ under the working directory when no QApplication runs.
+size_t countLoggedLines() {
+  std::ifstream file("logging/b2s_info.log");
+  size_t linesCount = 0;
+  for (std::string line; std::getline(file, line);) {
+    ++linesCount;
+  }
+
+  return linesCount;
+}
+
+}  // namespace
+
+class DatabaseWriterUTFixture : public ::testing::Test {
+ public:
+  void SetUp() override {
+    writer_ = std::make_unique<DatabaseWriter>([this]() { events_.push_back("BEGIN"); },
+                                               [this]() { events_.push_back("COMMIT"); });
+  }
+
+  DatabaseWriter::Statement record(const std::string& event) {
+    return [this, event]() { events_.push_back(event); };
+  }
+
+ protected:
+  // Written by the writer thread only, read once the test waited for it.
+  std::vector<std::string> events_;
+  std::unique_ptr<DatabaseWriter> writer_;
+};
+
+TEST_F(DatabaseWriterUTFixture, StatementsOfCycleShareTransaction) {
+  writer_->post(record("INSERT 1"));
+  writer_->post(record("INSERT 2"));
+  writer_->commit();
+  writer_->post(record("INSERT 3"));
+  writer_->flush();
+
+  std::vector<std::string> expectedEvents = {"BEGIN",  "INSERT 1", "INSERT 2", "COMMIT",
+                                             "BEGIN",  "INSERT 3", "COMMIT"};
+  EXPECT_EQ(expectedEvents, events_);
+}
+
+TEST_F(DatabaseWriterUTFixture, EmptyCycleIsNotCommitted) {
+  writer_->commit();
+  writer_->flush();
+
+  EXPECT_TRUE(events_.empty());
+}
+
+TEST_F(DatabaseWriterUTFixture, CallDurableReturnsAfterCommit) {
+  writer_->post(record("INSERT 1"));
+  int rowId = writer_->callDurable(std::function<int()>([this]() {
+    events_.push_back("INSERT 2");
+    return 2;
+  }));
+
+  EXPECT_EQ(2, rowId);
+  std::vector<std::string> expectedEvents = {"BEGIN", "INSERT 1", "INSERT 2", "COMMIT"};
+  EXPECT_EQ(expectedEvents, events_);
+}
+
+TEST_F(DatabaseWriterUTFixture, WaitExecutedDoesNotCommit) {
+  writer_->post(record("INSERT 1"));
+  writer_->waitExecuted();
+
+  std::vector<std::string> expectedEvents = {"BEGIN", "INSERT 1"};
+  EXPECT_EQ(expectedEvents, events_);
+}
+
+TEST_F(DatabaseWriterUTFixture, DestructionCommitsQueuedStatements) {
+  writer_->post(record("INSERT 1"));
+  writer_.reset();
+
+  std::vector<std::string> expectedEvents = {"BEGIN", "INSERT 1", "COMMIT"};
+  EXPECT_EQ(expectedEvents, events_);
+}
+
+TEST_F(DatabaseWriterUTFixture, StatementsLogAlongsideCaller) {
+  common::loggers::FileLogger::getLogger() << "Logging started";
+  const size_t linesCount = countLoggedLines();
+
+  // Failed statements log from the writer thread while the trading thread logs as well.
+  const size_t statementsCount = 1000;
+  for (size_t index = 0; index < statementsCount; ++index) {
+    writer_->post([this]() {
+      common::loggers::FileLogger::getLogger() << "SQL ERROR from writer";
+      events_.push_back("LOGGED");
+    });
+  }
+  for (size_t index = 0; index < statementsCount; ++index) {
+    common::loggers::FileLogger::getLogger() << "Message from caller";
+  }
+  writer_->flush();
+
+  EXPECT_EQ(statementsCount + 2, events_.size());
+  EXPECT_EQ(linesCount + 2 * statementsCount, countLoggedLines());
+}
+
+}  // namespace unit_test
+}  // namespace database
+}  // namespace auto_trader
@@ -39,6 +39,9 @@ struct AppSettings {
   /* Time to sleep between updating statistic in minutes. */
   unsigned int appStatsTimeout_{5};
 
+  /* Most HTTPS connections kept open to one stock exchange host at once. */
+  unsigned int maxConnectionsPerHost_{4};
+
   /* Parameter to track trading logging should be displayed on UI. */
   bool uiLoggingEnabled_{true};
 
@@ -52,6 +52,12 @@ struct BollingerBandsAdvancedSettings : public StrategySettings {
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, bbInputType_, period_, standardDeviations_,
+                                 topLinePercentage_, bottomLinePercentage_, crossingInterval_);
+  }
+
   common::BollingerInputType bbInputType_{common::BollingerInputType::closePosition_};
   unsigned int period_{20};
   unsigned int standardDeviations_{2};
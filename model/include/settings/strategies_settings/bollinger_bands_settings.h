@@ -50,6 +50,12 @@ struct BollingerBandsSettings : public StrategySettings {
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, bbInputType_, period_, standardDeviations_,
+                                 crossingInterval_);
+  }
+
   common::BollingerInputType bbInputType_{common::BollingerInputType::closePosition_};
   unsigned int period_{20};
   unsigned int standardDeviations_{2};
@@ -46,6 +46,11 @@ struct EmaSettings : public StrategySettings {
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, period_, crossingInterval_);
+  }
+
   unsigned int period_{14};
   unsigned int crossingInterval_{0};
 };
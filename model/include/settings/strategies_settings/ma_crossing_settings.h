@@ -51,6 +51,12 @@ struct MovingAveragesCrossingSettings : public StrategySettings {
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, smallerPeriod_, biggerPeriod_, crossingInterval_,
+                                 movingAverageType_);
+  }
+
   int smallerPeriod_{5};
   int biggerPeriod_{10};
   int crossingInterval_{0};
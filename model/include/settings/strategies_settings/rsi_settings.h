@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_MODEL_RSI_SETTINGS_H
 #define AUTO_TRADER_MODEL_RSI_SETTINGS_H
 
+#include "common/enumerations/rsi_smoothing_type.h"
 #include "strategy_settings.h"
 
 namespace auto_trader {
@@ -44,14 +45,22 @@ struct RsiSettings : public StrategySettings {
     strategySettings->bottomLevel_ = bottomLevel_;
     strategySettings->topLevel_ = topLevel_;
     strategySettings->crossingInterval_ = crossingInterval_;
+    strategySettings->smoothingType_ = smoothingType_;
 
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, period_, bottomLevel_, topLevel_, crossingInterval_,
+                                 smoothingType_);
+  }
+
   unsigned int period_{14};
   unsigned int bottomLevel_{20};
   unsigned int topLevel_{80};
   unsigned int crossingInterval_{0};
+  common::RsiSmoothingType smoothingType_{common::RsiSmoothingType::SIMPLE};
 };
 
 }  // namespace model
@@ -52,6 +52,12 @@ struct StochasticOscillatorSettings : public StrategySettings {
     return std::move(strategySettings);
   }
 
+  void writeResultKey(std::ostream& stream) const override {
+    StrategySettings::writeResultKey(stream);
+    common::writeResultKeyValues(stream, stochasticType_, periodsForClassicLine_, smoothFastPeriod_,
+                                 smoothSlowPeriod_, crossingInterval_, topLevel, bottomLevel);
+  }
+
   common::StochasticOscillatorType stochasticType_{common::StochasticOscillatorType::Quick};
   int periodsForClassicLine_{14};
   int smoothFastPeriod_ = {3};
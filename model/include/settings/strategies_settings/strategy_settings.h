@@ -28,10 +28,13 @@
 #define AUTO_TRADER_MODEL_STRATEGY_SETTINGS_H
 
 #include <memory>
+#include <ostream>
+#include <sstream>
 #include <string>
 
 #include "common/enumerations/strategies_type.h"
 #include "common/enumerations/tick_interval.h"
+#include "common/result_key_utils.h"
 #include "strategy_settings_visitor.h"
 
 namespace auto_trader {
@@ -49,6 +52,20 @@ struct StrategySettings {
   virtual void accept(StrategySettingsVisitor& visitor) const {}
   virtual std::unique_ptr<StrategySettings> clone() const = 0;
 
+  // Canonical text of everything the indicator lines and signals depend on, crossing points
+  // included. Equal settings give equal text and can share one computed result.
+  std::string getResultKey() const {
+    std::ostringstream stream;
+    stream << std::hexfloat;
+    writeResultKey(stream);
+    return stream.str();
+  }
+
+  virtual void writeResultKey(std::ostream& stream) const {
+    common::writeResultKeyValues(stream, tickInterval_, strategiesType_, lastBuyCrossingPoint_,
+                                 lastSellCrossingPoint_);
+  }
+
   virtual ~StrategySettings() {}
 };
 
@@ -43,6 +43,9 @@ void AppSettingsJsonSerializer::serialize(const model::AppSettings &appSettings,
   printHandler.key("app_stats_timeout");
   printHandler.value(appSettings.appStatsTimeout_);
 
+  printHandler.key("max_connections_per_host");
+  printHandler.value(appSettings.maxConnectionsPerHost_);
+
   printHandler.key("ui_theme");
   printHandler.value(static_cast<unsigned int>(appSettings.theme_));
 
@@ -68,6 +71,14 @@ void AppSettingsJsonSerializer::deserialize(model::AppSettings &appSettings, std
   appSettings.tradingTimeout_ = tradingTimeout;
   appSettings.appStatsTimeout_ = appStatsTimeout;
 
+  // Files written before the limit was configurable keep the default one.
+  if (object->has("max_connections_per_host")) {
+    auto maxConnectionsPerHost = object->getValue<unsigned int>("max_connections_per_host");
+    if (maxConnectionsPerHost > 0) {
+      appSettings.maxConnectionsPerHost_ = maxConnectionsPerHost;
+    }
+  }
+
   auto theme = object->getValue<unsigned int>("ui_theme");
   appSettings.theme_ = static_cast<common::ApplicationThemeType>(theme);
 }
@@ -234,6 +234,9 @@ void StrategyJSONSerializer::visit(const model::RsiSettings &rsiSettings) {
   printHandler_->key("bottom_level");
   printHandler_->value(rsiSettings.bottomLevel_);
 
+  printHandler_->key("smoothing_type");
+  printHandler_->value(static_cast<int>(rsiSettings.smoothingType_));
+
   printHandler_->endObject();
 }
 
@@ -450,6 +453,15 @@ void StrategyJSONSerializer::deserializeRsiSettings(Poco::JSON::Object::Ptr json
 
   auto bottomlevel = rsiObject->getValue<unsigned int>("bottom_level");
   rsiSettings.bottomLevel_ = bottomlevel;
+
+  // Files written before the Wilder smoothing, or with an unknown value, keep the default one.
+  if (rsiObject->has("smoothing_type")) {
+    auto smoothingType = rsiObject->getValue<int>("smoothing_type");
+    if (smoothingType >= static_cast<int>(common::RsiSmoothingType::SIMPLE) &&
+        smoothingType < static_cast<int>(common::RsiSmoothingType::UNKNOWN)) {
+      rsiSettings.smoothingType_ = static_cast<common::RsiSmoothingType>(smoothingType);
+    }
+  }
 }
 
 void StrategyJSONSerializer::deserializeSmaSettings(Poco::JSON::Object::Ptr jsonObject,
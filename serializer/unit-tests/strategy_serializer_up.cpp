@@ -25,6 +25,8 @@
  */
 
 #include <fstream>
+#include <regex>
+#include <sstream>
 
 #include "model/include/settings/strategies_settings/bollinger_bands_settings.h"
 #include "model/include/settings/strategies_settings/custom_strategy_settings.h"
@@ -51,6 +53,7 @@ namespace unit_tests {
  * 7. Custom RSI + BB settings.
  * 8. Custom RSI + BB + EMA settings.
  * 9. Custom MACrossing + PingPong settings.
+ * 10. RSI settings with an unknown smoothing type.
  *
  **/
 
@@ -411,6 +414,25 @@ TEST_F(StrategySerializerUTFixture, MaCrossing_PingPong) {
   remove(filename.c_str());
 }
 
+TEST_F(StrategySerializerUTFixture, RsiSettings_UnknownSmoothingType) {
+  auto rsiSettings = std::make_unique<model::RsiSettings>();
+  rsiSettings->period_ = 14;
+  rsiSettings->tickInterval_ = common::TickInterval::ONE_HOUR;
+  rsiSettings->strategiesType_ = common::StrategiesType::RSI;
+  rsiSettings->name_ = "rsi_settings";
+  rsiSettings->smoothingType_ = common::RsiSmoothingType::WILDER;
+
+  std::stringstream outputStream;
+  getStrategySerializer().serialize(*rsiSettings, outputStream);
+
+  std::stringstream inputStream(std::regex_replace(
+      outputStream.str(), std::regex("\"smoothing_type\"\\s*:\\s*\\d+"), "\"smoothing_type\" : 7"));
+  auto restoredSettings = getStrategySerializer().deserialize(inputStream);
+
+  const auto &rsiSettingsFromFile = dynamic_cast<const model::RsiSettings &>(*restoredSettings);
+  EXPECT_EQ(rsiSettingsFromFile.smoothingType_, common::RsiSmoothingType::SIMPLE);
+}
+
 }  // namespace unit_tests
 }  // namespace serializer
-}  // namespace auto_trader
\ No newline at end of file
+}  // namespace auto_trader
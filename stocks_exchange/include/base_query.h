@@ -28,17 +28,24 @@
 #ifndef AUTO_TRADER_STOCK_EXCHANGE_BASE_QUERY_H
 #define AUTO_TRADER_STOCK_EXCHANGE_BASE_QUERY_H
 
+#include <Poco/Exception.h>
 #include <Poco/JSON/Object.h>
 #include <Poco/JSON/Parser.h>
-#include <Poco/Net/Context.h>
 #include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/Net/HTTPSClientSession.h>
 #include <Poco/URI.h>
 
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 
+#include "include/balances_snapshot.h"
 #include "common/exceptions/stock_exchange_exception/redirect_http_exception.h"
+#include "common/loggers/file_logger.h"
+#include "include/https_session_pool.h"
+#include "include/ticks_snapshot.h"
 #include "resources/resources.h"
 
 namespace auto_trader {
@@ -53,8 +60,22 @@ class BaseQuery : public BaseClass {
   };
 
  public:
-  inline virtual void updateApiKey(const std::string& api_key) { api_key_ = api_key; }
-  inline virtual void updateSecretKey(const std::string& secret_key) { secret_key_ = secret_key; }
+  inline virtual void updateApiKey(const std::string& api_key) {
+    api_key_ = api_key;
+    balancesSnapshot_.invalidate();
+  }
+  inline virtual void updateSecretKey(const std::string& secret_key) {
+    secret_key_ = secret_key;
+    balancesSnapshot_.invalidate();
+  }
+
+  // Serves balances from a short-lived snapshot, so a refresh of several coins costs one
+  // request instead of one per coin.
+  CurrencyBalances getBalances() override;
+  void invalidateBalances() override { balancesSnapshot_.invalidate(); }
+
+  // Serves ticks of a base currency from a snapshot shared by every reader of this query.
+  CurrencyTicks getAllTicks(common::Currency::Enum baseCurrency) override;
 
  public:
   typedef std::pair<std::string, std::string> HTTP_HEADERS;
@@ -62,30 +83,117 @@ class BaseQuery : public BaseClass {
                                                Poco::Net::HTTPRequest& request,
                                                const std::vector<HTTP_HEADERS>& headers) const;
 
+  void setSessionPool(const std::shared_ptr<HttpsSessionPool>& sessionPool) override {
+    std::lock_guard<std::mutex> lock(sessionPoolMutex_);
+    sessionPool_ = sessionPool;
+  }
+
+ protected:
+  virtual CurrencyBalances requestBalances() = 0;
+  virtual CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) = 0;
+
+ private:
+  const std::string receiveHttpResponse(HttpsSessionPool::Lease& session) const;
+  std::shared_ptr<HttpsSessionPool> getSessionPool() const;
+
  protected:
   std::string api_key_;
   std::string secret_key_;
+
+ private:
+  mutable std::mutex sessionPoolMutex_;
+  mutable std::shared_ptr<HttpsSessionPool> sessionPool_;
+  BalancesSnapshot balancesSnapshot_{resources::numbers::BALANCES_SNAPSHOT_TIME_TO_LIVE_MS};
+  TicksSnapshot ticksSnapshot_{resources::numbers::TICKS_SNAPSHOT_TIME_TO_LIVE_MS};
 };
 
+template <typename BaseClass>
+CurrencyBalances BaseQuery<BaseClass>::getBalances() {
+  using namespace std::chrono;
+
+  CurrencyBalances balances;
+  auto currentTime = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+  if (balancesSnapshot_.get(currentTime, balances)) {
+    return balances;
+  }
+
+  balances = requestBalances();
+  balancesSnapshot_.update(balances, currentTime);
+  return balances;
+}
+
+template <typename BaseClass>
+CurrencyTicks BaseQuery<BaseClass>::getAllTicks(common::Currency::Enum baseCurrency) {
+  using namespace std::chrono;
+
+  CurrencyTicks ticks;
+  auto currentTime = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+  if (ticksSnapshot_.get(baseCurrency, currentTime, ticks)) {
+    return ticks;
+  }
+
+  ticks = requestAllTicks(baseCurrency);
+  ticksSnapshot_.update(baseCurrency, ticks, currentTime);
+  return ticks;
+}
+
 template <typename BaseClass>
 const std::string BaseQuery<BaseClass>::processHttpRequest(
     const ConnectionAttributes& host_and_port, Poco::Net::HTTPRequest& request,
     const std::vector<HTTP_HEADERS>& headers) const {
   using namespace Poco;
 
-  Net::Context::Ptr ctx = new Net::Context(
-      Net::Context::CLIENT_USE, resources::symbols::EMPTY_STR, resources::symbols::EMPTY_STR,
-      resources::symbols::EMPTY_STR, Net::Context::VerificationMode::VERIFY_NONE);
-  Poco::Net::HTTPSClientSession session(host_and_port.host_, host_and_port.port_, ctx);
-
   for (auto header : headers) {
     request.set(header.first, header.second);
   }
+  request.setKeepAlive(true);
+
+  auto sessionPool = getSessionPool();
+  auto session = sessionPool->acquire(host_and_port.host_, host_and_port.port_);
+  bool isRequestSent = false;
+  try {
+    session->sendRequest(request);
+    isRequestSent = true;
+    return receiveHttpResponse(session);
+  } catch (const common::exceptions::RedirectHttpsException&) {
+    throw;
+  } catch (const Poco::Exception& exception) {
+    // A reused connection may have been closed by the server while idle. Only requests which
+    // surely did not reach the exchange are repeated, so an order is never placed twice.
+    const bool isIdempotent = request.getMethod() == Net::HTTPRequest::HTTP_GET;
+    if (!session.isReused() || (isRequestSent && !isIdempotent)) {
+      throw;
+    }
+    common::loggers::FileLogger::getLogger()
+        << resources::messages::STALE_HTTPS_SESSION_RETRY + " " + exception.displayText();
+  }
 
-  session.sendRequest(request);
+  // The lease keeps its per-host slot, so the retry reconnects it in place: acquiring another
+  // session here would wait forever once the host is at maxConnectionsPerHost_.
+  sessionPool->dropIdleSessions(host_and_port.host_, host_and_port.port_);
+  session->reset();
+  session->sendRequest(request);
+  return receiveHttpResponse(session);
+}
+
+template <typename BaseClass>
+std::shared_ptr<HttpsSessionPool> BaseQuery<BaseClass>::getSessionPool() const {
+  std::lock_guard<std::mutex> lock(sessionPoolMutex_);
+  // A query used without QueryProcessor opens its connections from a pool of its own.
+  if (!sessionPool_) {
+    sessionPool_ = std::make_shared<HttpsSessionPool>();
+  }
+
+  return sessionPool_;
+}
+
+template <typename BaseClass>
+const std::string BaseQuery<BaseClass>::receiveHttpResponse(
+    HttpsSessionPool::Lease& session) const {
+  using namespace Poco;
 
   Net::HTTPResponse response;
-  auto& stream = session.receiveResponse(response);
+  auto& stream = session->receiveResponse(response);
 
   bool moved = (response.getStatus() == Net::HTTPResponse::HTTP_MOVED_PERMANENTLY ||
                 response.getStatus() == Net::HTTPResponse::HTTP_FOUND ||
@@ -100,6 +208,10 @@ const std::string BaseQuery<BaseClass>::processHttpRequest(
   std::istreambuf_iterator<char> iterator;
   std::string output(std::istreambuf_iterator<char>(stream), iterator);
 
+  if (response.getKeepAlive()) {
+    session.release();
+  }
+
   return output;
 }
 
@@ -28,17 +28,25 @@
 #ifndef STOCKS_EXCHANGE_BINANCE_QUERY_H_
 #define STOCKS_EXCHANGE_BINANCE_QUERY_H_
 
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
 #include "base_query.h"
 #include "common/binance_currency.h"
 #include "common/currency.h"
 #include "common/encryption_sha256_engine.h"
 #include "query.h"
+#include "server_clock.h"
 
 namespace auto_trader {
 namespace stock_exchange {
 
 class BinanceQuery : public BaseQuery<Query> {
  public:
+  ~BinanceQuery() override;
+
   common::MarketOrder sellOrder(common::Currency::Enum fromCurrency,
                                 common::Currency::Enum toCurrency, double quantity,
                                 double rate) override;
@@ -51,6 +59,7 @@ class BinanceQuery : public BaseQuery<Query> {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
   std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency) override;
   common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
@@ -60,19 +69,56 @@ class BinanceQuery : public BaseQuery<Query> {
   common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
                                             common::Currency::Enum toCurrency,
                                             common::TickInterval::Enum interval) override;
+  common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                 common::Currency::Enum toCurrency,
+                                                 common::TickInterval::Enum interval,
+                                                 const common::Date& openDate) override;
+  common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount) override;
 
   common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                        common::Currency::Enum toCurrency) override;
   double getBalance(common::Currency::Enum currency) override;
 
   CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
+
+ protected:
+  CurrencyBalances requestBalances() override;
+  CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) override;
 
  private:
   uint64_t getCurrentServerTime();
+  uint64_t getSignatureTimestamp();
+  void synchronizeServerClock();
+  // Resyncs the server clock every resync period until the query is destroyed.
+  void runClockThread();
+
+  // Sends a request signed with a fresh timestamp. A request rejected with -1021 is sent once
+  // more after a clock resync.
+  std::string processSignedRequest(const std::string& method, const std::string& endpoint,
+                                   const std::string& parameters);
+  std::string sendSignedRequest(const std::string& method, const std::string& endpoint,
+                                const std::string& parameters);
+  bool isInvalidTimestampResponse(const std::string& response) const;
+  void checkBinanceResponseMessage(Poco::JSON::Object::Ptr& object) const;
   common::MarketHistoryPtr parseMarketHistory(const std::string& response) const;
+  common::MarketHistoryPtr requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                common::Currency::Enum toCurrency,
+                                                common::TickInterval::Enum interval,
+                                                const std::string& windowParameters);
 
  private:
   common::BinanceCurrency binanceCurrency_;
+  mutable ServerClock serverClock_{resources::binance::BINANCE_CLOCK_RESYNC_PERIOD_MS};
+
+  std::once_flag clockThreadFlag_;
+  std::thread clockThread_;
+  std::mutex clockThreadMutex_;
+  std::condition_variable clockThreadStopped_;
+  bool isStopped_{false};
 };
 
 }  // namespace stock_exchange
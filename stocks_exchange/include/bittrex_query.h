@@ -49,6 +49,7 @@ class BittrexQuery : public BaseQuery<Query> {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
   std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency) override;
   common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
@@ -64,6 +65,11 @@ class BittrexQuery : public BaseQuery<Query> {
   double getBalance(common::Currency::Enum currency) override;
 
   CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
+
+ protected:
+  CurrencyBalances requestBalances() override;
+  CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) override;
 
  private:
   common::MarketHistoryPtr parseMarketHistory(const std::string& response) const;
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_CACHING_QUERY_H
+#define AUTO_TRADER_STOCK_EXCHANGE_CACHING_QUERY_H
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+#include "include/candle_ring.h"
+#include "include/query.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+// Decorates the query of one exchange with a candle cache per market and interval. Only the
+// first market history request downloads the full window; later ones ask the exchange for the
+// candles opened since the last cached one and serve the rest from memory. Every other request
+// is passed through unchanged.
+class CachingQuery : public Query {
+ public:
+  explicit CachingQuery(QueryPtr query);
+
+  common::MarketOrder sellOrder(common::Currency::Enum fromCurrency,
+                                common::Currency::Enum toCurrency, double quantity,
+                                double rate) override;
+  common::MarketOrder buyOrder(common::Currency::Enum fromCurrency,
+                               common::Currency::Enum toCurrency, double quantity,
+                               double rate) override;
+  bool cancelOrder(common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency,
+                   const std::string& uuid) override;
+  void updateApiKey(const std::string& api_key) override;
+  void updateSecretKey(const std::string& secret_key) override;
+
+  common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
+                                            common::Currency::Enum toCurrency,
+                                            common::TickInterval::Enum interval) override;
+  common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                 common::Currency::Enum toCurrency,
+                                                 common::TickInterval::Enum interval,
+                                                 const common::Date& openDate) override;
+  common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount) override;
+
+  std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
+                                                       common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
+                                                        common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
+  common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
+                                      common::Currency::Enum toCurrency,
+                                      const std::string& uuid) override;
+
+  common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
+                                       common::Currency::Enum toCurrency) override;
+  CurrencyTicks getAllTicks(common::Currency::Enum baseCurrency) override;
+  double getBalance(common::Currency::Enum currency) override;
+  CurrencyBalances getBalances() override;
+  void invalidateBalances() override;
+
+  CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
+  void setSessionPool(const std::shared_ptr<HttpsSessionPool>& sessionPool) override;
+
+ private:
+  typedef std::tuple<common::Currency::Enum, common::Currency::Enum, common::TickInterval::Enum>
+      MarketKey;
+
+  // Marks a window downloaded without a candles count, at the exchange default size.
+  static constexpr size_t DEFAULT_WINDOW = std::numeric_limits<size_t>::max();
+
+  struct CachedCandles {
+    std::mutex mutex_;
+    CandleRing candles_;
+    size_t candlesCount_{0};
+  };
+
+  std::shared_ptr<CachedCandles> getCachedCandles(const MarketKey& key);
+  common::MarketHistoryPtr getCachedMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount);
+
+ private:
+  QueryPtr query_;
+
+  std::mutex cacheMutex_;
+  std::map<MarketKey, std::shared_ptr<CachedCandles>> cache_;
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_CACHING_QUERY_H
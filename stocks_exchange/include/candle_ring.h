@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_CANDLE_RING_H
+#define AUTO_TRADER_STOCK_EXCHANGE_CANDLE_RING_H
+
+#include <deque>
+#include <vector>
+
+#include "common/date.h"
+#include "common/market_data.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+// The newest candles of one market and interval, oldest first. The window keeps the size of
+// the first full download; later downloads only top it up, replacing the still-open last candle
+// and dropping the oldest ones as new candles close.
+class CandleRing {
+ public:
+  CandleRing() = default;
+
+  void reset(const std::vector<common::MarketData>& candles);
+  // Returns false when the candles do not reach back to the last cached one, so a gap would
+  // be left in the window and the caller has to download it in full again.
+  bool merge(const std::vector<common::MarketData>& candles);
+
+  bool empty() const { return candles_.empty(); }
+  size_t size() const { return candles_.size(); }
+  const common::Date& getLastOpenDate() const { return candles_.back().date_; }
+  std::vector<common::MarketData> getCandles() const;
+
+ private:
+  std::deque<common::MarketData> candles_;
+  size_t capacity_{0};
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_CANDLE_RING_H
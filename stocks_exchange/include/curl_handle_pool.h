@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_CURL_HANDLE_POOL_H
+#define AUTO_TRADER_STOCK_EXCHANGE_CURL_HANDLE_POOL_H
+
+#include <curl/curl.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+// Long-lived curl easy handles of one query object. A released handle is reset but not cleaned
+// up, so it keeps its open connections, and all handles of the pool share one DNS cache, TLS
+// session cache and connection cache. The pool must outlive its handles.
+class CurlHandlePool {
+ public:
+  class Handle {
+   public:
+    Handle(Handle&& handle) noexcept;
+    ~Handle();
+
+    Handle(const Handle&) = delete;
+    Handle& operator=(const Handle&) = delete;
+    Handle& operator=(Handle&&) = delete;
+
+    CURL* get() const { return curl_; }
+
+   private:
+    friend class CurlHandlePool;
+
+    Handle(CurlHandlePool& pool, CURL* curl);
+
+   private:
+    CurlHandlePool* pool_;
+    CURL* curl_;
+  };
+
+  CurlHandlePool();
+  ~CurlHandlePool();
+
+  CurlHandlePool(const CurlHandlePool&) = delete;
+  CurlHandlePool& operator=(const CurlHandlePool&) = delete;
+
+  // Returns nullptr in the handle when curl fails to create one, like curl_easy_init().
+  Handle acquire();
+
+  size_t getIdleCount() const;
+
+ private:
+  void release(CURL* curl);
+
+  static void lockShare(CURL* curl, curl_lock_data data, curl_lock_access access, void* pool);
+  static void unlockShare(CURL* curl, curl_lock_data data, void* pool);
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<CURL*> idleHandles_;
+  CURLSH* share_;
+  std::mutex shareMutexes_[CURL_LOCK_DATA_LAST];
+};
+
+// Runs several prepared easy handles at once on one curl multi handle, so requests to the same
+// host are in flight together and reuse the connections of the pool instead of waiting for each
+// other. perform() returns the response bodies in the order of the handles; a failed transfer
+// gives an empty body, as a failed curl_easy_perform() does in sendRequest().
+class CurlMultiExecutor {
+ public:
+  CurlMultiExecutor();
+  ~CurlMultiExecutor();
+
+  CurlMultiExecutor(const CurlMultiExecutor&) = delete;
+  CurlMultiExecutor& operator=(const CurlMultiExecutor&) = delete;
+
+  std::vector<std::string> perform(const std::vector<CURL*>& curls);
+
+ private:
+  std::mutex mutex_;
+  CURLM* multi_;
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_CURL_HANDLE_POOL_H
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_HTTPS_SESSION_POOL_H
+#define AUTO_TRADER_STOCK_EXCHANGE_HTTPS_SESSION_POOL_H
+
+#include <Poco/Net/Context.h>
+#include <Poco/Net/HTTPSClientSession.h>
+#include <Poco/Net/Session.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "resources/resources.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+// Keeps HTTPS sessions alive between requests, so a query pays the TCP connect and the TLS
+// handshake once per connection instead of once per request. All sessions share one client
+// Context with the session cache on, and a new connection to a known host resumes the TLS
+// session of the previous one. Idle sessions older than idleTimeout_ are closed, a session whose
+// socket became readable while idle (peer closed it) is dropped on acquire, and at most
+// maxConnectionsPerHost_ sessions per host exist at once; acquire() waits for a free one.
+class HttpsSessionPool {
+ public:
+  struct Settings {
+    size_t maxConnectionsPerHost_{resources::numbers::MAX_HTTPS_CONNECTIONS_PER_HOST};
+    std::chrono::seconds idleTimeout_{resources::numbers::HTTPS_SESSION_IDLE_TIMEOUT_SECONDS};
+  };
+
+  class Lease {
+   public:
+    Lease(Lease&& lease) noexcept;
+    ~Lease();
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+    Lease& operator=(Lease&&) = delete;
+
+    Poco::Net::HTTPSClientSession& operator*() const { return *session_; }
+    Poco::Net::HTTPSClientSession* operator->() const { return session_.get(); }
+
+    // True when the session already served a request, i.e. the server may have closed it.
+    bool isReused() const { return isReused_; }
+
+    // Returns the session for reuse. Call it only after the whole response body has been
+    // read; a lease destroyed without release() closes its session.
+    void release();
+
+   private:
+    friend class HttpsSessionPool;
+
+    Lease(HttpsSessionPool& pool, const std::string& hostKey,
+          std::unique_ptr<Poco::Net::HTTPSClientSession> session, bool isReused);
+
+   private:
+    HttpsSessionPool* pool_;
+    std::string hostKey_;
+    std::unique_ptr<Poco::Net::HTTPSClientSession> session_;
+    bool isReused_;
+  };
+
+  HttpsSessionPool();
+  explicit HttpsSessionPool(const Settings& settings);
+
+  void configure(const Settings& settings);
+
+  Lease acquire(const std::string& host, unsigned short port);
+
+  // Closes the idle sessions of a host, e.g. after one of them turned out to be stale.
+  void dropIdleSessions(const std::string& host, unsigned short port);
+
+ private:
+  using Clock = std::chrono::steady_clock;
+  using SessionPtr = std::unique_ptr<Poco::Net::HTTPSClientSession>;
+
+  struct IdleSession {
+    SessionPtr session_;
+    Clock::time_point lastUsedTime_;
+  };
+
+  struct HostSessions {
+    std::vector<IdleSession> idleSessions_;
+    size_t openedCount_{0};
+    Poco::Net::Session::Ptr tlsSession_;
+  };
+
+  void release(const std::string& hostKey, SessionPtr session, bool isReusable);
+
+  void evictExpiredSessions(HostSessions& hostSessions, std::vector<SessionPtr>& evicted);
+  static bool isHealthy(Poco::Net::HTTPSClientSession& session);
+  static std::string createHostKey(const std::string& host, unsigned short port);
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable sessionReleased_;
+  Settings settings_;
+  Poco::Net::Context::Ptr context_;
+  std::map<std::string, HostSessions> hosts_;
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_HTTPS_SESSION_POOL_H
@@ -30,8 +30,13 @@
 
 #include <curl/curl.h>
 
+#include <map>
+#include <mutex>
+#include <string>
+
 #include "base_query.h"
 #include "common/currency.h"
+#include "curl_handle_pool.h"
 #include "query.h"
 
 namespace auto_trader {
@@ -44,6 +49,9 @@ struct HuobiPrecision {
 
 class HuobiQuery : public BaseQuery<Query> {
  public:
+  void updateApiKey(const std::string& api_key) override;
+  void updateSecretKey(const std::string& secret_key) override;
+
   common::MarketOrder sellOrder(common::Currency::Enum fromCurrency,
                                 common::Currency::Enum toCurrency, double quantity,
                                 double rate) override;
@@ -56,6 +64,7 @@ class HuobiQuery : public BaseQuery<Query> {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
   std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency) override;
   common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
@@ -65,22 +74,57 @@ class HuobiQuery : public BaseQuery<Query> {
   common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
                                             common::Currency::Enum toCurrency,
                                             common::TickInterval::Enum interval) override;
+  common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                 common::Currency::Enum toCurrency,
+                                                 common::TickInterval::Enum interval,
+                                                 const common::Date& openDate) override;
+  common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount) override;
 
   common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                        common::Currency::Enum toCurrency) override;
   double getBalance(common::Currency::Enum currency) override;
 
   virtual std::string sendRequest(CURL* curl) const;
+  // Performs prepared requests concurrently and returns their responses in the same order.
+  virtual std::vector<std::string> sendRequests(const std::vector<CURL*>& curls) const;
 
   CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
   uint64_t getCurrentServerTime();
 
+ protected:
+  CurrencyBalances requestBalances() override;
+  CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) override;
+
  private:
   common::MarketHistoryPtr parseMarketHistory(const Poco::JSON::Object::Ptr& response) const;
+  common::MarketHistoryPtr requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                common::Currency::Enum toCurrency,
+                                                common::TickInterval::Enum interval,
+                                                const std::string& windowParameters);
   std::string getAccountIdentifier() const;
+  std::string requestAccountIdentifier() const;
 
   HuobiPrecision getHuobiPrecision(common::Currency::Enum fromCurrency,
                                    common::Currency::Enum toCurrency);
+  std::map<std::string, HuobiPrecision> requestSymbolsPrecision();
+
+  void resetAccountMetadata();
+
+ private:
+  // The account id and the symbols precision do not change during a session, so they are
+  // requested once and kept until the keys change. The precision table is reloaded when it gets
+  // older than the refresh period or misses a symbol, and stays usable if the reload fails.
+  mutable std::mutex metadataMutex_;
+  mutable std::string accountIdentifier_;
+  std::map<std::string, HuobiPrecision> symbolsPrecision_;
+  uint64_t symbolsPrecisionLoadTime_{0};
+
+  mutable CurlHandlePool curlHandles_;
+  mutable CurlMultiExecutor curlExecutor_;
 };
 
 }  // namespace stock_exchange
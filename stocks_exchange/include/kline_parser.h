@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_KLINE_PARSER_H
+#define AUTO_TRADER_STOCK_EXCHANGE_KLINE_PARSER_H
+
+#include <ctime>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/candle_series.h"
+#include "common/date.h"
+#include "common/market_data.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace kline_parser {
+
+typedef std::function<common::Date(time_t timestamp)> DateConverter;
+
+// Single-pass readers of the kline responses, decoding prices in place into the candles without
+// building a JSON document. Each returns false and leaves the candles empty when the response
+// is not a successful kline answer, so the caller can fall back to its JSON parser for the
+// error handling. The CandleSeries overloads append every field straight to its column.
+bool parseBinanceKlines(const std::string& response, const DateConverter& toDate,
+                        std::vector<common::MarketData>& candles);
+bool parseBinanceKlines(const std::string& response, const DateConverter& toDate,
+                        common::CandleSeries& candles);
+bool parseKrakenKlines(const std::string& response, const DateConverter& toDate,
+                       std::vector<common::MarketData>& candles);
+bool parseKrakenKlines(const std::string& response, const DateConverter& toDate,
+                       common::CandleSeries& candles);
+bool parsePoloniexKlines(const std::string& response, const DateConverter& toDate,
+                         std::vector<common::MarketData>& candles);
+bool parsePoloniexKlines(const std::string& response, const DateConverter& toDate,
+                         common::CandleSeries& candles);
+bool parseHuobiKlines(const std::string& response, const DateConverter& toDate,
+                      std::vector<common::MarketData>& candles);
+bool parseHuobiKlines(const std::string& response, const DateConverter& toDate,
+                      common::CandleSeries& candles);
+bool parseBittrexKlines(const std::string& response, std::vector<common::MarketData>& candles);
+bool parseBittrexKlines(const std::string& response, common::CandleSeries& candles);
+
+}  // namespace kline_parser
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_KLINE_PARSER_H
@@ -33,6 +33,7 @@
 #include "common/currency.h"
 #include "common/encryption_sha256_engine.h"
 #include "common/kraken_currency.h"
+#include "curl_handle_pool.h"
 #include "query.h"
 
 namespace auto_trader {
@@ -52,6 +53,7 @@ class KrakenQuery : public BaseQuery<Query> {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
   std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency) override;
   common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
@@ -61,24 +63,44 @@ class KrakenQuery : public BaseQuery<Query> {
   common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
                                             common::Currency::Enum toCurrency,
                                             common::TickInterval::Enum interval) override;
+  common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                 common::Currency::Enum toCurrency,
+                                                 common::TickInterval::Enum interval,
+                                                 const common::Date& openDate) override;
+  common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount) override;
 
   common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                        common::Currency::Enum toCurrency) override;
   double getBalance(common::Currency::Enum currency) override;
 
   CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
 
   virtual std::string sendRequest(CURL* curl);
+  // Performs prepared requests concurrently and returns their responses in the same order.
+  virtual std::vector<std::string> sendRequests(const std::vector<CURL*>& curls);
+
+ protected:
+  CurrencyBalances requestBalances() override;
+  CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) override;
 
  private:
   common::MarketHistoryPtr parseMarketHistory(const std::string& response) const;
+  common::MarketHistoryPtr requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                common::Currency::Enum toCurrency,
+                                                common::TickInterval::Enum interval,
+                                                const std::string& windowParameters);
   std::vector<common::MarketOrder> getAccountClosedOrders(common::Currency::Enum fromCurrency,
                                                           common::Currency::Enum toCurrency);
 
+  // Maps a result key of the Ticker response back to the pair name it was requested by.
+  static std::string getPairAltname(const std::string& pairName);
+
   std::vector<common::MarketOrder> parseOrderList(const Poco::JSON::Object::Ptr jsonMainObject,
-                                                  const std::string& ordersType,
-                                                  common::Currency::Enum fromCurrency,
-                                                  common::Currency::Enum toCurrency);
+                                                  const std::string& ordersType);
 
   void checkCurl(CURL* curl);
 
@@ -88,6 +110,8 @@ class KrakenQuery : public BaseQuery<Query> {
 
  private:
   common::KrakenCurrency krakenCurrency_;
+  CurlHandlePool curlHandles_;
+  CurlMultiExecutor curlExecutor_;
 };
 
 }  // namespace stock_exchange
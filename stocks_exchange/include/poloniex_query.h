@@ -51,6 +51,7 @@ class PoloniexQuery : public BaseQuery<Query> {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
   std::vector<common::MarketOrder> getMarketOpenOrders(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency) override;
   common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
@@ -60,17 +61,34 @@ class PoloniexQuery : public BaseQuery<Query> {
   common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
                                             common::Currency::Enum toCurrency,
                                             common::TickInterval::Enum interval) override;
+  common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                 common::Currency::Enum toCurrency,
+                                                 common::TickInterval::Enum interval,
+                                                 const common::Date& openDate) override;
+  common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  common::TickInterval::Enum interval,
+                                                  size_t candlesCount) override;
 
   common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                        common::Currency::Enum toCurrency) override;
   double getBalance(common::Currency::Enum currency) override;
 
   CurrencyLotsHolder getCurrencyLotsHolder() override;
+  size_t getParallelRequestsLimit() const override;
 
   virtual std::string sendRequest(CURL* curl);
 
+ protected:
+  CurrencyBalances requestBalances() override;
+  CurrencyTicks requestAllTicks(common::Currency::Enum baseCurrency) override;
+
  private:
   common::MarketHistoryPtr parseMarketHistory(const std::string& response) const;
+  common::MarketHistoryPtr requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                common::Currency::Enum toCurrency,
+                                                common::TickInterval::Enum interval,
+                                                time_t startTime);
 
   Poco::JSON::Object::Ptr getJsonObjectAndCheckOnIncorrectJson(const std::string& response,
                                                                curl_slist* chunk);
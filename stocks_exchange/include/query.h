@@ -30,6 +30,7 @@
 #include <Poco/Net/HTTPSClientSession.h>
 #include <Poco/URI.h>
 
+#include <memory>
 #include <unordered_set>
 
 #include "common/currency.h"
@@ -37,11 +38,15 @@
 #include "common/enumerations/tick_interval.h"
 #include "common/market_history.h"
 #include "common/market_order.h"
+#include "balances_snapshot.h"
 #include "currency_lots_holder.h"
+#include "ticks_snapshot.h"
 
 namespace auto_trader {
 namespace stock_exchange {
 
+class HttpsSessionPool;
+
 class Query {
  public:
   virtual ~Query() = default;
@@ -61,20 +66,63 @@ class Query {
   virtual common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
                                                     common::Currency::Enum toCurrency,
                                                     common::TickInterval::Enum interval) = 0;
+  // Candles opened at or after openDate, for topping up a cached window. An exchange without an
+  // incremental kline request answers with its default window, which includes them.
+  virtual common::MarketHistoryPtr getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                         common::Currency::Enum toCurrency,
+                                                         common::TickInterval::Enum interval,
+                                                         const common::Date& openDate) {
+    return getMarketHistory(fromCurrency, toCurrency, interval);
+  }
+  // At least the newest candlesCount candles. An exchange without a size or start parameter
+  // answers with its default window.
+  virtual common::MarketHistoryPtr getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                          common::Currency::Enum toCurrency,
+                                                          common::TickInterval::Enum interval,
+                                                          size_t candlesCount) {
+    return getMarketHistory(fromCurrency, toCurrency, interval);
+  }
 
   virtual std::vector<common::MarketOrder> getMarketOpenOrders(
       common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) = 0;
   virtual std::vector<common::MarketOrder> getAccountOpenOrders(
       common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) = 0;
+  // Open orders of every market of the account from a single request.
+  virtual std::vector<common::MarketOrder> getAllAccountOpenOrders() = 0;
   virtual common::MarketOrder getAccountOrder(common::Currency::Enum fromCurrency,
                                               common::Currency::Enum toCurrency,
                                               const std::string& uuid) = 0;
 
   virtual common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                                common::Currency::Enum toCurrency) = 0;
+  // Ticks of all markets of the base currency keyed by the traded currency.
+  virtual CurrencyTicks getAllTicks(common::Currency::Enum baseCurrency) = 0;
   virtual double getBalance(common::Currency::Enum currency) = 0;
+  // Balances of all account coins from a single request.
+  virtual CurrencyBalances getBalances() = 0;
+  // Forgets cached balances, e.g. after an order of the account was placed or filled.
+  virtual void invalidateBalances() {}
 
   virtual CurrencyLotsHolder getCurrencyLotsHolder() = 0;
+
+  // Requests a trading cycle may keep in flight at once without tripping the rate limit.
+  virtual size_t getParallelRequestsLimit() const { return 1; }
+
+  // Makes the query open its HTTPS connections from the given pool, shared by every exchange.
+  virtual void setSessionPool(const std::shared_ptr<HttpsSessionPool>& sessionPool) {}
+
+  // Reads the tick from the all-markets ticks of the base currency and requests the single pair
+  // only when the exchange does not list it there.
+  common::CurrencyTick getTickFromAllTicks(common::Currency::Enum baseCurrency,
+                                           common::Currency::Enum tradedCurrency) {
+    auto ticks = getAllTicks(baseCurrency);
+    auto it = ticks.find(tradedCurrency);
+    if (it != ticks.end()) {
+      return it->second;
+    }
+
+    return getCurrencyTick(baseCurrency, tradedCurrency);
+  }
 };
 
 typedef std::shared_ptr<Query> QueryPtr;
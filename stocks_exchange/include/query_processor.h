@@ -29,7 +29,9 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
+#include "https_session_pool.h"
 #include "query.h"
 
 namespace auto_trader {
@@ -44,9 +46,15 @@ class QueryProcessor {
   explicit QueryProcessor(const QueryFactory& query_factory);
   virtual QueryPtr getQuery(common::StockExchangeType type);
 
+  // Limits the HTTPS connections every query keeps open to one exchange host.
+  void setMaxConnectionsPerHost(size_t maxConnectionsPerHost);
+
  private:
+  std::mutex mutex_;
   std::map<common::StockExchangeType, QueryPtr> queries_;
   const QueryFactory& query_factory_;
+  // One pool, and so one SSL context, shared by the queries of all exchanges.
+  std::shared_ptr<HttpsSessionPool> sessionPool_;
 };
 
 }  // namespace stock_exchange
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_SERVER_CLOCK_H
+#define AUTO_TRADER_STOCK_EXCHANGE_SERVER_CLOCK_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+// One round trip to the exchange time endpoint: local send time, server time and local receive
+// time, all in milliseconds since epoch.
+struct ServerClockSample {
+  uint64_t requestTime_;
+  uint64_t serverTime_;
+  uint64_t responseTime_;
+};
+
+// Estimates the offset between the local clock and the exchange clock, so signed requests can be
+// stamped locally instead of asking the exchange for its time first. As in NTP, the server time
+// is assumed to be read in the middle of the round trip, and the sample with the shortest round
+// trip is trusted most. The offset expires after the resync period or on invalidate().
+class ServerClock {
+ public:
+  explicit ServerClock(uint64_t resyncPeriod);
+
+  bool isSyncRequired(uint64_t localTime) const;
+  // True once an offset is known and until invalidate(), even after the resync period.
+  bool isSynchronized() const;
+  void synchronize(const std::vector<ServerClockSample>& samples, uint64_t localTime);
+  void invalidate();
+
+  uint64_t getServerTime(uint64_t localTime) const;
+  int64_t getOffset() const;
+
+ private:
+  mutable std::mutex mutex_;
+  uint64_t resyncPeriod_;
+  int64_t offset_;
+  uint64_t syncTime_;
+  bool isSynchronized_;
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_SERVER_CLOCK_H
@@ -31,7 +31,9 @@
 #include <curl/curl.h>
 
 #include <QDateTime>
+#include <algorithm>
 #include <ctime>
+#include <map>
 
 #include "common/binance_currency.h"
 #include "common/bittrex_currency.h"
@@ -282,6 +284,39 @@ static std::pair<std::string, std::string> parseBinanceExchangeType(const std::s
   throw common::exceptions::UndefinedTypeException("Binance exchange pair");
 }
 
+static std::vector<common::MarketOrder> getMarketOrders(
+    const std::vector<common::MarketOrder>& orders, common::Currency::Enum fromCurrency,
+    common::Currency::Enum toCurrency) {
+  std::vector<common::MarketOrder> marketOrders;
+  for (const auto& order : orders) {
+    if (order.fromCurrency_ == fromCurrency && order.toCurrency_ == toCurrency) {
+      marketOrders.push_back(order);
+    }
+  }
+
+  return marketOrders;
+}
+
+// Maps the exchange symbol of every market of the base currency to its traded currency, so a
+// response listing all markets can be narrowed down to the ones the application trades.
+template <typename StockExchangeCurrency, typename PairFormatter>
+static std::map<std::string, common::Currency::Enum> getBaseCurrencyMarkets(
+    StockExchangeCurrency& stockExchangeCurrency, common::Currency::Enum baseCurrency,
+    PairFormatter formatPair) {
+  std::map<std::string, common::Currency::Enum> markets;
+  auto baseCurrencies = stockExchangeCurrency.getBaseCurrencies();
+  if (std::find(baseCurrencies.begin(), baseCurrencies.end(), baseCurrency) ==
+      baseCurrencies.end()) {
+    return markets;
+  }
+
+  for (auto tradedCurrency : stockExchangeCurrency.getTradedCurrencies(baseCurrency)) {
+    markets.emplace(formatPair(baseCurrency, tradedCurrency), tradedCurrency);
+  }
+
+  return markets;
+}
+
 static QDateTime unixtime2datetime(QString strUnixDate, bool isMilliseconds) {
   int denominator = isMilliseconds ? 1000 : 1;
   return QDateTime::fromTime_t(strUnixDate.toLongLong() / denominator);
@@ -306,6 +341,24 @@ static common::Date getDataFromTimestamp(time_t timestamp, bool isMilliseconds)
   return currentDate;
 }
 
+// Inverse of getDataFromTimestamp, which leaves candle dates in local time.
+static time_t getTimestampFromDate(const common::Date& date, bool isMilliseconds) {
+  QDateTime dt(QDate(date.year_, date.month_, date.day_),
+               QTime(date.hour_, date.minute_, date.second_));
+  return isMilliseconds ? dt.toMSecsSinceEpoch() : dt.toSecsSinceEpoch();
+}
+
+// Open time in seconds of the oldest of the newest candlesCount candles, or 0 when the interval
+// has no fixed length.
+static time_t getLatestCandlesStartTime(common::TickInterval::Enum interval, size_t candlesCount) {
+  auto intervalSeconds = common::TickInterval::toSeconds(interval);
+  if (intervalSeconds == 0) {
+    return 0;
+  }
+
+  return std::time(nullptr) - static_cast<time_t>(candlesCount) * intervalSeconds;
+}
+
 static std::pair<std::string, std::string> parseKrakenCyrrencyPair(const std::string& pair) {
   if (pair == "ADAUSD")
     return std::make_pair("USD", "ADA");
@@ -458,7 +511,7 @@ static common::Currency::Enum getKrakenCurrencyFromString(const std::string& cur
   if (currency == "GNO") return common::Currency::GNO;
   if (currency == "XLTC") return common::Currency::LTC;
   if (currency == "QTUM") return common::Currency::QTUM;
-  if (currency == "XREP ") return common::Currency::REP;
+  if (currency == "XREP") return common::Currency::REP;
   if (currency == "XXBT") return common::Currency::BTC;
   if (currency == "XXLM") return common::Currency::XLM;
   if (currency == "XXMR") return common::Currency::XMR;
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STOCK_EXCHANGE_TICKS_SNAPSHOT_H
+#define AUTO_TRADER_STOCK_EXCHANGE_TICKS_SNAPSHOT_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#include "common/currency.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+typedef std::map<common::Currency::Enum, common::CurrencyTick> CurrencyTicks;
+
+// Ticks of all markets of a base currency with the time they were received. The stats updater
+// and both strategy processors read the same snapshot, so one trading cycle costs one ticker
+// request per base currency instead of one per traded coin.
+class TicksSnapshot {
+ public:
+  explicit TicksSnapshot(uint64_t timeToLive);
+
+  bool get(common::Currency::Enum baseCurrency, uint64_t currentTime, CurrencyTicks& ticks) const;
+  void update(common::Currency::Enum baseCurrency, const CurrencyTicks& ticks,
+              uint64_t currentTime);
+  void invalidate();
+
+ private:
+  struct Entry {
+    CurrencyTicks ticks_;
+    uint64_t updateTime_;
+  };
+
+  mutable std::mutex mutex_;
+  uint64_t timeToLive_;
+  std::map<common::Currency::Enum, Entry> entries_;
+};
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STOCK_EXCHANGE_TICKS_SNAPSHOT_H
@@ -28,6 +28,7 @@
 #ifndef STOCKS_EXCHANGE_RESOURCES_H
 #define STOCKS_EXCHANGE_RESOURCES_H
 
+#include <cstdint>
 #include <string>
 
 namespace auto_trader {
@@ -53,6 +54,8 @@ const std::string BITTREX_CURRENCIES = "getcurrencies";
 const std::string BITTREX_SELL_LIMIT = "selllimit";
 const std::string BITTREX_BUY_LIMIT = "buylimit";
 const std::string BITTREX_TICKER = "getticker";
+const std::string BITTREX_MARKET_SUMMARIES = "getmarketsummaries";
+const std::string BITTREX_SUMMARY_MARKET_NAME = "MarketName";
 const std::string BITTREX_CANCEL = "cancel";
 const std::string BITTREX_MARET = "market";
 const std::string BITTREX_OPEN_ORDERS = "getopenorders";
@@ -83,6 +86,7 @@ const std::string BITTREX_OPEN_ORDERS_SELL_KEYWORD = "sell";
 const std::string BITTREX_IS_CANCEL_ORDER_KEYWORD = "CancelInitiated";
 
 const std::string BITTREX_HEADER_APISIGN = "apisign";
+const size_t BITTREX_PARALLEL_REQUESTS = 4;
 
 }  // namespace bittrex
 
@@ -99,9 +103,13 @@ const std::string BINANCE_ACCOUNT_INFO = "api/v3/account?";
 const std::string BINANCE_ALL_ORDERS = "api/v3/allOrders?";
 const std::string BINANCE_SERVER_TIME = "api/v1/time";
 const std::string BINANCE_CURRENTY_TICK = "api/v3/ticker/bookTicker?";
+const std::string BINANCE_ALL_TICKS = "api/v3/ticker/bookTicker";
 const std::string BINANCE_EXCHANGE_INFO = "api/v1/exchangeInfo";
 
 const std::string BINANCE_INTERVAL = "interval";
+const std::string BINANCE_START_TIME = "startTime";
+const std::string BINANCE_LIMIT = "limit";
+const size_t BINANCE_MAX_KLINES_LIMIT = 1000;
 const std::string BINANCE_SERVER_TIME_VALUE = "serverTime";
 const std::string BINANCE_SIDE = "side";
 const std::string BINANCE_BALANCE_ARRAY_BLOCK = "balances";
@@ -133,6 +141,9 @@ const std::string BINANCE_LOT_SIZE_MAX_QUANTITY_KEYWORD = "maxQty";
 const std::string BINANCE_LOT_SIZE_STEP_SIZE_KEYWORD = "stepSize";
 
 const int BINANCE_RECIEVE_WINDOW_VALUE = 50000;
+const int BINANCE_INVALID_TIMESTAMP_CODE = -1021;
+const int BINANCE_CLOCK_SYNC_SAMPLES_COUNT = 3;
+const uint64_t BINANCE_CLOCK_RESYNC_PERIOD_MS = 10 * 60 * 1000;
 const int BINANCE_TIMESTAMP_INDEX = 0;
 const int BINANCE_OPEN_PRICE_INDEX = 1;
 const int BINANCE_HIGH_PRICE_INDEX = 2;
@@ -141,6 +152,7 @@ const int BINANCE_CLOSE_PRICE_INDEX = 4;
 const int BINANCE_VOLUME_INDEX = 5;
 const int BINANCE_CLOSE_TIME_INDEX = 6;
 const int BINANCE_INSUFFICIENT_BALANCE_CODE = -2010;
+const size_t BINANCE_PARALLEL_REQUESTS = 4;
 
 }  // namespace binance
 
@@ -170,6 +182,7 @@ const std::string KRAKEN_TICKER_KEYWORD = "Ticker";
 const std::string KRAKEN_CURRENCY_PAIR_KEYWORD = "pair";
 const std::string KRAKEN_ORDER_STATUS_KEYWORD = "status";
 const std::string KRAKEN_INTERVAL_KEYWORD = "interval";
+const std::string KRAKEN_SINCE_KEYWORD = "since";
 const std::string KRAKEN_GET_OPENED_ORDERS_LIST_KEYWORD = "open";
 const std::string KRAKEN_GET_CLOSED_ORDERS_LIST_KEYWORD = "closed";
 const std::string KRAKEN_NONCE = "nonce";
@@ -191,6 +204,9 @@ const int KRAKEN_HIGH_PRICE_INDEX = 2;
 const int KRAKEN_LOW_PRICE_INDEX = 3;
 const int KRAKEN_CLOSE_PRICE_INDEX = 4;
 const int KRAKEN_VOLUME_INDEX = 6;
+const size_t KRAKEN_PARALLEL_REQUESTS = 1;
+const size_t KRAKEN_FULL_ASSET_NAME_LENGTH = 4;
+const std::string KRAKEN_FULL_ASSET_NAME_PREFIXES = "XZ";
 
 }  // namespace kraken
 
@@ -200,6 +216,8 @@ const std::string POLONIEX_PUBLIC_ENDPOINT = "https://poloniex.com/public";
 const std::string POLONIEX_PRIVATE_ENDPOINT = "https://poloniex.com/tradingApi";
 
 const std::string POLONIEX_RETURN_TICKER = "returnTicker";
+const std::string POLONIEX_LOWEST_ASK = "lowestAsk";
+const std::string POLONIEX_HIGHEST_BID = "highestBid";
 const std::string POLONIEX_CURRENCY_TICK_KEYWORD = "baseVolume";
 const std::string POLONIEX_CURRENCY_PAIR_KEYWORD = "currencyPair";
 const std::string POLONIEX_CHART_DATA_KEYWORD = "returnChartData";
@@ -236,6 +254,7 @@ const std::string POLONIEX_GLOBAL_TRADE_ID = "globalTradeID";
 const std::string POLONIEX_CLIENT_ORDER_ID = "clientOrderId";
 
 const int THREE_MONTH_IN_SECOND = 7776000;
+const size_t POLONIEX_PARALLEL_REQUESTS = 2;
 }  // namespace poloniex
 
 namespace huobi {
@@ -244,6 +263,7 @@ const std::string HUOBI_PUBLIC_URL = "https://api.huobi.pro/market";
 const std::string HUOBI_PRO_API_URL = "api.huobi.pro";
 const std::string HUOBI_HTTPS_API_URL = "https://api.huobi.pro";
 const std::string HUOBI_CURRENCY_TICK_KEYWORD = "depth";
+const std::string HUOBI_ALL_TICKS_KEYWORD = "tickers";
 const std::string HUOBI_ORDERS_REQUEST = "v1/order/orders";
 const std::string HUOBI_OPEN_ORDERS_REQUEST = "v1/order/openOrders";
 const std::string HUOBI_ACCOUNT_REQUEST = "v1/account/accounts";
@@ -269,6 +289,7 @@ const std::string HUOBI_POST = "POST";
 const std::string HUOBI_GET = "GET";
 const std::string HUOBI_AMOUNT_PRECISION = "amount-precision";
 const std::string HUOBI_PRICE_PRECISION = "price-precision";
+const uint64_t HUOBI_METADATA_REFRESH_PERIOD_MS = 60 * 60 * 1000;
 
 constexpr char HUOBI_CONTENT_TYPE[] = "Content-Type:application/json;charset=UTF-8";
 
@@ -281,6 +302,8 @@ const std::string HUOBI_STATUS_OK = "ok";
 const std::string HUOBI_ERROR_CODE_KEY = "err-code";
 
 const std::string HUOBI_CURRENCY_TICK_BLOCK = "tick";
+const std::string HUOBI_TICK_BID = "bid";
+const std::string HUOBI_TICK_ASK = "ask";
 const std::string HUOBI_ORDERS_DATA_KEYWORD = "data";
 const std::string HUOBI_TIMESTAMP_KEYWORD = "ts";
 const std::string HUOBI_ORDER_TIME_KEYWORD = "direction";
@@ -293,6 +316,8 @@ const std::string HUOBI_CANDLE_HIGH_PRICE = "high";
 const std::string HUOBI_CANDLE_VOLUME_PRICE = "vol";
 
 const short HUOBI_MARKET_OPENED_ORDERS = 50;
+const int64_t HUOBI_MAX_MARKET_HISTORY_SIZE = 2000;
+const size_t HUOBI_PARALLEL_REQUESTS = 4;
 }  // namespace huobi
 
 namespace words {
@@ -376,6 +401,14 @@ const std::string HUOBI_UNKNOWN_ORDER_STATE =
 const std::string HUOBI_INVALID_BALANCE =
     "Invalid response exception raised : account-frozen-balance-insufficient-error";
 
+const std::string HUOBI_STALE_METADATA = "Huobi metadata refresh failed, cached values are used:";
+const std::string CURL_MULTI_FAILED = "Curl multi request failed:";
+const std::string STALE_HTTPS_SESSION_RETRY = "Reused HTTPS session failed, retrying on a new one:";
+const std::string BINANCE_INVALID_TIMESTAMP_RETRY =
+    "Binance rejected the request timestamp, resyncing the clock and retrying.";
+const std::string BINANCE_CLOCK_SYNC_FAILED = "Binance clock resync failed:";
+const std::string HUOBI_UNKNOWN_ORDER_PAIR = "Huobi open order on an unknown pair skipped:";
+
 }  // namespace messages
 
 namespace numbers {
@@ -384,6 +417,11 @@ const int ONE = 1;
 const int FIRST_ARRAY_INDEX = 0;
 const int SECOND_ARRAY_INDEX = 1;
 const int MAX_MARKET_ORDERS_COUNT = 60;
+const size_t MAX_HTTPS_CONNECTIONS_PER_HOST = 4;
+const int HTTPS_SESSION_IDLE_TIMEOUT_SECONDS = 30;
+const int CURL_MULTI_WAIT_MS = 1000;
+const uint64_t BALANCES_SNAPSHOT_TIME_TO_LIVE_MS = 5000;
+const uint64_t TICKS_SNAPSHOT_TIME_TO_LIVE_MS = 2000;
 
 }  // namespace numbers
 
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/balances_snapshot.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+BalancesSnapshot::BalancesSnapshot(uint64_t timeToLive)
+    : timeToLive_(timeToLive), updateTime_(0), isValid_(false) {}
+
+bool BalancesSnapshot::get(uint64_t currentTime, CurrencyBalances& balances) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!isValid_ || currentTime < updateTime_ || currentTime - updateTime_ >= timeToLive_) {
+    return false;
+  }
+
+  balances = balances_;
+  return true;
+}
+
+void BalancesSnapshot::update(const CurrencyBalances& balances, uint64_t currentTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  balances_ = balances;
+  updateTime_ = currentTime;
+  isValid_ = true;
+}
+
+void BalancesSnapshot::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  isValid_ = false;
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -31,24 +31,41 @@
 #include <Poco/Path.h>
 #include <Poco/URI.h>
 
+#include <chrono>
 #include <typeinfo>
 
 #include "common/exceptions/stock_exchange_exception/invalid_stock_exchange_response_exception.h"
 #include "common/loggers/file_logger.h"
 #include "common/utils.h"
+#include "include/kline_parser.h"
 #include "include/stock_exchange_utils.h"
 #include "resources/resources.h"
 
 namespace auto_trader {
 namespace stock_exchange {
 
-static void checkBinanceResponseMessage(Poco::JSON::Object::Ptr& object) {
+BinanceQuery::~BinanceQuery() {
+  {
+    std::lock_guard<std::mutex> lock(clockThreadMutex_);
+    isStopped_ = true;
+  }
+  clockThreadStopped_.notify_all();
+
+  if (clockThread_.joinable()) {
+    clockThread_.join();
+  }
+}
+
+void BinanceQuery::checkBinanceResponseMessage(Poco::JSON::Object::Ptr& object) const {
   auto messageObject = object->get(resources::words::MESSAGE_SHORT);
   auto code = object->get(resources::words::CODE);
   if (code < 0) {
+    if (code == resources::binance::BINANCE_INVALID_TIMESTAMP_CODE) {
+      serverClock_.invalidate();
+    }
     const std::string message = messageObject.toString();
     common::loggers::FileLogger::getLogger()
-        << resources::messages::FAILED_TO_UPLOAD_MESSAGE << message;
+        << resources::messages::FAILED_TO_UPLOAD_MESSAGE + " " + message;
     throw common::exceptions::InvalidStockExchangeResponse(message);
   }
 }
@@ -58,7 +75,7 @@ common::MarketOrder BinanceQuery::sellOrder(common::Currency::Enum fromCurrency,
                                             double rate) {
   using namespace Poco;
 
-  std::string query =
+  std::string parameters =
       resources::words::SYMBOL + resources::symbols::EQUAL +
       binanceCurrency_.getBinancePair(fromCurrency, toCurrency) + resources::symbols::AND +
       resources::binance::BINANCE_SIDE + resources::symbols::EQUAL + resources::words::SELL_SIDE +
@@ -69,32 +86,10 @@ common::MarketOrder BinanceQuery::sellOrder(common::Currency::Enum fromCurrency,
       resources::words::PRICE + resources::symbols::EQUAL +
       common::MarketOrder::convertCoinToString(rate) + resources::symbols::AND +
       resources::binance::BINANCE_TIME_IN_FORCE + resources::symbols::EQUAL +
-      resources::binance::BINANCE_GTC + resources::symbols::AND + resources::words::TIMESTAMP +
-      resources::symbols::EQUAL + std::to_string(getCurrentServerTime()) + resources::symbols::AND +
-      resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
-      std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
+      resources::binance::BINANCE_GTC;
 
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
-  std::string request_str = resources::binance::BINANCE_URL + resources::binance::BINANCE_ORDER +
-                            query + resources::symbols::AND +
-                            resources::binance::BINANCE_SIGNATURE + resources::symbols::EQUAL +
-                            signature;
-
-  Poco::URI uri(request_str);
-  auto path = uri.getPathAndQuery();
-  path = path.empty() ? resources::symbols::SLASH : path;
-  Net::HTTPRequest request(Net::HTTPRequest::HTTP_POST, path, Net::HTTPMessage::HTTP_1_1);
-
-  ConnectionAttributes attributes;
-  attributes.host_ = uri.getHost();
-  attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
-
-  auto response = processHttpRequest(attributes, request, headers);
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_POST,
+                                       resources::binance::BINANCE_ORDER, parameters);
 
   JSON::Parser parser;
   JSON::Object::Ptr jsonMainObject = parser.parse(response).extract<JSON::Object::Ptr>();
@@ -121,7 +116,7 @@ common::MarketOrder BinanceQuery::buyOrder(common::Currency::Enum fromCurrency,
                                            double rate) {
   using namespace Poco;
 
-  std::string query =
+  std::string parameters =
       resources::words::SYMBOL + resources::symbols::EQUAL +
       binanceCurrency_.getBinancePair(fromCurrency, toCurrency) + resources::symbols::AND +
       resources::binance::BINANCE_SIDE + resources::symbols::EQUAL + resources::words::BUY_SIDE +
@@ -132,32 +127,10 @@ common::MarketOrder BinanceQuery::buyOrder(common::Currency::Enum fromCurrency,
       resources::words::PRICE + resources::symbols::EQUAL +
       common::MarketOrder::convertCoinToString(rate) + resources::symbols::AND +
       resources::binance::BINANCE_TIME_IN_FORCE + resources::symbols::EQUAL +
-      resources::binance::BINANCE_GTC + resources::symbols::AND + resources::words::TIMESTAMP +
-      resources::symbols::EQUAL + std::to_string(getCurrentServerTime()) + resources::symbols::AND +
-      resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
-      std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
+      resources::binance::BINANCE_GTC;
 
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
-  std::string request_str = resources::binance::BINANCE_URL + resources::binance::BINANCE_ORDER +
-                            query + resources::symbols::AND +
-                            resources::binance::BINANCE_SIGNATURE + resources::symbols::EQUAL +
-                            signature;
-
-  Poco::URI uri(request_str);
-  auto path = uri.getPathAndQuery();
-  path = path.empty() ? resources::symbols::SLASH : path;
-  Net::HTTPRequest request(Net::HTTPRequest::HTTP_POST, path, Net::HTTPMessage::HTTP_1_1);
-
-  ConnectionAttributes attributes;
-  attributes.host_ = uri.getHost();
-  attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
-
-  auto response = processHttpRequest(attributes, request, headers);
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_POST,
+                                       resources::binance::BINANCE_ORDER, parameters);
 
   JSON::Parser parser;
   JSON::Object::Ptr jsonMainObject = parser.parse(response).extract<JSON::Object::Ptr>();
@@ -183,36 +156,14 @@ bool BinanceQuery::cancelOrder(common::Currency::Enum fromCurrency,
                                common::Currency::Enum toCurrency, const std::string& uuid) {
   using namespace Poco;
 
-  std::string query = resources::words::SYMBOL + resources::symbols::EQUAL +
-                      binanceCurrency_.getBinancePair(fromCurrency, toCurrency) +
-                      resources::symbols::AND + resources::binance::BINANCE_ORIG_CLIENT_ORDER_ID +
-                      resources::symbols::EQUAL + uuid + resources::symbols::AND +
-                      resources::words::TIMESTAMP + resources::symbols::EQUAL +
-                      std::to_string(getCurrentServerTime()) + resources::symbols::AND +
-                      resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
-                      std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
-
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
-  std::string request_str = resources::binance::BINANCE_URL +
-                            resources::binance::BINANCE_CANCEL_ORDER + query +
-                            resources::symbols::AND + resources::binance::BINANCE_SIGNATURE +
-                            resources::symbols::EQUAL + signature;
-
-  Poco::URI uri(request_str);
-  auto path = uri.getPathAndQuery();
-  path = path.empty() ? resources::symbols::SLASH : path;
-  Net::HTTPRequest request(Net::HTTPRequest::HTTP_DELETE, path, Net::HTTPMessage::HTTP_1_1);
-
-  ConnectionAttributes attributes;
-  attributes.host_ = uri.getHost();
-  attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
+  std::string parameters = resources::words::SYMBOL + resources::symbols::EQUAL +
+                           binanceCurrency_.getBinancePair(fromCurrency, toCurrency) +
+                           resources::symbols::AND +
+                           resources::binance::BINANCE_ORIG_CLIENT_ORDER_ID +
+                           resources::symbols::EQUAL + uuid;
 
-  auto response = processHttpRequest(attributes, request, headers);
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_DELETE,
+                                       resources::binance::BINANCE_CANCEL_ORDER, parameters);
 
   JSON::Parser parser;
   JSON::Object::Ptr jsonMainObject = parser.parse(response).extract<JSON::Object::Ptr>();
@@ -226,6 +177,35 @@ bool BinanceQuery::cancelOrder(common::Currency::Enum fromCurrency,
 common::MarketHistoryPtr BinanceQuery::getMarketHistory(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency,
                                                         common::TickInterval::Enum interval) {
+  return requestMarketHistory(fromCurrency, toCurrency, interval, std::string());
+}
+
+common::MarketHistoryPtr BinanceQuery::getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                             common::Currency::Enum toCurrency,
+                                                             common::TickInterval::Enum interval,
+                                                             const common::Date& openDate) {
+  auto startTime = stock_exchange_utils::getTimestampFromDate(openDate, true);
+  std::string windowParameters = resources::symbols::AND + resources::binance::BINANCE_START_TIME +
+                                 resources::symbols::EQUAL + std::to_string(startTime);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr BinanceQuery::getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                              common::Currency::Enum toCurrency,
+                                                              common::TickInterval::Enum interval,
+                                                              size_t candlesCount) {
+  auto limit = std::min(candlesCount, resources::binance::BINANCE_MAX_KLINES_LIMIT);
+  std::string windowParameters = resources::symbols::AND + resources::binance::BINANCE_LIMIT +
+                                 resources::symbols::EQUAL + std::to_string(limit);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr BinanceQuery::requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                            common::Currency::Enum toCurrency,
+                                                            common::TickInterval::Enum interval,
+                                                            const std::string& windowParameters) {
   using namespace Poco;
 
   std::string request_str =
@@ -233,7 +213,8 @@ common::MarketHistoryPtr BinanceQuery::getMarketHistory(common::Currency::Enum f
       resources::words::SYMBOL + resources::symbols::EQUAL +
       binanceCurrency_.getBinancePair(fromCurrency, toCurrency) + resources::symbols::AND +
       resources::binance::BINANCE_INTERVAL + resources::symbols::EQUAL +
-      common::convertTickInterval(interval, common::StockExchangeType::Binance);
+      common::convertTickInterval(interval, common::StockExchangeType::Binance) +
+      windowParameters;
 
   Poco::URI uri(request_str);
   auto path = uri.getPathAndQuery();
@@ -303,36 +284,14 @@ common::MarketOrder BinanceQuery::getAccountOrder(common::Currency::Enum fromCur
                                                   const std::string& uuid) {
   using namespace Poco;
 
-  std::string query = resources::words::SYMBOL + resources::symbols::EQUAL +
-                      binanceCurrency_.getBinancePair(fromCurrency, toCurrency) +
-                      resources::symbols::AND + resources::binance::BINANCE_ORIG_CLIENT_ORDER_ID +
-                      resources::symbols::EQUAL + uuid + resources::symbols::AND +
-                      resources::words::TIMESTAMP + resources::symbols::EQUAL +
-                      std::to_string(getCurrentServerTime()) + resources::symbols::AND +
-                      resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
-                      std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
-
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
-  std::string request_str = resources::binance::BINANCE_URL + resources::binance::BINANCE_ORDER +
-                            query + resources::symbols::AND +
-                            resources::binance::BINANCE_SIGNATURE + resources::symbols::EQUAL +
-                            signature;
+  std::string parameters = resources::words::SYMBOL + resources::symbols::EQUAL +
+                           binanceCurrency_.getBinancePair(fromCurrency, toCurrency) +
+                           resources::symbols::AND +
+                           resources::binance::BINANCE_ORIG_CLIENT_ORDER_ID +
+                           resources::symbols::EQUAL + uuid;
 
-  Poco::URI uri(request_str);
-  auto path = uri.getPathAndQuery();
-  path = path.empty() ? resources::symbols::SLASH : path;
-  Net::HTTPRequest request(Net::HTTPRequest::HTTP_GET, path, Net::HTTPMessage::HTTP_1_1);
-
-  ConnectionAttributes attributes;
-  attributes.host_ = uri.getHost();
-  attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
-
-  auto response = processHttpRequest(attributes, request, headers);
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_GET,
+                                       resources::binance::BINANCE_ORDER, parameters);
 
   JSON::Parser parser;
   JSON::Object::Ptr jsonMainObject = parser.parse(response).extract<JSON::Object::Ptr>();
@@ -397,23 +356,20 @@ common::CurrencyTick BinanceQuery::getCurrencyTick(common::Currency::Enum fromCu
   return currencyTick;
 }
 
-std::vector<common::MarketOrder> BinanceQuery::getAccountOpenOrders(
-    common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+CurrencyTicks BinanceQuery::requestAllTicks(common::Currency::Enum baseCurrency) {
   using namespace Poco;
 
-  std::string query = resources::words::TIMESTAMP + resources::symbols::EQUAL +
-                      std::to_string(getCurrentServerTime()) + resources::symbols::AND +
-                      resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
-                      std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
-
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
+  CurrencyTicks ticks;
+  auto markets = stock_exchange_utils::getBaseCurrencyMarkets(
+      binanceCurrency_, baseCurrency,
+      [this](common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+        return binanceCurrency_.getBinancePair(fromCurrency, toCurrency);
+      });
+  if (markets.empty()) {
+    return ticks;
+  }
 
-  std::string request_str = resources::binance::BINANCE_URL +
-                            resources::binance::BINANCE_OPEN_ORDERS + query +
-                            resources::symbols::AND + resources::binance::BINANCE_SIGNATURE +
-                            resources::symbols::EQUAL + signature;
+  std::string request_str = resources::binance::BINANCE_URL + resources::binance::BINANCE_ALL_TICKS;
 
   Poco::URI uri(request_str);
   auto path = uri.getPathAndQuery();
@@ -423,11 +379,52 @@ std::vector<common::MarketOrder> BinanceQuery::getAccountOpenOrders(
   ConnectionAttributes attributes;
   attributes.host_ = uri.getHost();
   attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
+  std::vector<HTTP_HEADERS> headers;
 
   auto response = processHttpRequest(attributes, request, headers);
 
+  JSON::Parser parser;
+  JSON::Array::Ptr objects;
+  try {
+    objects = parser.parse(response).extract<JSON::Array::Ptr>();
+  } catch (const std::exception& ex) {
+    JSON::Object::Ptr object = parser.parse(response).extract<JSON::Object::Ptr>();
+    checkBinanceResponseMessage(object);
+    return ticks;
+  }
+
+  for (unsigned int index = 0; index < objects->size(); ++index) {
+    auto object = objects->getObject(index);
+    const std::string symbol = object->get(resources::words::SYMBOL);
+    auto marketIt = markets.find(symbol);
+    if (marketIt == markets.end()) {
+      continue;
+    }
+
+    common::CurrencyTick currencyTick;
+    currencyTick.bid_ = object->get(resources::binance::BINANCE_BID_PRICE_KEYWORD);
+    currencyTick.ask_ = object->get(resources::binance::BINANCE_ASK_PRICE_KEYWORD);
+    currencyTick.fromCurrency_ = baseCurrency;
+    currencyTick.toCurrency_ = marketIt->second;
+
+    ticks.emplace(marketIt->second, currencyTick);
+  }
+
+  return ticks;
+}
+
+std::vector<common::MarketOrder> BinanceQuery::getAccountOpenOrders(
+    common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return stock_exchange_utils::getMarketOrders(getAllAccountOpenOrders(), fromCurrency,
+                                               toCurrency);
+}
+
+std::vector<common::MarketOrder> BinanceQuery::getAllAccountOpenOrders() {
+  using namespace Poco;
+
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_GET,
+                                       resources::binance::BINANCE_OPEN_ORDERS, std::string());
+
   JSON::Parser parser;
   JSON::Array::Ptr objects;
   try {
@@ -450,10 +447,6 @@ std::vector<common::MarketOrder> BinanceQuery::getAccountOpenOrders(
     currentOrder.fromCurrency_ = common::Currency::fromString(pairType.first);
     currentOrder.toCurrency_ = common::Currency::fromString(pairType.second);
 
-    if (currentOrder.fromCurrency_ != fromCurrency || currentOrder.toCurrency_ != toCurrency) {
-      continue;
-    }
-
     currentOrder.price_ = object->get(resources::words::PRICE);
     currentOrder.uuid_ =
         object->get(resources::binance::BINANCE_CLIENT_ORDER_ID).convert<std::string>();
@@ -470,52 +463,35 @@ std::vector<common::MarketOrder> BinanceQuery::getAccountOpenOrders(
 }
 
 double BinanceQuery::getBalance(common::Currency::Enum currency) {
-  using namespace Poco;
-
-  std::string query = resources::words::TIMESTAMP + resources::symbols::EQUAL +
-                      std::to_string(getCurrentServerTime());
-
-  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
-  hmac.update(query);
-  std::string signature = DigestEngine::digestToHex(hmac.digest());
-
-  std::string request_str = resources::binance::BINANCE_URL +
-                            resources::binance::BINANCE_ACCOUNT_INFO + query +
-                            resources::symbols::AND + resources::binance::BINANCE_SIGNATURE +
-                            resources::symbols::EQUAL + signature;
-
-  Poco::URI uri(request_str);
-  auto path = uri.getPathAndQuery();
-  path = path.empty() ? resources::symbols::SLASH : path;
-  Net::HTTPRequest request(Net::HTTPRequest::HTTP_GET, path, Net::HTTPMessage::HTTP_1_1);
+  auto balances = getBalances();
+  auto balanceIt = balances.find(currency);
+  return balanceIt != balances.end() ? balanceIt->second : 0.0;
+}
 
-  ConnectionAttributes attributes;
-  attributes.host_ = uri.getHost();
-  attributes.port_ = uri.getPort();
-  std::vector<HTTP_HEADERS> headers{
-      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
+CurrencyBalances BinanceQuery::requestBalances() {
+  using namespace Poco;
 
-  auto response = processHttpRequest(attributes, request, headers);
+  auto response = processSignedRequest(Net::HTTPRequest::HTTP_GET,
+                                       resources::binance::BINANCE_ACCOUNT_INFO, std::string());
 
   JSON::Parser parser;
   JSON::Object::Ptr object = parser.parse(response).extract<JSON::Object::Ptr>();
   checkBinanceResponseMessage(object);
 
-  double balance = 0.0;
+  CurrencyBalances balances;
   auto balancesInfoArray = object->getArray(resources::binance::BINANCE_BALANCE_ARRAY_BLOCK);
   for (int i = 0; i < balancesInfoArray->size(); ++i) {
     auto currencyInfoObject = balancesInfoArray->getObject(i);
     std::string currencyName = currencyInfoObject->get(resources::words::BALANCE_ASSET).toString();
-    if (currencyName == common::Currency::toString(currency)) {
+    auto currency = common::Currency::fromString(currencyName);
+    if (currency != common::Currency::UNKNOWN) {
       std::string free =
           currencyInfoObject->get(resources::binance::BINANCE_CURRENCY_FREE).toString();
-      balance = std::stod(free);
-
-      break;
+      balances.emplace(currency, std::stod(free));
     }
   }
 
-  return balance;
+  return balances;
 }
 
 CurrencyLotsHolder BinanceQuery::getCurrencyLotsHolder() {
@@ -571,6 +547,10 @@ CurrencyLotsHolder BinanceQuery::getCurrencyLotsHolder() {
   return lotsSizes;
 }
 
+size_t BinanceQuery::getParallelRequestsLimit() const {
+  return resources::binance::BINANCE_PARALLEL_REQUESTS;
+}
+
 uint64_t BinanceQuery::getCurrentServerTime() {
   using namespace Poco;
 
@@ -596,9 +576,122 @@ uint64_t BinanceQuery::getCurrentServerTime() {
   return serverTime;
 }
 
+uint64_t BinanceQuery::getSignatureTimestamp() {
+  // Only the first signed request waits for the clock. The clock thread then keeps the offset
+  // fresh, so later requests are stamped without a round trip.
+  if (!serverClock_.isSynchronized()) {
+    synchronizeServerClock();
+  }
+
+  std::call_once(clockThreadFlag_,
+                 [this]() { clockThread_ = std::thread(&BinanceQuery::runClockThread, this); });
+  return serverClock_.getServerTime(common::getCurrentMSEpoch());
+}
+
+void BinanceQuery::runClockThread() {
+  const std::chrono::milliseconds resyncPeriod(resources::binance::BINANCE_CLOCK_RESYNC_PERIOD_MS);
+  std::unique_lock<std::mutex> lock(clockThreadMutex_);
+  while (!clockThreadStopped_.wait_for(lock, resyncPeriod, [this]() { return isStopped_; })) {
+    lock.unlock();
+    try {
+      synchronizeServerClock();
+    } catch (const std::exception& exception) {
+      common::loggers::FileLogger::getLogger()
+          << resources::messages::BINANCE_CLOCK_SYNC_FAILED + " " + exception.what();
+    }
+    lock.lock();
+  }
+}
+
+std::string BinanceQuery::processSignedRequest(const std::string& method,
+                                               const std::string& endpoint,
+                                               const std::string& parameters) {
+  auto response = sendSignedRequest(method, endpoint, parameters);
+  if (!isInvalidTimestampResponse(response)) {
+    return response;
+  }
+
+  // Binance rejects a timestamp outside recvWindow before the request reaches the matching
+  // engine, so signing it again is safe for orders as well.
+  common::loggers::FileLogger::getLogger() << resources::messages::BINANCE_INVALID_TIMESTAMP_RETRY;
+  synchronizeServerClock();
+  return sendSignedRequest(method, endpoint, parameters);
+}
+
+std::string BinanceQuery::sendSignedRequest(const std::string& method,
+                                            const std::string& endpoint,
+                                            const std::string& parameters) {
+  using namespace Poco;
+
+  std::string query = parameters.empty() ? parameters : parameters + resources::symbols::AND;
+  query += resources::words::TIMESTAMP + resources::symbols::EQUAL +
+           std::to_string(getSignatureTimestamp()) + resources::symbols::AND +
+           resources::binance::BINANCE_RECIEVE_WINDOW + resources::symbols::EQUAL +
+           std::to_string(resources::binance::BINANCE_RECIEVE_WINDOW_VALUE);
+
+  Poco::HMACEngine<common::EncryptionSHA256Engine> hmac{secret_key_};
+  hmac.update(query);
+  std::string signature = DigestEngine::digestToHex(hmac.digest());
+
+  std::string request_str = resources::binance::BINANCE_URL + endpoint + query +
+                            resources::symbols::AND + resources::binance::BINANCE_SIGNATURE +
+                            resources::symbols::EQUAL + signature;
+
+  Poco::URI uri(request_str);
+  auto path = uri.getPathAndQuery();
+  path = path.empty() ? resources::symbols::SLASH : path;
+  Net::HTTPRequest request(method, path, Net::HTTPMessage::HTTP_1_1);
+
+  ConnectionAttributes attributes;
+  attributes.host_ = uri.getHost();
+  attributes.port_ = uri.getPort();
+  std::vector<HTTP_HEADERS> headers{
+      std::make_pair(resources::binance::BINANCE_X_MBX_APIKEY, api_key_)};
+
+  return processHttpRequest(attributes, request, headers);
+}
+
+bool BinanceQuery::isInvalidTimestampResponse(const std::string& response) const {
+  const int invalidTimestampCode = resources::binance::BINANCE_INVALID_TIMESTAMP_CODE;
+  if (response.find(std::to_string(invalidTimestampCode)) == std::string::npos) {
+    return false;
+  }
+
+  try {
+    Poco::JSON::Parser parser;
+    auto object = parser.parse(response).extract<Poco::JSON::Object::Ptr>();
+    return object->has(resources::words::CODE) &&
+           object->getValue<int>(resources::words::CODE) == invalidTimestampCode;
+  } catch (const Poco::Exception&) {
+    return false;
+  }
+}
+
+void BinanceQuery::synchronizeServerClock() {
+  std::vector<ServerClockSample> samples;
+  samples.reserve(resources::binance::BINANCE_CLOCK_SYNC_SAMPLES_COUNT);
+  for (int index = 0; index < resources::binance::BINANCE_CLOCK_SYNC_SAMPLES_COUNT; ++index) {
+    ServerClockSample sample;
+    sample.requestTime_ = common::getCurrentMSEpoch();
+    sample.serverTime_ = getCurrentServerTime();
+    sample.responseTime_ = common::getCurrentMSEpoch();
+    samples.push_back(sample);
+  }
+
+  serverClock_.synchronize(samples, common::getCurrentMSEpoch());
+}
+
 common::MarketHistoryPtr BinanceQuery::parseMarketHistory(const std::string& response) const {
   using namespace Poco;
 
+  auto candles = std::make_unique<common::MarketHistory>();
+  auto toDate = [](time_t timestamp) {
+    return stock_exchange_utils::getDataFromTimestamp(timestamp, true);
+  };
+  if (kline_parser::parseBinanceKlines(response, toDate, candles->marketData_)) {
+    return candles;
+  }
+
   JSON::Parser parser;
   JSON::Array::Ptr objects;
 
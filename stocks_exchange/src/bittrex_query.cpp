@@ -39,6 +39,8 @@
 #include "common/exceptions/stock_exchange_exception/redirect_http_exception.h"
 #include "common/loggers/file_logger.h"
 #include "common/utils.h"
+#include "include/kline_parser.h"
+#include "include/stock_exchange_utils.h"
 #include "resources/resources.h"
 
 namespace auto_trader {
@@ -202,6 +204,11 @@ common::MarketOrder BittrexQuery::buyOrder(common::Currency::Enum fromCurrency,
 common::MarketHistoryPtr BittrexQuery::parseMarketHistory(const std::string& response) const {
   using namespace Poco;
 
+  auto candles = std::make_unique<common::MarketHistory>();
+  if (kline_parser::parseBittrexKlines(response, candles->marketData_)) {
+    return candles;
+  }
+
   JSON::Parser parser;
   JSON::Object::Ptr ret = parser.parse(response).extract<JSON::Object::Ptr>();
   checkBittrexResponseMessage(ret);
@@ -314,8 +321,68 @@ common::CurrencyTick BittrexQuery::getCurrencyTick(common::Currency::Enum fromCu
   return currencyTick;
 }
 
+CurrencyTicks BittrexQuery::requestAllTicks(common::Currency::Enum baseCurrency) {
+  using namespace Poco;
+
+  CurrencyTicks ticks;
+  auto markets = stock_exchange_utils::getBaseCurrencyMarkets(
+      bittrexCurrency_, baseCurrency,
+      [this](common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+        return bittrexCurrency_.getBittrexPair(fromCurrency, toCurrency);
+      });
+  if (markets.empty()) {
+    return ticks;
+  }
+
+  std::string request_str = resources::bittrex::BITTREX_URL +
+                            resources::bittrex::BITTREX_PUBLIC_URL_API +
+                            resources::bittrex::BITTREX_MARKET_SUMMARIES;
+
+  Poco::URI uri(request_str);
+  auto path = uri.getPathAndQuery();
+  path = path.empty() ? resources::symbols::SLASH : path;
+  Net::HTTPRequest request(Net::HTTPRequest::HTTP_GET, path, Net::HTTPMessage::HTTP_1_1);
+
+  ConnectionAttributes attributes;
+  attributes.host_ = uri.getHost();
+  attributes.port_ = uri.getPort();
+  std::vector<HTTP_HEADERS> headers;
+
+  auto response = processHttpRequest(attributes, request, headers);
+
+  JSON::Parser parser;
+  JSON::Object::Ptr ret = parser.parse(response).extract<JSON::Object::Ptr>();
+  checkBittrexResponseMessage(ret);
+
+  JSON::Array::Ptr result = ret->getArray(resources::words::RESULT);
+  for (unsigned int index = 0; index < result->size(); ++index) {
+    auto summary = result->getObject(index);
+    const std::string marketName =
+        summary->get(resources::bittrex::BITTREX_SUMMARY_MARKET_NAME).toString();
+    auto marketIt = markets.find(marketName);
+    if (marketIt == markets.end()) {
+      continue;
+    }
+
+    common::CurrencyTick currencyTick;
+    currencyTick.ask_ = summary->get(resources::bittrex::BITTREX_ASK_TICK);
+    currencyTick.bid_ = summary->get(resources::bittrex::BITTREX_BID_TICK);
+    currencyTick.fromCurrency_ = baseCurrency;
+    currencyTick.toCurrency_ = marketIt->second;
+
+    ticks.emplace(marketIt->second, currencyTick);
+  }
+
+  return ticks;
+}
+
 std::vector<common::MarketOrder> BittrexQuery::getAccountOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return stock_exchange_utils::getMarketOrders(getAllAccountOpenOrders(), fromCurrency,
+                                               toCurrency);
+}
+
+std::vector<common::MarketOrder> BittrexQuery::getAllAccountOpenOrders() {
   using namespace Poco;
 
   auto nonce = std::to_string(common::getCurrentMSEpoch());
@@ -361,10 +428,6 @@ std::vector<common::MarketOrder> BittrexQuery::getAccountOpenOrders(
     currentOrder.fromCurrency_ = common::Currency::fromString(bittrexExchange.first);
     currentOrder.toCurrency_ = common::Currency::fromString(bittrexExchange.second);
 
-    if (currentOrder.fromCurrency_ != fromCurrency || currentOrder.toCurrency_ != toCurrency) {
-      continue;
-    }
-
     currentOrder.uuid_ = object->get(resources::bittrex::BITTREX_ORDER_UUID).toString();
     currentOrder.price_ = object->get(resources::bittrex::BITTREX_PRICE_KEYWORD);
     currentOrder.quantity_ = object->get(resources::bittrex::BITTREX_QUANTITY_KEYWORD);
@@ -538,6 +601,12 @@ common::MarketOrder BittrexQuery::getAccountOrder(common::Currency::Enum fromCur
 }
 
 double BittrexQuery::getBalance(common::Currency::Enum currency) {
+  auto balances = getBalances();
+  auto balanceIt = balances.find(currency);
+  return balanceIt != balances.end() ? balanceIt->second : 0.0;
+}
+
+CurrencyBalances BittrexQuery::requestBalances() {
   using namespace Poco;
 
   auto nonce = std::to_string(common::getCurrentMSEpoch());
@@ -571,22 +640,21 @@ double BittrexQuery::getBalance(common::Currency::Enum currency) {
   JSON::Parser parser;
   JSON::Object::Ptr ret = parser.parse(response).extract<JSON::Object::Ptr>();
 
-  double balance = 0.0;
+  CurrencyBalances balances;
   auto resultInfoArray = ret->getArray(resources::words::RESULT);
   for (int i = 0; i < resultInfoArray->size(); ++i) {
     auto currencyInfoObject = resultInfoArray->getObject(i);
     std::string currencyName =
         currencyInfoObject->get(resources::bittrex::BITTREX_BALANCE_CURRENCY).toString();
-    if (currencyName == common::Currency::toString(currency)) {
+    auto currency = common::Currency::fromString(currencyName);
+    if (currency != common::Currency::UNKNOWN) {
       std::string balance_str =
           currencyInfoObject->get(resources::bittrex::BITTREX_BALANCE_VALUE).toString();
-      balance = std::stod(balance_str);
-
-      break;
+      balances.emplace(currency, std::stod(balance_str));
     }
   }
 
-  return balance;
+  return balances;
 }
 
 CurrencyLotsHolder BittrexQuery::getCurrencyLotsHolder() {
@@ -594,5 +662,9 @@ CurrencyLotsHolder BittrexQuery::getCurrencyLotsHolder() {
   return lotsSizes;
 }
 
+size_t BittrexQuery::getParallelRequestsLimit() const {
+  return resources::bittrex::BITTREX_PARALLEL_REQUESTS;
+}
+
 }  // namespace stock_exchange
 }  // namespace auto_trader
\ No newline at end of file
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/caching_query.h"
+
+#include <algorithm>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+constexpr size_t CachingQuery::DEFAULT_WINDOW;
+
+CachingQuery::CachingQuery(QueryPtr query) : query_(std::move(query)) {}
+
+common::MarketOrder CachingQuery::sellOrder(common::Currency::Enum fromCurrency,
+                                            common::Currency::Enum toCurrency, double quantity,
+                                            double rate) {
+  return query_->sellOrder(fromCurrency, toCurrency, quantity, rate);
+}
+
+common::MarketOrder CachingQuery::buyOrder(common::Currency::Enum fromCurrency,
+                                           common::Currency::Enum toCurrency, double quantity,
+                                           double rate) {
+  return query_->buyOrder(fromCurrency, toCurrency, quantity, rate);
+}
+
+bool CachingQuery::cancelOrder(common::Currency::Enum fromCurrency,
+                               common::Currency::Enum toCurrency, const std::string& uuid) {
+  return query_->cancelOrder(fromCurrency, toCurrency, uuid);
+}
+
+void CachingQuery::updateApiKey(const std::string& api_key) { query_->updateApiKey(api_key); }
+
+void CachingQuery::updateSecretKey(const std::string& secret_key) {
+  query_->updateSecretKey(secret_key);
+}
+
+common::MarketHistoryPtr CachingQuery::getMarketHistory(common::Currency::Enum fromCurrency,
+                                                        common::Currency::Enum toCurrency,
+                                                        common::TickInterval::Enum interval) {
+  return getCachedMarketHistory(fromCurrency, toCurrency, interval, DEFAULT_WINDOW);
+}
+
+common::MarketHistoryPtr CachingQuery::getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                             common::Currency::Enum toCurrency,
+                                                             common::TickInterval::Enum interval,
+                                                             const common::Date& openDate) {
+  return query_->getMarketHistorySince(fromCurrency, toCurrency, interval, openDate);
+}
+
+common::MarketHistoryPtr CachingQuery::getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                              common::Currency::Enum toCurrency,
+                                                              common::TickInterval::Enum interval,
+                                                              size_t candlesCount) {
+  return getCachedMarketHistory(fromCurrency, toCurrency, interval, candlesCount);
+}
+
+std::vector<common::MarketOrder> CachingQuery::getMarketOpenOrders(
+    common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return query_->getMarketOpenOrders(fromCurrency, toCurrency);
+}
+
+std::vector<common::MarketOrder> CachingQuery::getAccountOpenOrders(
+    common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return query_->getAccountOpenOrders(fromCurrency, toCurrency);
+}
+
+std::vector<common::MarketOrder> CachingQuery::getAllAccountOpenOrders() {
+  return query_->getAllAccountOpenOrders();
+}
+
+common::MarketOrder CachingQuery::getAccountOrder(common::Currency::Enum fromCurrency,
+                                                  common::Currency::Enum toCurrency,
+                                                  const std::string& uuid) {
+  return query_->getAccountOrder(fromCurrency, toCurrency, uuid);
+}
+
+common::CurrencyTick CachingQuery::getCurrencyTick(common::Currency::Enum fromCurrency,
+                                                   common::Currency::Enum toCurrency) {
+  return query_->getCurrencyTick(fromCurrency, toCurrency);
+}
+
+CurrencyTicks CachingQuery::getAllTicks(common::Currency::Enum baseCurrency) {
+  return query_->getAllTicks(baseCurrency);
+}
+
+double CachingQuery::getBalance(common::Currency::Enum currency) {
+  return query_->getBalance(currency);
+}
+
+CurrencyBalances CachingQuery::getBalances() { return query_->getBalances(); }
+
+void CachingQuery::invalidateBalances() { query_->invalidateBalances(); }
+
+CurrencyLotsHolder CachingQuery::getCurrencyLotsHolder() { return query_->getCurrencyLotsHolder(); }
+
+size_t CachingQuery::getParallelRequestsLimit() const { return query_->getParallelRequestsLimit(); }
+
+void CachingQuery::setSessionPool(const std::shared_ptr<HttpsSessionPool>& sessionPool) {
+  query_->setSessionPool(sessionPool);
+}
+
+std::shared_ptr<CachingQuery::CachedCandles> CachingQuery::getCachedCandles(const MarketKey& key) {
+  std::lock_guard<std::mutex> lock(cacheMutex_);
+  auto& cachedCandles = cache_[key];
+  if (!cachedCandles) {
+    cachedCandles = std::make_shared<CachedCandles>();
+  }
+
+  return cachedCandles;
+}
+
+common::MarketHistoryPtr CachingQuery::getCachedMarketHistory(common::Currency::Enum fromCurrency,
+                                                              common::Currency::Enum toCurrency,
+                                                              common::TickInterval::Enum interval,
+                                                              size_t candlesCount) {
+  auto cachedCandles = getCachedCandles(MarketKey(fromCurrency, toCurrency, interval));
+  std::lock_guard<std::mutex> lock(cachedCandles->mutex_);
+  auto& candles = cachedCandles->candles_;
+
+  // A window downloaded for fewer candles than asked for now has to be downloaded again.
+  bool isMerged = false;
+  if (!candles.empty() && candlesCount <= cachedCandles->candlesCount_) {
+    auto newCandles = query_->getMarketHistorySince(fromCurrency, toCurrency, interval,
+                                                    candles.getLastOpenDate());
+    isMerged = candles.merge(newCandles->marketData_);
+  }
+
+  if (!isMerged) {
+    auto windowCount = std::max(candlesCount, cachedCandles->candlesCount_);
+    auto marketHistory =
+        windowCount == DEFAULT_WINDOW
+            ? query_->getMarketHistory(fromCurrency, toCurrency, interval)
+            : query_->getLatestMarketHistory(fromCurrency, toCurrency, interval, windowCount);
+    candles.reset(marketHistory->marketData_);
+    cachedCandles->candlesCount_ = windowCount;
+  }
+
+  auto marketHistory = std::make_unique<common::MarketHistory>();
+  marketHistory->toSell_ = fromCurrency;
+  marketHistory->toBuy_ = toCurrency;
+  marketHistory->marketData_ = candles.getCandles();
+  if (candlesCount < marketHistory->marketData_.size()) {
+    auto& marketData = marketHistory->marketData_;
+    marketData.erase(marketData.begin(), marketData.end() - candlesCount);
+  }
+
+  return marketHistory;
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
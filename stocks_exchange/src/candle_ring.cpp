@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/candle_ring.h"
+
+#include <algorithm>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+static std::vector<common::MarketData> sortByOpenTime(
+    const std::vector<common::MarketData>& candles) {
+  std::vector<common::MarketData> sortedCandles(candles);
+  std::stable_sort(sortedCandles.begin(), sortedCandles.end(),
+                   [](const common::MarketData& left, const common::MarketData& right) {
+                     return common::Date::toEpochMilliseconds(left.date_) <
+                            common::Date::toEpochMilliseconds(right.date_);
+                   });
+  return sortedCandles;
+}
+
+void CandleRing::reset(const std::vector<common::MarketData>& candles) {
+  auto sortedCandles = sortByOpenTime(candles);
+  candles_.assign(sortedCandles.begin(), sortedCandles.end());
+  capacity_ = candles_.size();
+}
+
+bool CandleRing::merge(const std::vector<common::MarketData>& candles) {
+  if (candles.empty()) {
+    return true;
+  }
+
+  if (candles_.empty()) {
+    reset(candles);
+    return true;
+  }
+
+  auto sortedCandles = sortByOpenTime(candles);
+  auto lastOpenTime = common::Date::toEpochMilliseconds(candles_.back().date_);
+  if (common::Date::toEpochMilliseconds(sortedCandles.front().date_) > lastOpenTime) {
+    return false;
+  }
+
+  for (const auto& candle : sortedCandles) {
+    auto openTime = common::Date::toEpochMilliseconds(candle.date_);
+    if (openTime == lastOpenTime) {
+      candles_.back() = candle;
+    } else if (openTime > lastOpenTime) {
+      candles_.push_back(candle);
+      lastOpenTime = openTime;
+    }
+  }
+
+  while (candles_.size() > capacity_) {
+    candles_.pop_front();
+  }
+
+  return true;
+}
+
+std::vector<common::MarketData> CandleRing::getCandles() const {
+  return std::vector<common::MarketData>(candles_.begin(), candles_.end());
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
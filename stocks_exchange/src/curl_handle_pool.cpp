@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/curl_handle_pool.h"
+
+#include "common/exceptions/base_exception.h"
+#include "common/loggers/file_logger.h"
+#include "resources/resources.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+static size_t appendCurlResponse(char* ptr, size_t size, size_t nmemb, void* userdata) {
+  std::string* response = reinterpret_cast<std::string*>(userdata);
+  size_t real_size = size * nmemb;
+
+  response->append(ptr, real_size);
+  return real_size;
+}
+
+CurlHandlePool::Handle::Handle(CurlHandlePool& pool, CURL* curl) : pool_(&pool), curl_(curl) {}
+
+CurlHandlePool::Handle::Handle(Handle&& handle) noexcept
+    : pool_(handle.pool_), curl_(handle.curl_) {
+  handle.curl_ = nullptr;
+}
+
+CurlHandlePool::Handle::~Handle() {
+  if (curl_) {
+    pool_->release(curl_);
+  }
+}
+
+CurlHandlePool::CurlHandlePool() {
+  curl_global_init(CURL_GLOBAL_DEFAULT);
+
+  share_ = curl_share_init();
+  if (share_) {
+    curl_share_setopt(share_, CURLSHOPT_LOCKFUNC, &CurlHandlePool::lockShare);
+    curl_share_setopt(share_, CURLSHOPT_UNLOCKFUNC, &CurlHandlePool::unlockShare);
+    curl_share_setopt(share_, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    curl_share_setopt(share_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+  }
+}
+
+CurlHandlePool::~CurlHandlePool() {
+  for (auto curl : idleHandles_) {
+    curl_easy_cleanup(curl);
+  }
+  if (share_) {
+    curl_share_cleanup(share_);
+  }
+
+  curl_global_cleanup();
+}
+
+CurlHandlePool::Handle CurlHandlePool::acquire() {
+  CURL* curl = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idleHandles_.empty()) {
+      curl = idleHandles_.back();
+      idleHandles_.pop_back();
+    }
+  }
+
+  if (!curl) {
+    curl = curl_easy_init();
+  }
+  if (curl && share_) {
+    curl_easy_setopt(curl, CURLOPT_SHARE, share_);
+  }
+
+  return Handle(*this, curl);
+}
+
+size_t CurlHandlePool::getIdleCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idleHandles_.size();
+}
+
+void CurlHandlePool::release(CURL* curl) {
+  // The reset drops the options of the previous request, while the handle keeps its connections.
+  curl_easy_reset(curl);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  idleHandles_.push_back(curl);
+}
+
+void CurlHandlePool::lockShare(CURL*, curl_lock_data data, curl_lock_access, void* pool) {
+  static_cast<CurlHandlePool*>(pool)->shareMutexes_[data].lock();
+}
+
+void CurlHandlePool::unlockShare(CURL*, curl_lock_data data, void* pool) {
+  static_cast<CurlHandlePool*>(pool)->shareMutexes_[data].unlock();
+}
+
+CurlMultiExecutor::CurlMultiExecutor() : multi_(curl_multi_init()) {}
+
+CurlMultiExecutor::~CurlMultiExecutor() {
+  if (multi_) {
+    curl_multi_cleanup(multi_);
+  }
+}
+
+std::vector<std::string> CurlMultiExecutor::perform(const std::vector<CURL*>& curls) {
+  if (!multi_) {
+    throw common::exceptions::BaseException("Can't create curl multi handle");
+  }
+
+  std::vector<std::string> responses(curls.size());
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  for (size_t index = 0; index < curls.size(); ++index) {
+    curl_easy_setopt(curls[index], CURLOPT_WRITEFUNCTION, appendCurlResponse);
+    curl_easy_setopt(curls[index], CURLOPT_WRITEDATA, static_cast<void*>(&responses[index]));
+    curl_easy_setopt(curls[index], CURLOPT_PRIVATE, reinterpret_cast<void*>(index));
+    curl_multi_add_handle(multi_, curls[index]);
+  }
+
+  int runningCount = 0;
+  do {
+    CURLMcode code = curl_multi_perform(multi_, &runningCount);
+    if (code == CURLM_OK && runningCount > 0) {
+      code = curl_multi_wait(multi_, nullptr, 0, resources::numbers::CURL_MULTI_WAIT_MS, nullptr);
+    }
+    if (code != CURLM_OK) {
+      common::loggers::FileLogger::getLogger()
+          << resources::messages::CURL_MULTI_FAILED + " " + curl_multi_strerror(code);
+      break;
+    }
+  } while (runningCount > 0);
+
+  std::vector<bool> isSucceeded(curls.size(), false);
+  int messagesCount = 0;
+  while (CURLMsg* message = curl_multi_info_read(multi_, &messagesCount)) {
+    if (message->msg != CURLMSG_DONE) {
+      continue;
+    }
+    void* index = nullptr;
+    curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &index);
+    if (message->data.result == CURLE_OK) {
+      isSucceeded[reinterpret_cast<size_t>(index)] = true;
+    } else {
+      common::loggers::FileLogger::getLogger()
+          << resources::messages::CURL_MULTI_FAILED + " " +
+                 curl_easy_strerror(message->data.result);
+    }
+  }
+
+  for (size_t index = 0; index < curls.size(); ++index) {
+    curl_multi_remove_handle(multi_, curls[index]);
+    if (!isSucceeded[index]) {
+      responses[index].clear();
+    }
+  }
+
+  return responses;
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/https_session_pool.h"
+
+#include <Poco/Exception.h>
+#include <Poco/Net/Socket.h>
+#include <Poco/Timespan.h>
+
+#include <algorithm>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+HttpsSessionPool::Lease::Lease(HttpsSessionPool& pool, const std::string& hostKey,
+                               std::unique_ptr<Poco::Net::HTTPSClientSession> session,
+                               bool isReused)
+    : pool_(&pool), hostKey_(hostKey), session_(std::move(session)), isReused_(isReused) {}
+
+HttpsSessionPool::Lease::Lease(Lease&& lease) noexcept
+    : pool_(lease.pool_),
+      hostKey_(std::move(lease.hostKey_)),
+      session_(std::move(lease.session_)),
+      isReused_(lease.isReused_) {
+  lease.pool_ = nullptr;
+}
+
+HttpsSessionPool::Lease::~Lease() {
+  if (pool_ && session_) {
+    pool_->release(hostKey_, std::move(session_), false);
+  }
+}
+
+void HttpsSessionPool::Lease::release() {
+  if (pool_ && session_) {
+    pool_->release(hostKey_, std::move(session_), true);
+  }
+  pool_ = nullptr;
+}
+
+HttpsSessionPool::HttpsSessionPool() : HttpsSessionPool(Settings()) {}
+
+HttpsSessionPool::HttpsSessionPool(const Settings& settings)
+    : settings_(settings),
+      context_(new Poco::Net::Context(
+          Poco::Net::Context::CLIENT_USE, resources::symbols::EMPTY_STR,
+          resources::symbols::EMPTY_STR, resources::symbols::EMPTY_STR,
+          Poco::Net::Context::VerificationMode::VERIFY_NONE)) {
+  context_->enableSessionCache(true);
+}
+
+void HttpsSessionPool::configure(const Settings& settings) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  settings_ = settings;
+  settings_.maxConnectionsPerHost_ = std::max<size_t>(settings_.maxConnectionsPerHost_, 1);
+  sessionReleased_.notify_all();
+}
+
+HttpsSessionPool::Lease HttpsSessionPool::acquire(const std::string& host, unsigned short port) {
+  const std::string hostKey = createHostKey(host, port);
+  std::vector<SessionPtr> evicted;
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto& hostSessions = hosts_[hostKey];
+
+  while (true) {
+    evictExpiredSessions(hostSessions, evicted);
+    while (!hostSessions.idleSessions_.empty()) {
+      SessionPtr session = std::move(hostSessions.idleSessions_.back().session_);
+      hostSessions.idleSessions_.pop_back();
+      if (isHealthy(*session)) {
+        lock.unlock();
+        evicted.clear();
+        return Lease(*this, hostKey, std::move(session), true);
+      }
+      --hostSessions.openedCount_;
+      evicted.push_back(std::move(session));
+    }
+    if (hostSessions.openedCount_ < settings_.maxConnectionsPerHost_) {
+      break;
+    }
+    sessionReleased_.wait(lock);
+  }
+
+  ++hostSessions.openedCount_;
+  Poco::Net::Session::Ptr tlsSession = hostSessions.tlsSession_;
+  const auto keepAliveTimeout = settings_.idleTimeout_;
+  lock.unlock();
+  evicted.clear();
+
+  SessionPtr session;
+  try {
+    session.reset(new Poco::Net::HTTPSClientSession(host, port, context_, tlsSession));
+  } catch (...) {
+    release(hostKey, nullptr, false);
+    throw;
+  }
+  session->setKeepAlive(true);
+  session->setKeepAliveTimeout(Poco::Timespan(keepAliveTimeout.count(), 0));
+  return Lease(*this, hostKey, std::move(session), false);
+}
+
+void HttpsSessionPool::dropIdleSessions(const std::string& host, unsigned short port) {
+  std::vector<SessionPtr> dropped;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto hostIt = hosts_.find(createHostKey(host, port));
+    if (hostIt == hosts_.end()) {
+      return;
+    }
+    auto& hostSessions = hostIt->second;
+    for (auto& idleSession : hostSessions.idleSessions_) {
+      dropped.push_back(std::move(idleSession.session_));
+    }
+    hostSessions.openedCount_ -= hostSessions.idleSessions_.size();
+    hostSessions.idleSessions_.clear();
+    hostSessions.tlsSession_ = nullptr;
+  }
+  sessionReleased_.notify_all();
+}
+
+void HttpsSessionPool::release(const std::string& hostKey, SessionPtr session, bool isReusable) {
+  Poco::Net::Session::Ptr tlsSession;
+  if (session && isReusable) {
+    tlsSession = session->sslSession();
+  }
+
+  std::vector<SessionPtr> evicted;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& hostSessions = hosts_[hostKey];
+    if (tlsSession) {
+      hostSessions.tlsSession_ = tlsSession;
+    }
+    if (session && isReusable) {
+      hostSessions.idleSessions_.push_back({std::move(session), Clock::now()});
+    } else {
+      --hostSessions.openedCount_;
+      evicted.push_back(std::move(session));
+    }
+    evictExpiredSessions(hostSessions, evicted);
+  }
+  sessionReleased_.notify_one();
+}
+
+void HttpsSessionPool::evictExpiredSessions(HostSessions& hostSessions,
+                                            std::vector<SessionPtr>& evicted) {
+  const auto expirationTime = Clock::now() - settings_.idleTimeout_;
+  auto& idleSessions = hostSessions.idleSessions_;
+  auto expiredEnd =
+      std::partition(idleSessions.begin(), idleSessions.end(),
+                     [&](const IdleSession& idle) { return idle.lastUsedTime_ <= expirationTime; });
+  for (auto it = idleSessions.begin(); it != expiredEnd; ++it) {
+    evicted.push_back(std::move(it->session_));
+  }
+  hostSessions.openedCount_ -= std::distance(idleSessions.begin(), expiredEnd);
+  idleSessions.erase(idleSessions.begin(), expiredEnd);
+}
+
+bool HttpsSessionPool::isHealthy(Poco::Net::HTTPSClientSession& session) {
+  if (!session.connected()) {
+    return true;
+  }
+  try {
+    // An idle keep-alive socket has nothing to read; readability means the peer closed it.
+    return !session.socket().poll(Poco::Timespan(0),
+                                  Poco::Net::Socket::SELECT_READ | Poco::Net::Socket::SELECT_ERROR);
+  } catch (const Poco::Exception&) {
+    return false;
+  }
+}
+
+std::string HttpsSessionPool::createHostKey(const std::string& host, unsigned short port) {
+  return host + resources::symbols::COLON + std::to_string(port);
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
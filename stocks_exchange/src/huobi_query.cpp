@@ -35,11 +35,14 @@
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 
+#include <stdexcept>
+
 #include "common/encryption_sha256_engine.h"
 #include "common/exceptions/stock_exchange_exception/invalid_stock_exchange_response_exception.h"
 #include "common/huobi_currency.h"
 #include "common/loggers/file_logger.h"
 #include "common/utils.h"
+#include "include/kline_parser.h"
 #include "include/stock_exchange_utils.h"
 #include "resources/resources.h"
 
@@ -57,7 +60,7 @@ static void verifyHuobiResponse(Poco::JSON::Object::Ptr &object, curl_slist *chu
   if (status != resources::huobi::HUOBI_STATUS_OK) {
     const std::string message = object->get(resources::huobi::HUOBI_ERROR_CODE_KEY).toString();
     common::loggers::FileLogger::getLogger()
-        << resources::messages::FAILED_TO_UPLOAD_MESSAGE << message;
+        << resources::messages::FAILED_TO_UPLOAD_MESSAGE + " " + message;
 
     throw common::exceptions::InvalidStockExchangeResponse(message);
   }
@@ -81,7 +84,8 @@ static std::string encodeToSignature(const std::string &secretKey, const std::st
 common::MarketOrder HuobiQuery::sellOrder(common::Currency::Enum fromCurrency,
                                           common::Currency::Enum toCurrency, double quantity,
                                           double rate) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -170,7 +174,8 @@ common::MarketOrder HuobiQuery::sellOrder(common::Currency::Enum fromCurrency,
 common::MarketOrder HuobiQuery::buyOrder(common::Currency::Enum fromCurrency,
                                          common::Currency::Enum toCurrency, double quantity,
                                          double rate) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -258,7 +263,8 @@ common::MarketOrder HuobiQuery::buyOrder(common::Currency::Enum fromCurrency,
 
 bool HuobiQuery::cancelOrder(common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency,
                              const std::string &uuid) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -344,7 +350,8 @@ common::MarketHistoryPtr HuobiQuery::parseMarketHistory(
 
 common::CurrencyTick HuobiQuery::getCurrencyTick(common::Currency::Enum fromCurrency,
                                                  common::Currency::Enum toCurrency) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   common::HuobiCurrency huobiCurrency;
@@ -389,9 +396,68 @@ common::CurrencyTick HuobiQuery::getCurrencyTick(common::Currency::Enum fromCurr
   return currencyTick;
 }
 
+CurrencyTicks HuobiQuery::requestAllTicks(common::Currency::Enum baseCurrency) {
+  CurrencyTicks ticks;
+  common::HuobiCurrency huobiCurrency;
+  auto markets = stock_exchange_utils::getBaseCurrencyMarkets(
+      huobiCurrency, baseCurrency,
+      [&huobiCurrency](common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+        std::string currencyPair = huobiCurrency.getHuobiPair(fromCurrency, toCurrency);
+        std::transform(currencyPair.begin(), currencyPair.end(), currencyPair.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        return currencyPair;
+      });
+  if (markets.empty()) {
+    return ticks;
+  }
+
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
+  stock_exchange_utils::checkCurlPointer(curl);
+
+  std::string uri = resources::huobi::HUOBI_PUBLIC_URL + resources::symbols::SLASH +
+                    resources::huobi::HUOBI_ALL_TICKS_KEYWORD;
+  curl_easy_setopt(curl, CURLOPT_URL, uri.data());
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, nullptr);
+
+  std::string response = sendRequest(curl);
+
+  Poco::JSON::Parser parser;
+  Poco::JSON::Object::Ptr jsonMainObject =
+      parser.parse(response).extract<Poco::JSON::Object::Ptr>();
+
+  verifyHuobiResponse(jsonMainObject, nullptr);
+
+  auto dataArray = jsonMainObject->getArray(resources::huobi::HUOBI_ORDERS_DATA_KEYWORD);
+  for (unsigned int index = 0; index < dataArray->size(); ++index) {
+    auto tickObject = dataArray->getObject(index);
+    const std::string symbol = tickObject->get(resources::words::SYMBOL).toString();
+    auto marketIt = markets.find(symbol);
+    if (marketIt == markets.end()) {
+      continue;
+    }
+
+    common::CurrencyTick currencyTick;
+    currencyTick.fromCurrency_ = baseCurrency;
+    currencyTick.toCurrency_ = marketIt->second;
+    currencyTick.bid_ = tickObject->get(resources::huobi::HUOBI_TICK_BID);
+    currencyTick.ask_ = tickObject->get(resources::huobi::HUOBI_TICK_ASK);
+
+    ticks.emplace(marketIt->second, currencyTick);
+  }
+
+  return ticks;
+}
+
 std::vector<common::MarketOrder> HuobiQuery::getAccountOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
-  CURL *curl = curl_easy_init();
+  return stock_exchange_utils::getMarketOrders(getAllAccountOpenOrders(), fromCurrency,
+                                               toCurrency);
+}
+
+std::vector<common::MarketOrder> HuobiQuery::getAllAccountOpenOrders() {
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -400,11 +466,6 @@ std::vector<common::MarketOrder> HuobiQuery::getAccountOpenOrders(
   sprintf(timeBuf, timeBufferRegexp, local->tm_year + 1900, local->tm_mon + 1, local->tm_mday,
           local->tm_hour, local->tm_min, local->tm_sec);
 
-  common::HuobiCurrency huobiCurrency;
-  std::string currencyPair = huobiCurrency.getHuobiPair(fromCurrency, toCurrency);
-  std::transform(currencyPair.begin(), currencyPair.end(), currencyPair.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
-
   std::string additional_data_to_params =
       resources::huobi::HUOBI_GET + resources::symbols::NEW_LINE_SYMBOL +
       resources::huobi::HUOBI_PRO_API_URL + resources::symbols::NEW_LINE_SYMBOL +
@@ -418,8 +479,7 @@ std::vector<common::MarketOrder> HuobiQuery::getAccountOpenOrders(
                       resources::symbols::AND + resources::huobi::HUOBI_TIMESTAMP +
                       resources::symbols::EQUAL + timeBuf + resources::symbols::AND +
                       resources::huobi::HOUBI_ACCOUNT_ID + resources::symbols::EQUAL +
-                      account_identifier + resources::symbols::AND + resources::words::SYMBOL +
-                      resources::symbols::EQUAL + currencyPair;
+                      account_identifier;
 
   auto all_str = additional_data_to_params + param;
   std::string uriEncodedParams = encodeToSignature(secret_key_, all_str);
@@ -447,24 +507,38 @@ std::vector<common::MarketOrder> HuobiQuery::getAccountOpenOrders(
   auto jsonOrdersDataArray = jsonMainObject->getArray(resources::huobi::HUOBI_ORDERS_DATA_KEYWORD);
   auto arraySize = jsonOrdersDataArray->size();
 
+  common::HuobiCurrency huobiCurrency;
   std::vector<common::MarketOrder> openOrders;
   for (size_t index = 0; index < arraySize; ++index) {
     auto orderJsonObject = jsonOrdersDataArray->getObject(index);
 
     common::MarketOrder orderInfo;
 
+    // The account may hold orders on pairs the trader does not know, e.g. ones placed by hand.
+    // They are left out instead of failing the whole list.
+    const std::string symbol = orderJsonObject->get(resources::words::SYMBOL);
+    try {
+      auto currencyPair = huobiCurrency.parseHuobiExchangeType(symbol);
+      orderInfo.fromCurrency_ = common::Currency::fromString(currencyPair.first);
+      orderInfo.toCurrency_ = common::Currency::fromString(currencyPair.second);
+    } catch (const std::invalid_argument&) {
+      orderInfo.fromCurrency_ = common::Currency::UNKNOWN;
+    }
+
+    if (orderInfo.fromCurrency_ == common::Currency::UNKNOWN ||
+        orderInfo.toCurrency_ == common::Currency::UNKNOWN) {
+      common::loggers::FileLogger::getLogger()
+          << resources::messages::HUOBI_UNKNOWN_ORDER_PAIR << symbol;
+      continue;
+    }
+
     orderInfo.quantity_ = orderJsonObject->get(resources::words::AMOUNT);
     orderInfo.price_ = orderJsonObject->get(resources::words::PRICE);
 
-    const std::string symbol = orderJsonObject->get(resources::words::SYMBOL);
-    auto currencyPair = huobiCurrency.parseHuobiExchangeType(symbol);
-    orderInfo.fromCurrency_ = common::Currency::fromString(currencyPair.first);
-    orderInfo.toCurrency_ = common::Currency::fromString(currencyPair.second);
-
     auto timestamp = orderJsonObject->get(resources::huobi::HUOBI_TIMESTAMP_KEYWORD);
     orderInfo.opened_ = stock_exchange_utils::getDataFromTimestamp(timestamp, true);
 
-    const std::string type = jsonMainObject->get(resources::words::TYPE);
+    const std::string type = orderJsonObject->get(resources::words::TYPE);
     if (type == resources::huobi::HUOBI_BUY_LIMIT) {
       orderInfo.orderType_ = common::OrderType::BUY;
     } else {
@@ -483,7 +557,46 @@ std::vector<common::MarketOrder> HuobiQuery::getAccountOpenOrders(
 common::MarketHistoryPtr HuobiQuery::getMarketHistory(common::Currency::Enum fromCurrency,
                                                       common::Currency::Enum toCurrency,
                                                       common::TickInterval::Enum interval) {
-  CURL *curl = curl_easy_init();
+  return requestMarketHistory(fromCurrency, toCurrency, interval, std::string());
+}
+
+common::MarketHistoryPtr HuobiQuery::getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                           common::Currency::Enum toCurrency,
+                                                           common::TickInterval::Enum interval,
+                                                           const common::Date& openDate) {
+  // Huobi klines have no start time, only the count of the newest candles.
+  auto intervalSeconds = common::TickInterval::toSeconds(interval);
+  if (intervalSeconds == 0) {
+    return getMarketHistory(fromCurrency, toCurrency, interval);
+  }
+
+  auto openTime = stock_exchange_utils::getTimestampFromDate(openDate, false);
+  auto elapsedSeconds = std::max<int64_t>(0, std::time(nullptr) - openTime);
+  auto size = std::min<int64_t>(elapsedSeconds / intervalSeconds + 1,
+                                resources::huobi::HUOBI_MAX_MARKET_HISTORY_SIZE);
+  std::string windowParameters = resources::symbols::AND + resources::words::SIZE +
+                                 resources::symbols::EQUAL + std::to_string(size);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr HuobiQuery::getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                            common::Currency::Enum toCurrency,
+                                                            common::TickInterval::Enum interval,
+                                                            size_t candlesCount) {
+  auto size = std::min<int64_t>(candlesCount, resources::huobi::HUOBI_MAX_MARKET_HISTORY_SIZE);
+  std::string windowParameters = resources::symbols::AND + resources::words::SIZE +
+                                 resources::symbols::EQUAL + std::to_string(size);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr HuobiQuery::requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                          common::Currency::Enum toCurrency,
+                                                          common::TickInterval::Enum interval,
+                                                          const std::string &windowParameters) {
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   common::HuobiCurrency huobiCurrency;
@@ -498,7 +611,8 @@ common::MarketHistoryPtr HuobiQuery::getMarketHistory(common::Currency::Enum fro
                            resources::symbols::AND +
                            resources::huobi::HUOBI_MERKET_HISTORY_PERIOD_KEYWORD +
                            resources::symbols::EQUAL +
-                           common::convertTickInterval(interval, common::StockExchangeType::Huobi);
+                           common::convertTickInterval(interval, common::StockExchangeType::Huobi) +
+                           windowParameters;
 
   auto fullUrlWithParameters = uri + resources::symbols::QUESTION + parameters;
   curl_easy_setopt(curl, CURLOPT_URL, fullUrlWithParameters.data());
@@ -506,13 +620,19 @@ common::MarketHistoryPtr HuobiQuery::getMarketHistory(common::Currency::Enum fro
 
   std::string response = sendRequest(curl);
 
-  Poco::JSON::Parser parser;
-  Poco::JSON::Object::Ptr jsonMainObject =
-      parser.parse(response).extract<Poco::JSON::Object::Ptr>();
+  auto marketHistoryData = std::make_unique<common::MarketHistory>();
+  auto toDate = [](time_t timestamp) {
+    return stock_exchange_utils::getDataFromTimestamp(timestamp, false);
+  };
+  if (!kline_parser::parseHuobiKlines(response, toDate, marketHistoryData->marketData_)) {
+    Poco::JSON::Parser parser;
+    Poco::JSON::Object::Ptr jsonMainObject =
+        parser.parse(response).extract<Poco::JSON::Object::Ptr>();
 
-  verifyHuobiResponse(jsonMainObject, nullptr);
+    verifyHuobiResponse(jsonMainObject, nullptr);
 
-  auto marketHistoryData = parseMarketHistory(jsonMainObject);
+    marketHistoryData = parseMarketHistory(jsonMainObject);
+  }
   marketHistoryData->toSell_ = fromCurrency;
   marketHistoryData->toBuy_ = toCurrency;
 
@@ -528,7 +648,8 @@ bool replace(std::string &str, const std::string &from, const std::string &to) {
 
 std::vector<common::MarketOrder> HuobiQuery::getMarketOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   common::HuobiCurrency huobiCurrency;
@@ -605,7 +726,8 @@ std::vector<common::MarketOrder> HuobiQuery::getMarketOpenOrders(
 common::MarketOrder HuobiQuery::getAccountOrder(common::Currency::Enum fromCurrency,
                                                 common::Currency::Enum toCurrency,
                                                 const std::string &uuid) {
-  CURL *curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -682,7 +804,22 @@ common::MarketOrder HuobiQuery::getAccountOrder(common::Currency::Enum fromCurre
 }
 
 double HuobiQuery::getBalance(common::Currency::Enum currency) {
-  CURL *curl = curl_easy_init();
+  auto balances = getBalances();
+  auto balanceIt = balances.find(currency);
+  if (balanceIt == balances.end()) {
+    std::string currencyStr = common::Currency::toString(currency);
+    std::transform(currencyStr.begin(), currencyStr.end(), currencyStr.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    throw common::exceptions::InvalidStockExchangeResponse(
+        "The currency " + currencyStr + " has not been found on Huobi stock exchange");
+  }
+
+  return balanceIt->second;
+}
+
+CurrencyBalances HuobiQuery::requestBalances() {
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -724,10 +861,7 @@ double HuobiQuery::getBalance(common::Currency::Enum currency) {
   curl_easy_setopt(curl, CURLOPT_TIMEOUT, 20);
 
   std::string response = sendRequest(curl);
-  std::string currencyStr = common::Currency::toString(currency);
-
-  std::transform(currencyStr.begin(), currencyStr.end(), currencyStr.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
+  curl_slist_free_all(plist);
 
   Poco::JSON::Parser parser;
   Poco::JSON::Object::Ptr jsonMainObject =
@@ -739,22 +873,56 @@ double HuobiQuery::getBalance(common::Currency::Enum currency) {
   auto arrayJsonObject = dataJsonArray->getArray(resources::huobi::HUOBI_LIST_KEYWORD);
   auto arraySize = arrayJsonObject->size();
 
+  CurrencyBalances balances;
   for (int index = 0; index < arraySize; ++index) {
     auto listElementObject = arrayJsonObject->getObject(index);
     std::string currentCurrency = listElementObject->get(resources::huobi::HUOBI_CURRENCY_KEYWORD);
     std::string balance = listElementObject->get(resources::huobi::HUOBI_GET_BALANCE_SECOND_PART);
 
-    if (currentCurrency == currencyStr) {
-      return std::stod(balance);
+    std::transform(currentCurrency.begin(), currentCurrency.end(), currentCurrency.begin(),
+                   [](unsigned char c) { return std::toupper(c); });
+    auto currency = common::Currency::fromString(currentCurrency);
+    if (currency != common::Currency::UNKNOWN) {
+      balances.emplace(currency, std::stod(balance));
     }
   }
 
-  throw common::exceptions::InvalidStockExchangeResponse(
-      "The currency " + currencyStr + " has not been found on Huobi stock exchange");
+  return balances;
+}
+
+void HuobiQuery::updateApiKey(const std::string &api_key) {
+  BaseQuery<Query>::updateApiKey(api_key);
+  resetAccountMetadata();
+}
+
+void HuobiQuery::updateSecretKey(const std::string &secret_key) {
+  BaseQuery<Query>::updateSecretKey(secret_key);
+  resetAccountMetadata();
+}
+
+void HuobiQuery::resetAccountMetadata() {
+  std::lock_guard<std::mutex> lock(metadataMutex_);
+  accountIdentifier_.clear();
 }
 
 std::string HuobiQuery::getAccountIdentifier() const {
-  CURL *curl = curl_easy_init();
+  {
+    std::lock_guard<std::mutex> lock(metadataMutex_);
+    if (!accountIdentifier_.empty()) {
+      return accountIdentifier_;
+    }
+  }
+
+  std::string account_identifier = requestAccountIdentifier();
+
+  std::lock_guard<std::mutex> lock(metadataMutex_);
+  accountIdentifier_ = account_identifier;
+  return account_identifier;
+}
+
+std::string HuobiQuery::requestAccountIdentifier() const {
+  auto curlHandle = curlHandles_.acquire();
+  CURL *curl = curlHandle.get();
   stock_exchange_utils::checkCurlPointer(curl);
 
   time_t t = time(NULL);
@@ -794,7 +962,6 @@ std::string HuobiQuery::getAccountIdentifier() const {
 
   std::string response = sendRequest(curl);
   curl_slist_free_all(chunk);
-  curl_easy_cleanup(curl);
 
   Poco::JSON::Parser parser;
   Poco::JSON::Object::Ptr jsonMainObject =
@@ -842,13 +1009,65 @@ std::string HuobiQuery::sendRequest(CURL *curl) const {
   return response;
 }
 
+std::vector<std::string> HuobiQuery::sendRequests(const std::vector<CURL *> &curls) const {
+  return curlExecutor_.perform(curls);
+}
+
 CurrencyLotsHolder HuobiQuery::getCurrencyLotsHolder() {
   CurrencyLotsHolder lotsSizes;
   return lotsSizes;
 }
 
+size_t HuobiQuery::getParallelRequestsLimit() const {
+  return resources::huobi::HUOBI_PARALLEL_REQUESTS;
+}
+
 HuobiPrecision HuobiQuery::getHuobiPrecision(common::Currency::Enum fromCurrency,
                                              common::Currency::Enum toCurrency) {
+  common::HuobiCurrency huobiCurrency;
+  std::string currencyPair = huobiCurrency.getHuobiPair(fromCurrency, toCurrency);
+  std::transform(currencyPair.begin(), currencyPair.end(), currencyPair.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+
+  const uint64_t currentTime = common::getCurrentMSEpoch();
+  {
+    std::lock_guard<std::mutex> lock(metadataMutex_);
+    auto precisionIt = symbolsPrecision_.find(currencyPair);
+    const bool isExpired = currentTime - symbolsPrecisionLoadTime_ >=
+                           resources::huobi::HUOBI_METADATA_REFRESH_PERIOD_MS;
+    if (precisionIt != symbolsPrecision_.end() && !isExpired) {
+      return precisionIt->second;
+    }
+  }
+
+  std::map<std::string, HuobiPrecision> symbolsPrecision;
+  try {
+    symbolsPrecision = requestSymbolsPrecision();
+  } catch (const std::exception &exception) {
+    std::lock_guard<std::mutex> lock(metadataMutex_);
+    auto precisionIt = symbolsPrecision_.find(currencyPair);
+    if (precisionIt == symbolsPrecision_.end()) {
+      throw;
+    }
+    common::loggers::FileLogger::getLogger()
+        << resources::messages::HUOBI_STALE_METADATA << exception.what();
+    return precisionIt->second;
+  }
+
+  std::lock_guard<std::mutex> lock(metadataMutex_);
+  symbolsPrecision_ = std::move(symbolsPrecision);
+  symbolsPrecisionLoadTime_ = currentTime;
+
+  auto precisionIt = symbolsPrecision_.find(currencyPair);
+  if (precisionIt == symbolsPrecision_.end()) {
+    throw common::exceptions::InvalidStockExchangeResponse(
+        "The currency " + currencyPair + " has not been found on Huobi stock exchange");
+  }
+
+  return precisionIt->second;
+}
+
+std::map<std::string, HuobiPrecision> HuobiQuery::requestSymbolsPrecision() {
   const std::string request_str = resources::huobi::HUOBI_HTTPS_API_URL +
                                   resources::symbols::SLASH +
                                   resources::huobi::HUOBI_COMMON_SYMBOLS;
@@ -872,29 +1091,21 @@ HuobiPrecision HuobiQuery::getHuobiPrecision(common::Currency::Enum fromCurrency
 
   verifyHuobiResponse(jsonMainObject, nullptr);
 
-  common::HuobiCurrency huobiCurrency;
-  std::string currencyPair = huobiCurrency.getHuobiPair(fromCurrency, toCurrency);
-  std::transform(currencyPair.begin(), currencyPair.end(), currencyPair.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
-
+  std::map<std::string, HuobiPrecision> symbolsPrecision;
   auto jsonOrdersDataArray = jsonMainObject->getArray(resources::huobi::HUOBI_ORDERS_DATA_KEYWORD);
   auto arraySize = jsonOrdersDataArray->size();
   for (size_t index = 0; index < arraySize; ++index) {
     auto orderJsonObject = jsonOrdersDataArray->getObject(index);
 
     const std::string symbol = orderJsonObject->get(resources::words::SYMBOL);
-    if (symbol == currencyPair) {
-      HuobiPrecision huobiPrecision{0, 0};
-      huobiPrecision.amountPrecision_ =
-          orderJsonObject->get(resources::huobi::HUOBI_AMOUNT_PRECISION);
-      huobiPrecision.pricePrecision_ =
-          orderJsonObject->get(resources::huobi::HUOBI_PRICE_PRECISION);
-      return huobiPrecision;
-    }
+    HuobiPrecision huobiPrecision{0, 0};
+    huobiPrecision.amountPrecision_ =
+        orderJsonObject->get(resources::huobi::HUOBI_AMOUNT_PRECISION);
+    huobiPrecision.pricePrecision_ = orderJsonObject->get(resources::huobi::HUOBI_PRICE_PRECISION);
+    symbolsPrecision.emplace(symbol, huobiPrecision);
   }
 
-  throw common::exceptions::InvalidStockExchangeResponse(
-      "The currency " + currencyPair + " has not been found on Huobi stock exchange");
+  return symbolsPrecision;
 }
 
 }  // namespace stock_exchange
@@ -0,0 +1,655 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/kline_parser.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <locale>
+#include <sstream>
+
+#include "resources/resources.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace kline_parser {
+
+namespace {
+
+// A decimal with at most 2^53 as mantissa and a power of ten up to 22 is converted exactly by
+// one multiplication or division, since both operands are exact doubles.
+const uint64_t MAX_EXACT_MANTISSA = uint64_t(1) << 53;
+const int MAX_EXACT_POWER_OF_TEN = 22;
+const int MAX_MANTISSA_DIGITS = 19;
+const int MAX_EXPONENT = 10000;
+
+const double POWERS_OF_TEN[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+const size_t KLINE_FIELDS_COUNT = 6;
+
+struct JsonKey {
+  const char* data_{nullptr};
+  size_t size_{0};
+
+  bool operator==(const std::string& key) const {
+    return key.size() == size_ && key.compare(0, size_, data_, size_) == 0;
+  }
+};
+
+class JsonCursor {
+ public:
+  explicit JsonCursor(const std::string& text)
+      : position_(text.data()), end_(text.data() + text.size()) {}
+
+  bool consume(char symbol) {
+    skipWhitespace();
+    if (position_ != end_ && *position_ == symbol) {
+      ++position_;
+      return true;
+    }
+    return false;
+  }
+
+  bool peek(char symbol) {
+    skipWhitespace();
+    return position_ != end_ && *position_ == symbol;
+  }
+
+  bool atEnd() {
+    skipWhitespace();
+    return position_ == end_;
+  }
+
+  bool readKey(JsonKey& key) { return readString(key) && consume(':'); }
+
+  // Escape sequences are stepped over but kept, the keys and dates read here have none.
+  bool readString(JsonKey& value) {
+    if (!consume('"')) {
+      return false;
+    }
+
+    const char* begin = position_;
+    while (position_ != end_ && *position_ != '"') {
+      if (*position_ == '\\' && ++position_ == end_) {
+        return false;
+      }
+      ++position_;
+    }
+
+    if (position_ == end_) {
+      return false;
+    }
+
+    value.data_ = begin;
+    value.size_ = position_ - begin;
+    ++position_;
+    return true;
+  }
+
+  bool readBool(bool& value) {
+    skipWhitespace();
+    if (readLiteral("true")) {
+      value = true;
+      return true;
+    }
+    if (readLiteral("false")) {
+      value = false;
+      return true;
+    }
+    return false;
+  }
+
+  // Prices come as JSON numbers from some exchanges and as strings from others.
+  bool readNumber(double& value) {
+    bool isQuoted = consume('"');
+    skipWhitespace();
+
+    bool isNegative = position_ != end_ && *position_ == '-';
+    if (isNegative) {
+      ++position_;
+    }
+
+    const char* begin = position_;
+    uint64_t mantissa = 0;
+    int digitsCount = 0;
+    int exponent = 0;
+    bool hasDigits = false;
+
+    while (isDigit()) {
+      hasDigits = true;
+      readDigit(mantissa, digitsCount, exponent, false);
+    }
+
+    if (position_ != end_ && *position_ == '.') {
+      ++position_;
+      while (isDigit()) {
+        hasDigits = true;
+        readDigit(mantissa, digitsCount, exponent, true);
+      }
+    }
+
+    if (!hasDigits) {
+      return false;
+    }
+
+    if (position_ != end_ && (*position_ == 'e' || *position_ == 'E')) {
+      ++position_;
+      bool isNegativeExponent = false;
+      if (position_ != end_ && (*position_ == '+' || *position_ == '-')) {
+        isNegativeExponent = *position_ == '-';
+        ++position_;
+      }
+
+      if (!isDigit()) {
+        return false;
+      }
+
+      int exponentValue = 0;
+      while (isDigit()) {
+        exponentValue = std::min(MAX_EXPONENT, exponentValue * 10 + (*position_ - '0'));
+        ++position_;
+      }
+      exponent += isNegativeExponent ? -exponentValue : exponentValue;
+    }
+
+    const char* end = position_;
+    if (isQuoted && !consume('"')) {
+      return false;
+    }
+
+    if (digitsCount <= MAX_MANTISSA_DIGITS && mantissa <= MAX_EXACT_MANTISSA &&
+        exponent >= -MAX_EXACT_POWER_OF_TEN && exponent <= MAX_EXACT_POWER_OF_TEN) {
+      value = static_cast<double>(mantissa);
+      value = exponent < 0 ? value / POWERS_OF_TEN[-exponent] : value * POWERS_OF_TEN[exponent];
+    } else {
+      value = readNumberSlowly(begin, end);
+    }
+
+    if (isNegative) {
+      value = -value;
+    }
+
+    return true;
+  }
+
+  bool skipValue() {
+    skipWhitespace();
+    if (position_ == end_) {
+      return false;
+    }
+
+    if (*position_ == '"') {
+      JsonKey ignored;
+      return readString(ignored);
+    }
+
+    if (*position_ == '[' || *position_ == '{') {
+      int depth = 0;
+      while (position_ != end_) {
+        char symbol = *position_;
+        if (symbol == '"') {
+          JsonKey ignored;
+          if (!readString(ignored)) {
+            return false;
+          }
+          continue;
+        }
+
+        ++position_;
+        if (symbol == '[' || symbol == '{') {
+          ++depth;
+        } else if ((symbol == ']' || symbol == '}') && --depth == 0) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Numbers and the true, false and null literals.
+    const char* begin = position_;
+    while (position_ != end_ && (std::isalnum(static_cast<unsigned char>(*position_)) ||
+                                 *position_ == '-' || *position_ == '+' || *position_ == '.')) {
+      ++position_;
+    }
+    return position_ != begin;
+  }
+
+ private:
+  void skipWhitespace() {
+    while (position_ != end_ &&
+           (*position_ == ' ' || *position_ == '\n' || *position_ == '\r' || *position_ == '\t')) {
+      ++position_;
+    }
+  }
+
+  bool isDigit() const { return position_ != end_ && *position_ >= '0' && *position_ <= '9'; }
+
+  void readDigit(uint64_t& mantissa, int& digitsCount, int& exponent, bool isFraction) {
+    int digit = *position_ - '0';
+    ++position_;
+
+    if (mantissa == 0 && digit == 0) {
+      exponent -= isFraction ? 1 : 0;
+      return;
+    }
+
+    // Past 19 digits the mantissa would overflow; the slow path reads the number instead.
+    ++digitsCount;
+    if (digitsCount <= MAX_MANTISSA_DIGITS) {
+      mantissa = mantissa * 10 + digit;
+      exponent -= isFraction ? 1 : 0;
+    }
+  }
+
+  bool readLiteral(const char* literal) {
+    const char* position = position_;
+    for (; *literal != '\0'; ++literal, ++position) {
+      if (position == end_ || *position != *literal) {
+        return false;
+      }
+    }
+    position_ = position;
+    return true;
+  }
+
+  static double readNumberSlowly(const char* begin, const char* end) {
+    // The classic locale keeps the decimal point whatever locale the application runs in.
+    std::istringstream stream(std::string(begin, end));
+    stream.imbue(std::locale::classic());
+    double value = 0;
+    stream >> value;
+    return value;
+  }
+
+ private:
+  const char* position_;
+  const char* end_;
+};
+
+template <typename ParseElement>
+bool parseArray(JsonCursor& cursor, ParseElement parseElement) {
+  if (!cursor.consume('[')) {
+    return false;
+  }
+  if (cursor.consume(']')) {
+    return true;
+  }
+
+  do {
+    if (!parseElement(cursor)) {
+      return false;
+    }
+  } while (cursor.consume(','));
+
+  return cursor.consume(']');
+}
+
+template <typename ParseMember>
+bool parseObject(JsonCursor& cursor, ParseMember parseMember) {
+  if (!cursor.consume('{')) {
+    return false;
+  }
+  if (cursor.consume('}')) {
+    return true;
+  }
+
+  do {
+    JsonKey key;
+    if (!cursor.readKey(key) || !parseMember(cursor, key)) {
+      return false;
+    }
+  } while (cursor.consume(','));
+
+  return cursor.consume('}');
+}
+
+// Positions of the candle fields in a kline sent as an array.
+struct KlineRowLayout {
+  int time_;
+  int open_;
+  int high_;
+  int low_;
+  int close_;
+  int volume_;
+};
+
+// Names of the candle fields in a kline sent as an object.
+struct KlineObjectLayout {
+  const std::string& time_;
+  const std::string& open_;
+  const std::string& high_;
+  const std::string& low_;
+  const std::string& close_;
+  const std::string& volume_;
+};
+
+const KlineRowLayout BINANCE_KLINE_LAYOUT{
+    resources::binance::BINANCE_TIMESTAMP_INDEX,  resources::binance::BINANCE_OPEN_PRICE_INDEX,
+    resources::binance::BINANCE_HIGH_PRICE_INDEX, resources::binance::BINANCE_LOW_PRICE_INDEX,
+    resources::binance::BINANCE_CLOSE_PRICE_INDEX, resources::binance::BINANCE_VOLUME_INDEX};
+
+const KlineRowLayout KRAKEN_KLINE_LAYOUT{
+    resources::kraken::KRAKEN_TIME_INDEX,       resources::kraken::KRAKEN_OPEN_PRICE_INDEX,
+    resources::kraken::KRAKEN_HIGH_PRICE_INDEX, resources::kraken::KRAKEN_LOW_PRICE_INDEX,
+    resources::kraken::KRAKEN_CLOSE_PRICE_INDEX, resources::kraken::KRAKEN_VOLUME_INDEX};
+
+const KlineObjectLayout POLONIEX_KLINE_LAYOUT{
+    resources::poloniex::POLONIEX_DATE,      resources::poloniex::POLONIEX_OPEN_PRICE,
+    resources::poloniex::POLONIEX_HIGH_PRICE, resources::poloniex::POLONIEX_LOW_PRICE,
+    resources::poloniex::POLONIEX_CLOSE_PRICE, resources::poloniex::POLONIEX_VOLUME_PRICE};
+
+const KlineObjectLayout HUOBI_KLINE_LAYOUT{
+    resources::huobi::HUOBI_CANDLE_TIMESTAMP,  resources::huobi::HUOBI_CANDLE_OPEN_PRICE,
+    resources::huobi::HUOBI_CANDLE_HIGH_PRICE, resources::huobi::HUOBI_CANDLE_LOW_PRICE,
+    resources::huobi::HUOBI_CANDLE_CLOSE_PRICE, resources::huobi::HUOBI_CANDLE_VOLUME_PRICE};
+
+const KlineObjectLayout BITTREX_KLINE_LAYOUT{resources::bittrex::MARKET_HISTORY_TIMESTAMP,
+                                             resources::bittrex::MARKET_HISTORY_OPEN_POSITION,
+                                             resources::bittrex::MARKET_HISTORY_HIGH_POSITION,
+                                             resources::bittrex::MARKET_HISTORY_LOW_POSITION,
+                                             resources::bittrex::MARKET_HISTORY_CLOSE_POSITION,
+                                             resources::bittrex::MARKET_HISTORY_VOLUME};
+
+double* getKlineField(const KlineRowLayout& layout, int index, common::MarketData& candle,
+                      double& timestamp) {
+  if (index == layout.time_) return &timestamp;
+  if (index == layout.open_) return &candle.openPrice_;
+  if (index == layout.high_) return &candle.highPrice_;
+  if (index == layout.low_) return &candle.lowPrice_;
+  if (index == layout.close_) return &candle.closePrice_;
+  if (index == layout.volume_) return &candle.volume_;
+  return nullptr;
+}
+
+double* getKlineField(const KlineObjectLayout& layout, const JsonKey& key,
+                      common::MarketData& candle) {
+  if (key == layout.open_) return &candle.openPrice_;
+  if (key == layout.high_) return &candle.highPrice_;
+  if (key == layout.low_) return &candle.lowPrice_;
+  if (key == layout.close_) return &candle.closePrice_;
+  if (key == layout.volume_) return &candle.volume_;
+  return nullptr;
+}
+
+void addCandle(const common::MarketData& candle, std::vector<common::MarketData>& candles) {
+  candles.push_back(candle);
+}
+
+void addCandle(const common::MarketData& candle, common::CandleSeries& candles) {
+  candles.addCandle(candle);
+}
+
+template <typename Candles>
+bool parseKlineRow(JsonCursor& cursor, const KlineRowLayout& layout, const DateConverter& toDate,
+                   Candles& candles) {
+  common::MarketData candle;
+  double timestamp = 0;
+  int index = 0;
+  size_t fieldsCount = 0;
+
+  bool isParsed = parseArray(cursor, [&](JsonCursor& cursor) {
+    double* field = getKlineField(layout, index++, candle, timestamp);
+    if (field == nullptr) {
+      return cursor.skipValue();
+    }
+
+    ++fieldsCount;
+    return cursor.readNumber(*field);
+  });
+
+  if (!isParsed || fieldsCount != KLINE_FIELDS_COUNT) {
+    return false;
+  }
+
+  candle.date_ = toDate(static_cast<time_t>(timestamp));
+  addCandle(candle, candles);
+  return true;
+}
+
+// Without a date converter the open time is read as a date string.
+template <typename Candles>
+bool parseKlineObject(JsonCursor& cursor, const KlineObjectLayout& layout,
+                      const DateConverter& toDate, Candles& candles) {
+  common::MarketData candle;
+  size_t fieldsCount = 0;
+
+  bool isParsed = parseObject(cursor, [&](JsonCursor& cursor, const JsonKey& key) {
+    if (key == layout.time_) {
+      ++fieldsCount;
+      if (!toDate) {
+        JsonKey date;
+        if (!cursor.readString(date)) {
+          return false;
+        }
+        candle.date_ = common::Date::parseDate(std::string(date.data_, date.size_));
+        return true;
+      }
+
+      double timestamp = 0;
+      if (!cursor.readNumber(timestamp)) {
+        return false;
+      }
+      candle.date_ = toDate(static_cast<time_t>(timestamp));
+      return true;
+    }
+
+    double* field = getKlineField(layout, key, candle);
+    if (field == nullptr) {
+      return cursor.skipValue();
+    }
+
+    ++fieldsCount;
+    return cursor.readNumber(*field);
+  });
+
+  if (!isParsed || fieldsCount != KLINE_FIELDS_COUNT) {
+    return false;
+  }
+
+  addCandle(candle, candles);
+  return true;
+}
+
+template <typename Candles>
+bool finishParsing(bool isParsed, Candles& candles) {
+  if (!isParsed) {
+    candles.clear();
+  }
+  return isParsed;
+}
+
+template <typename Candles>
+bool parseBinanceKlinesInto(const std::string& response, const DateConverter& toDate,
+                            Candles& candles) {
+  candles.clear();
+  JsonCursor cursor(response);
+
+  bool isParsed = parseArray(cursor, [&](JsonCursor& cursor) {
+    return parseKlineRow(cursor, BINANCE_KLINE_LAYOUT, toDate, candles);
+  });
+
+  return finishParsing(isParsed && cursor.atEnd(), candles);
+}
+
+template <typename Candles>
+bool parseKrakenKlinesInto(const std::string& response, const DateConverter& toDate,
+                           Candles& candles) {
+  candles.clear();
+  JsonCursor cursor(response);
+  bool hasNoErrors = false;
+  bool hasCandles = false;
+
+  // The result holds the candles under the pair name next to the "last" timestamp.
+  bool isParsed = parseObject(cursor, [&](JsonCursor& cursor, const JsonKey& key) {
+    if (key == resources::words::ERROR_WORD) {
+      hasNoErrors = parseArray(cursor, [](JsonCursor&) { return false; });
+      return hasNoErrors;
+    }
+
+    if (key == resources::words::RESULT) {
+      return parseObject(cursor, [&](JsonCursor& cursor, const JsonKey&) {
+        if (hasCandles || !cursor.peek('[')) {
+          return cursor.skipValue();
+        }
+
+        hasCandles = true;
+        return parseArray(cursor, [&](JsonCursor& cursor) {
+          return parseKlineRow(cursor, KRAKEN_KLINE_LAYOUT, toDate, candles);
+        });
+      });
+    }
+
+    return cursor.skipValue();
+  });
+
+  return finishParsing(isParsed && hasNoErrors && hasCandles && cursor.atEnd(), candles);
+}
+
+template <typename Candles>
+bool parsePoloniexKlinesInto(const std::string& response, const DateConverter& toDate,
+                             Candles& candles) {
+  candles.clear();
+  JsonCursor cursor(response);
+
+  bool isParsed = parseArray(cursor, [&](JsonCursor& cursor) {
+    return parseKlineObject(cursor, POLONIEX_KLINE_LAYOUT, toDate, candles);
+  });
+
+  return finishParsing(isParsed && cursor.atEnd(), candles);
+}
+
+template <typename Candles>
+bool parseHuobiKlinesInto(const std::string& response, const DateConverter& toDate,
+                          Candles& candles) {
+  candles.clear();
+  JsonCursor cursor(response);
+  bool isStatusOk = false;
+  bool hasCandles = false;
+
+  bool isParsed = parseObject(cursor, [&](JsonCursor& cursor, const JsonKey& key) {
+    if (key == resources::words::STATUS) {
+      JsonKey status;
+      if (!cursor.readString(status)) {
+        return false;
+      }
+      isStatusOk = status == resources::huobi::HUOBI_STATUS_OK;
+      return true;
+    }
+
+    if (key == resources::huobi::HUOBI_ORDERS_DATA_KEYWORD) {
+      hasCandles = true;
+      return parseArray(cursor, [&](JsonCursor& cursor) {
+        return parseKlineObject(cursor, HUOBI_KLINE_LAYOUT, toDate, candles);
+      });
+    }
+
+    return cursor.skipValue();
+  });
+
+  return finishParsing(isParsed && isStatusOk && hasCandles && cursor.atEnd(), candles);
+}
+
+template <typename Candles>
+bool parseBittrexKlinesInto(const std::string& response, Candles& candles) {
+  candles.clear();
+  JsonCursor cursor(response);
+  bool isSuccess = false;
+  bool hasCandles = false;
+
+  bool isParsed = parseObject(cursor, [&](JsonCursor& cursor, const JsonKey& key) {
+    if (key == resources::words::SUCCESS) {
+      return cursor.readBool(isSuccess);
+    }
+
+    if (key == resources::words::RESULT) {
+      hasCandles = true;
+      return parseArray(cursor, [&](JsonCursor& cursor) {
+        return parseKlineObject(cursor, BITTREX_KLINE_LAYOUT, DateConverter(), candles);
+      });
+    }
+
+    return cursor.skipValue();
+  });
+
+  return finishParsing(isParsed && isSuccess && hasCandles && cursor.atEnd(), candles);
+}
+
+}  // namespace
+
+bool parseBinanceKlines(const std::string& response, const DateConverter& toDate,
+                        std::vector<common::MarketData>& candles) {
+  return parseBinanceKlinesInto(response, toDate, candles);
+}
+
+bool parseBinanceKlines(const std::string& response, const DateConverter& toDate,
+                        common::CandleSeries& candles) {
+  return parseBinanceKlinesInto(response, toDate, candles);
+}
+
+bool parseKrakenKlines(const std::string& response, const DateConverter& toDate,
+                       std::vector<common::MarketData>& candles) {
+  return parseKrakenKlinesInto(response, toDate, candles);
+}
+
+bool parseKrakenKlines(const std::string& response, const DateConverter& toDate,
+                       common::CandleSeries& candles) {
+  return parseKrakenKlinesInto(response, toDate, candles);
+}
+
+bool parsePoloniexKlines(const std::string& response, const DateConverter& toDate,
+                         std::vector<common::MarketData>& candles) {
+  return parsePoloniexKlinesInto(response, toDate, candles);
+}
+
+bool parsePoloniexKlines(const std::string& response, const DateConverter& toDate,
+                         common::CandleSeries& candles) {
+  return parsePoloniexKlinesInto(response, toDate, candles);
+}
+
+bool parseHuobiKlines(const std::string& response, const DateConverter& toDate,
+                      std::vector<common::MarketData>& candles) {
+  return parseHuobiKlinesInto(response, toDate, candles);
+}
+
+bool parseHuobiKlines(const std::string& response, const DateConverter& toDate,
+                      common::CandleSeries& candles) {
+  return parseHuobiKlinesInto(response, toDate, candles);
+}
+
+bool parseBittrexKlines(const std::string& response, std::vector<common::MarketData>& candles) {
+  return parseBittrexKlinesInto(response, candles);
+}
+
+bool parseBittrexKlines(const std::string& response, common::CandleSeries& candles) {
+  return parseBittrexKlinesInto(response, candles);
+}
+
+}  // namespace kline_parser
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -34,6 +34,7 @@
 #include "common/exceptions/stock_exchange_exception/invalid_stock_exchange_response_exception.h"
 #include "common/loggers/file_logger.h"
 #include "common/utils.h"
+#include "include/kline_parser.h"
 #include "include/stock_exchange_utils.h"
 #include "resources/resources.h"
 
@@ -92,7 +93,8 @@ common::MarketOrder KrakenQuery::sellOrder(common::Currency::Enum fromCurrency,
                                            double rate) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -160,7 +162,8 @@ common::MarketOrder KrakenQuery::buyOrder(common::Currency::Enum fromCurrency,
                                           double rate) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -227,7 +230,8 @@ bool KrakenQuery::cancelOrder(common::Currency::Enum fromCurrency,
                               common::Currency::Enum toCurrency, const std::string& uuid) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -271,9 +275,44 @@ bool KrakenQuery::cancelOrder(common::Currency::Enum fromCurrency,
 common::MarketHistoryPtr KrakenQuery::getMarketHistory(common::Currency::Enum fromCurrency,
                                                        common::Currency::Enum toCurrency,
                                                        common::TickInterval::Enum interval) {
+  return requestMarketHistory(fromCurrency, toCurrency, interval, std::string());
+}
+
+common::MarketHistoryPtr KrakenQuery::getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                            common::Currency::Enum toCurrency,
+                                                            common::TickInterval::Enum interval,
+                                                            const common::Date& openDate) {
+  // Kraken returns candles after the given time, so step back a second to keep the open one.
+  auto since = stock_exchange_utils::getTimestampFromDate(openDate, false) - 1;
+  std::string windowParameters = resources::symbols::AND + resources::kraken::KRAKEN_SINCE_KEYWORD +
+                                 resources::symbols::EQUAL + std::to_string(since);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr KrakenQuery::getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                             common::Currency::Enum toCurrency,
+                                                             common::TickInterval::Enum interval,
+                                                             size_t candlesCount) {
+  auto since = stock_exchange_utils::getLatestCandlesStartTime(interval, candlesCount);
+  if (since == 0) {
+    return getMarketHistory(fromCurrency, toCurrency, interval);
+  }
+
+  std::string windowParameters = resources::symbols::AND + resources::kraken::KRAKEN_SINCE_KEYWORD +
+                                 resources::symbols::EQUAL + std::to_string(since);
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, windowParameters);
+}
+
+common::MarketHistoryPtr KrakenQuery::requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                           common::Currency::Enum toCurrency,
+                                                           common::TickInterval::Enum interval,
+                                                           const std::string& windowParameters) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -287,7 +326,7 @@ common::MarketHistoryPtr KrakenQuery::getMarketHistory(common::Currency::Enum fr
       resources::kraken::KRAKEN_CURRENCY_PAIR_KEYWORD + resources::symbols::EQUAL +
       krakenCurrency_.getKrakenPair(fromCurrency, toCurrency) + resources::symbols::AND +
       resources::kraken::KRAKEN_INTERVAL_KEYWORD + resources::symbols::EQUAL +
-      common::convertTickInterval(interval, common::StockExchangeType::Kraken);
+      common::convertTickInterval(interval, common::StockExchangeType::Kraken) + windowParameters;
 
   curl_easy_setopt(curl, CURLOPT_POSTFIELDS, post_data.c_str());
   curl_easy_setopt(curl, CURLOPT_HTTPHEADER, NULL);
@@ -308,7 +347,8 @@ std::vector<common::MarketOrder> KrakenQuery::getMarketOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -384,7 +424,8 @@ common::CurrencyTick KrakenQuery::getCurrencyTick(common::Currency::Enum fromCur
                                                   common::Currency::Enum toCurrency) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -422,11 +463,101 @@ common::CurrencyTick KrakenQuery::getCurrencyTick(common::Currency::Enum fromCur
   return currencyTick;
 }
 
+CurrencyTicks KrakenQuery::requestAllTicks(common::Currency::Enum baseCurrency) {
+  using namespace Poco;
+
+  CurrencyTicks ticks;
+  auto markets = stock_exchange_utils::getBaseCurrencyMarkets(
+      krakenCurrency_, baseCurrency, common::KrakenCurrency::getKrakenPair);
+  if (markets.empty()) {
+    return ticks;
+  }
+
+  // All markets of the base currency go into one multi-pair Ticker request, so a snapshot costs
+  // a single call against Kraken's public rate limit.
+  std::string pairs;
+  for (const auto& market : markets) {
+    pairs += pairs.empty() ? market.first : resources::symbols::COMMA + market.first;
+  }
+
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
+  checkCurl(curl);
+
+  std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
+                     resources::kraken::KRAKEN_PUBLIC_METHODS + resources::symbols::SLASH +
+                     resources::kraken::KRAKEN_TICKER_KEYWORD;
+
+  std::string method_url = resources::kraken::KRAKEN_API_URI + path;
+  curl_easy_setopt(curl, CURLOPT_URL, method_url.c_str());
+
+  std::string post_data =
+      resources::kraken::KRAKEN_CURRENCY_PAIR_KEYWORD + resources::symbols::EQUAL + pairs;
+
+  curl_easy_setopt(curl, CURLOPT_POSTFIELDS, post_data.c_str());
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, NULL);
+
+  std::string response = sendRequest(curl);
+
+  try {
+    JSON::Object::Ptr jsonMainObject = getJsonObjectAndCheckOnIncorrectJson(response, nullptr);
+    checkKrakenResponseMessage(jsonMainObject, nullptr);
+
+    auto result = jsonMainObject->getObject(resources::words::RESULT);
+    for (const auto& pairName : result->getNames()) {
+      auto market = markets.find(pairName);
+      if (market == markets.end()) {
+        market = markets.find(getPairAltname(pairName));
+      }
+
+      if (market == markets.end()) {
+        continue;
+      }
+
+      auto currencyPairData = result->getObject(pairName);
+
+      common::CurrencyTick currencyTick;
+      auto askArray = currencyPairData->getArray(resources::kraken::KRAKEN_PRICE_TICKER_ASK);
+      currencyTick.ask_ = askArray->get(resources::kraken::KRAKEN_PRICE_TIKER_INDEX);
+      auto bidArray = currencyPairData->getArray(resources::kraken::KRAKEN_PRICE_TICKER_BID);
+      currencyTick.bid_ = bidArray->get(resources::kraken::KRAKEN_PRICE_TIKER_INDEX);
+      currencyTick.fromCurrency_ = baseCurrency;
+      currencyTick.toCurrency_ = market->second;
+
+      ticks.emplace(market->second, currencyTick);
+    }
+  } catch (const std::exception& ex) {
+    // Kraken rejects the whole request if one pair is unknown. The ticks are left out, so every
+    // reader asks for its own pair and reports the error.
+    ticks.clear();
+  }
+
+  return ticks;
+}
+
+std::string KrakenQuery::getPairAltname(const std::string& pairName) {
+  // Pairs of Kraken's older assets are keyed by their full asset names, e.g. XXBTZUSD for XBTUSD.
+  const size_t assetLength = resources::kraken::KRAKEN_FULL_ASSET_NAME_LENGTH;
+  const std::string& prefixes = resources::kraken::KRAKEN_FULL_ASSET_NAME_PREFIXES;
+  if (pairName.size() != 2 * assetLength || prefixes.find(pairName[0]) == std::string::npos ||
+      prefixes.find(pairName[assetLength]) == std::string::npos) {
+    return pairName;
+  }
+
+  return pairName.substr(1, assetLength - 1) + pairName.substr(assetLength + 1);
+}
+
 std::vector<common::MarketOrder> KrakenQuery::getAccountOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return stock_exchange_utils::getMarketOrders(getAllAccountOpenOrders(), fromCurrency,
+                                               toCurrency);
+}
+
+std::vector<common::MarketOrder> KrakenQuery::getAllAccountOpenOrders() {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -458,17 +589,20 @@ std::vector<common::MarketOrder> KrakenQuery::getAccountOpenOrders(
 
   curl_slist_free_all(chunk);
 
-  std::vector<common::MarketOrder> openOrders =
-      parseOrderList(jsonMainObject, resources::kraken::KRAKEN_GET_OPENED_ORDERS_LIST_KEYWORD,
-                     fromCurrency, toCurrency);
-
-  return openOrders;
+  return parseOrderList(jsonMainObject, resources::kraken::KRAKEN_GET_OPENED_ORDERS_LIST_KEYWORD);
 }
 
 double KrakenQuery::getBalance(common::Currency::Enum currency) {
+  auto balances = getBalances();
+  auto balanceIt = balances.find(currency);
+  return balanceIt != balances.end() ? balanceIt->second : 0.0;
+}
+
+CurrencyBalances KrakenQuery::requestBalances() {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -500,11 +634,19 @@ double KrakenQuery::getBalance(common::Currency::Enum currency) {
 
   curl_slist_free_all(chunk);
 
+  CurrencyBalances balances;
   auto resultObject = jsonMainObject->getObject(resources::words::RESULT);
-  auto coinsWithNonZeroBalance =
-      resultObject->optValue(stock_exchange_utils::getKrakenCurrencyStringFromEnum(currency), 0.0);
+  for (const auto& currencyName : resultObject->getNames()) {
+    common::Currency::Enum currency;
+    try {
+      currency = stock_exchange_utils::getKrakenCurrencyFromString(currencyName);
+    } catch (const common::exceptions::UndefinedTypeException&) {
+      continue;
+    }
+    balances.emplace(currency, resultObject->get(currencyName).convert<double>());
+  }
 
-  return coinsWithNonZeroBalance;
+  return balances;
 }
 
 CurrencyLotsHolder KrakenQuery::getCurrencyLotsHolder() {
@@ -512,9 +654,21 @@ CurrencyLotsHolder KrakenQuery::getCurrencyLotsHolder() {
   return lotsSizes;
 }
 
+size_t KrakenQuery::getParallelRequestsLimit() const {
+  return resources::kraken::KRAKEN_PARALLEL_REQUESTS;
+}
+
 common::MarketHistoryPtr KrakenQuery::parseMarketHistory(const std::string& response) const {
   using namespace Poco;
 
+  auto candles = std::make_unique<common::MarketHistory>();
+  auto toDate = [](time_t timestamp) {
+    return stock_exchange_utils::getDataFromTimestamp(timestamp, false);
+  };
+  if (kline_parser::parseKrakenKlines(response, toDate, candles->marketData_)) {
+    return candles;
+  }
+
   JSON::Parser parser;
   JSON::Object::Ptr object = parser.parse(response).extract<JSON::Object::Ptr>();
 
@@ -545,7 +699,8 @@ std::vector<common::MarketOrder> KrakenQuery::getAccountClosedOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
   using namespace Poco;
 
-  CURL* curl = curl_easy_init();
+  auto curlHandle = curlHandles_.acquire();
+  CURL* curl = curlHandle.get();
   checkCurl(curl);
 
   std::string path = resources::kraken::KRAKEN_SLASH_ZERO_SLASH_REQUEST +
@@ -578,15 +733,13 @@ std::vector<common::MarketOrder> KrakenQuery::getAccountClosedOrders(
   curl_slist_free_all(chunk);
 
   std::vector<common::MarketOrder> closedOrders =
-      parseOrderList(jsonMainObject, resources::kraken::KRAKEN_GET_CLOSED_ORDERS_LIST_KEYWORD,
-                     fromCurrency, toCurrency);
+      parseOrderList(jsonMainObject, resources::kraken::KRAKEN_GET_CLOSED_ORDERS_LIST_KEYWORD);
 
-  return closedOrders;
+  return stock_exchange_utils::getMarketOrders(closedOrders, fromCurrency, toCurrency);
 }
 
 std::vector<common::MarketOrder> KrakenQuery::parseOrderList(
-    const Poco::JSON::Object::Ptr jsonMainObject, const std::string& ordersType,
-    common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+    const Poco::JSON::Object::Ptr jsonMainObject, const std::string& ordersType) {
   std::vector<common::MarketOrder> orders;
 
   auto result = jsonMainObject->getObject(resources::words::RESULT);
@@ -607,10 +760,6 @@ std::vector<common::MarketOrder> KrakenQuery::parseOrderList(
     currentOrder.uuid_ = ordersList.at(i);
     currentOrder.fromCurrency_ = common::Currency::fromString(pair.first);
     currentOrder.toCurrency_ = common::Currency::fromString(pair.second);
-
-    if (currentOrder.fromCurrency_ != fromCurrency || currentOrder.toCurrency_ != toCurrency) {
-      continue;
-    }
     currentOrder.orderType_ = order_type;
 
     currentOrder.stockExchangeType_ = common::StockExchangeType::Kraken;
@@ -650,10 +799,13 @@ std::string KrakenQuery::sendRequest(CURL* curl) {
   curl_easy_setopt(curl, CURLOPT_WRITEDATA, static_cast<void*>(&response));
 
   CURLcode responseResult = curl_easy_perform(curl);
-  curl_easy_cleanup(curl);
 
   return response;
 }
 
+std::vector<std::string> KrakenQuery::sendRequests(const std::vector<CURL*>& curls) {
+  return curlExecutor_.perform(curls);
+}
+
 }  // namespace stock_exchange
 }  // namespace auto_trader
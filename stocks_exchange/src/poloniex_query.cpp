@@ -31,6 +31,7 @@
 #include "common/exceptions/stock_exchange_exception/invalid_stock_exchange_response_exception.h"
 #include "common/loggers/file_logger.h"
 #include "common/utils.h"
+#include "include/kline_parser.h"
 #include "include/stock_exchange_utils.h"
 #include "resources/resources.h"
 
@@ -210,6 +211,11 @@ bool PoloniexQuery::cancelOrder(common::Currency::Enum fromCurrency,
 
 std::vector<common::MarketOrder> PoloniexQuery::getAccountOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return stock_exchange_utils::getMarketOrders(getAllAccountOpenOrders(), fromCurrency,
+                                               toCurrency);
+}
+
+std::vector<common::MarketOrder> PoloniexQuery::getAllAccountOpenOrders() {
   using namespace Poco;
 
   CURL* curl = curl_easy_init();
@@ -276,10 +282,6 @@ std::vector<common::MarketOrder> PoloniexQuery::getAccountOpenOrders(
       orderInfo.toCurrency_ =
           common::Currency::fromString(results.at(resources::numbers::SECOND_ARRAY_INDEX));
 
-      if (orderInfo.fromCurrency_ != fromCurrency || orderInfo.toCurrency_ != toCurrency) {
-        continue;
-      }
-
       auto orderType_str = openOrderJsonObject->get(resources::words::TYPE).toString();
       orderInfo.orderType_ = orderType_str == resources::poloniex::POLONIEX_BUY_KEYWORD
                                  ? common::OrderType::BUY
@@ -396,6 +398,35 @@ common::MarketOrder PoloniexQuery::getAccountOrder(common::Currency::Enum fromCu
 common::MarketHistoryPtr PoloniexQuery::getMarketHistory(common::Currency::Enum fromCurrency,
                                                          common::Currency::Enum toCurrency,
                                                          common::TickInterval::Enum interval) {
+  auto timestamp = stock_exchange_utils::getTimestampMiliseconds();
+  return requestMarketHistory(fromCurrency, toCurrency, interval,
+                              timestamp - resources::poloniex::THREE_MONTH_IN_SECOND);
+}
+
+common::MarketHistoryPtr PoloniexQuery::getMarketHistorySince(common::Currency::Enum fromCurrency,
+                                                              common::Currency::Enum toCurrency,
+                                                              common::TickInterval::Enum interval,
+                                                              const common::Date& openDate) {
+  return requestMarketHistory(fromCurrency, toCurrency, interval,
+                              stock_exchange_utils::getTimestampFromDate(openDate, false));
+}
+
+common::MarketHistoryPtr PoloniexQuery::getLatestMarketHistory(common::Currency::Enum fromCurrency,
+                                                               common::Currency::Enum toCurrency,
+                                                               common::TickInterval::Enum interval,
+                                                               size_t candlesCount) {
+  auto startTime = stock_exchange_utils::getLatestCandlesStartTime(interval, candlesCount);
+  if (startTime == 0) {
+    return getMarketHistory(fromCurrency, toCurrency, interval);
+  }
+
+  return requestMarketHistory(fromCurrency, toCurrency, interval, startTime);
+}
+
+common::MarketHistoryPtr PoloniexQuery::requestMarketHistory(common::Currency::Enum fromCurrency,
+                                                             common::Currency::Enum toCurrency,
+                                                             common::TickInterval::Enum interval,
+                                                             time_t startTime) {
   using namespace Poco;
 
   CURL* curl = curl_easy_init();
@@ -404,7 +435,7 @@ common::MarketHistoryPtr PoloniexQuery::getMarketHistory(common::Currency::Enum
   auto uri = resources::poloniex::POLONIEX_PUBLIC_ENDPOINT;
 
   auto timestamp = stock_exchange_utils::getTimestampMiliseconds();
-  std::string nonce_start = std::to_string(timestamp - resources::poloniex::THREE_MONTH_IN_SECOND);
+  std::string nonce_start = std::to_string(startTime);
   std::string nonce_end = std::to_string(timestamp);
 
   std::string parameters =
@@ -478,7 +509,67 @@ common::CurrencyTick PoloniexQuery::getCurrencyTick(common::Currency::Enum fromC
   return tick;
 }
 
+CurrencyTicks PoloniexQuery::requestAllTicks(common::Currency::Enum baseCurrency) {
+  using namespace Poco;
+
+  CurrencyTicks ticks;
+  auto markets = stock_exchange_utils::getBaseCurrencyMarkets(
+      poloniexCurrency_, baseCurrency,
+      [this](common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+        return poloniexCurrency_.getPoloniexPair(fromCurrency, toCurrency);
+      });
+  if (markets.empty()) {
+    return ticks;
+  }
+
+  CURL* curl = curl_easy_init();
+  stock_exchange_utils::checkCurlPointer(curl);
+
+  auto uri = resources::poloniex::POLONIEX_PUBLIC_ENDPOINT;
+  std::string parameters = resources::words::COMMAND + resources::symbols::EQUAL +
+                           resources::poloniex::POLONIEX_RETURN_TICKER;
+
+  auto fullUrlWithParameters = uri + resources::symbols::QUESTION + parameters;
+  curl_easy_setopt(curl, CURLOPT_URL, fullUrlWithParameters.data());
+  curl_easy_setopt(curl, CURLOPT_HTTPHEADER, nullptr);
+
+  std::string response = sendRequest(curl);
+  curl_easy_cleanup(curl);
+
+  auto jsonObject = getJsonObjectAndCheckOnIncorrectJson(response, nullptr);
+  checkPoloniexResponseMessage(jsonObject, nullptr);
+
+  for (const auto& market : markets) {
+    if (!jsonObject->has(market.first)) {
+      continue;
+    }
+
+    auto marketObject = jsonObject->getObject(market.first);
+
+    common::CurrencyTick tick;
+    tick.ask_ = marketObject->get(resources::poloniex::POLONIEX_LOWEST_ASK);
+    tick.bid_ = marketObject->get(resources::poloniex::POLONIEX_HIGHEST_BID);
+    tick.fromCurrency_ = baseCurrency;
+    tick.toCurrency_ = market.second;
+
+    ticks.emplace(market.second, tick);
+  }
+
+  return ticks;
+}
+
 double PoloniexQuery::getBalance(common::Currency::Enum currency) {
+  auto balances = getBalances();
+  auto balanceIt = balances.find(currency);
+  if (balanceIt == balances.end()) {
+    throw common::exceptions::InvalidStockExchangeResponse("Unknown currency: " +
+                                                           common::Currency::toString(currency));
+  }
+
+  return balanceIt->second;
+}
+
+CurrencyBalances PoloniexQuery::requestBalances() {
   using namespace Poco;
 
   CURL* curl = curl_easy_init();
@@ -518,14 +609,17 @@ double PoloniexQuery::getBalance(common::Currency::Enum currency) {
   auto jsonObject = getJsonObjectAndCheckOnIncorrectJson(response, chunk);
   checkPoloniexResponseMessage(jsonObject, chunk);
 
-  auto balance = jsonObject->optValue(common::Currency::toString(currency),
-                                      common::Currency::toString(common::Currency::UNKNOWN));
-  if (balance == common::Currency::toString(common::Currency::UNKNOWN)) {
-    throw common::exceptions::InvalidStockExchangeResponse("Unknown currency: " +
-                                                           common::Currency::toString(currency));
+  curl_slist_free_all(chunk);
+
+  CurrencyBalances balances;
+  for (const auto& currencyName : jsonObject->getNames()) {
+    auto currency = common::Currency::fromString(currencyName);
+    if (currency != common::Currency::UNKNOWN) {
+      balances.emplace(currency, std::stod(jsonObject->get(currencyName).toString()));
+    }
   }
 
-  return std::stod(balance);
+  return balances;
 }
 
 CurrencyLotsHolder PoloniexQuery::getCurrencyLotsHolder() {
@@ -533,6 +627,10 @@ CurrencyLotsHolder PoloniexQuery::getCurrencyLotsHolder() {
   return holder;
 }
 
+size_t PoloniexQuery::getParallelRequestsLimit() const {
+  return resources::poloniex::POLONIEX_PARALLEL_REQUESTS;
+}
+
 std::string PoloniexQuery::sendRequest(CURL* curl) {
   std::string response;
   curl_easy_setopt(curl, CURLOPT_WRITEDATA, static_cast<void*>(&response));
@@ -545,6 +643,14 @@ std::string PoloniexQuery::sendRequest(CURL* curl) {
 common::MarketHistoryPtr PoloniexQuery::parseMarketHistory(const std::string& response) const {
   using namespace Poco;
 
+  auto candles = std::make_unique<common::MarketHistory>();
+  auto toDate = [](time_t timestamp) {
+    return stock_exchange_utils::getDataFromTimestamp(timestamp, false);
+  };
+  if (kline_parser::parsePoloniexKlines(response, toDate, candles->marketData_)) {
+    return candles;
+  }
+
   JSON::Parser parser;
   JSON::Array::Ptr objects = parser.parse(response).extract<JSON::Array::Ptr>();
 
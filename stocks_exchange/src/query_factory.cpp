@@ -29,6 +29,7 @@
 #include "common/exceptions/undefined_type_exception.h"
 #include "include/binance_query.h"
 #include "include/bittrex_query.h"
+#include "include/caching_query.h"
 #include "include/huobi_query.h"
 #include "include/kraken_query.h"
 #include "include/poloniex_query.h"
@@ -41,15 +42,15 @@ namespace stock_exchange {
 std::shared_ptr<Query> QueryFactory::createQuery(common::StockExchangeType type) const {
   switch (type) {
     case common::StockExchangeType::Binance:
-      return std::make_shared<BinanceQuery>();
+      return std::make_shared<CachingQuery>(std::make_shared<BinanceQuery>());
     case common::StockExchangeType::Bittrex:
-      return std::make_shared<BittrexQuery>();
+      return std::make_shared<CachingQuery>(std::make_shared<BittrexQuery>());
     case common::StockExchangeType::Kraken:
-      return std::make_shared<KrakenQuery>();
+      return std::make_shared<CachingQuery>(std::make_shared<KrakenQuery>());
     case common::StockExchangeType::Poloniex:
-      return std::make_shared<PoloniexQuery>();
+      return std::make_shared<CachingQuery>(std::make_shared<PoloniexQuery>());
     case common::StockExchangeType::Huobi:
-      return std::make_shared<HuobiQuery>();
+      return std::make_shared<CachingQuery>(std::make_shared<HuobiQuery>());
     default:
       throw common::exceptions::UndefinedTypeException(resources::keywords::STOCK_EXCHANGE_TYPE);
   }
@@ -34,12 +34,15 @@
 namespace auto_trader {
 namespace stock_exchange {
 
-QueryProcessor::QueryProcessor(const QueryFactory& query_factory) : query_factory_(query_factory) {}
+QueryProcessor::QueryProcessor(const QueryFactory& query_factory)
+    : query_factory_(query_factory), sessionPool_(std::make_shared<HttpsSessionPool>()) {}
 
 QueryPtr QueryProcessor::getQuery(common::StockExchangeType type) {
+  std::lock_guard<std::mutex> lock(mutex_);
   auto queryIterator = queries_.find(type);
   if (queryIterator == queries_.end()) {
     auto query = query_factory_.createQuery(type);
+    query->setSessionPool(sessionPool_);
     queries_[type] = query;
     return query;
   } else {
@@ -47,5 +50,11 @@ QueryPtr QueryProcessor::getQuery(common::StockExchangeType type) {
   }
 }
 
+void QueryProcessor::setMaxConnectionsPerHost(size_t maxConnectionsPerHost) {
+  HttpsSessionPool::Settings settings;
+  settings.maxConnectionsPerHost_ = maxConnectionsPerHost;
+  sessionPool_->configure(settings);
+}
+
 }  // namespace stock_exchange
 }  // namespace auto_trader
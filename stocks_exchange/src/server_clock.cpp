@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/server_clock.h"
+
+#include <limits>
+
+namespace auto_trader {
+namespace stock_exchange {
+
+ServerClock::ServerClock(uint64_t resyncPeriod)
+    : resyncPeriod_(resyncPeriod), offset_(0), syncTime_(0), isSynchronized_(false) {}
+
+bool ServerClock::isSyncRequired(uint64_t localTime) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !isSynchronized_ || localTime < syncTime_ || localTime - syncTime_ >= resyncPeriod_;
+}
+
+bool ServerClock::isSynchronized() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return isSynchronized_;
+}
+
+void ServerClock::synchronize(const std::vector<ServerClockSample>& samples,
+                              uint64_t localTime) {
+  const ServerClockSample* bestSample = nullptr;
+  uint64_t bestRoundTrip = std::numeric_limits<uint64_t>::max();
+  for (const auto& sample : samples) {
+    if (sample.responseTime_ < sample.requestTime_) {
+      continue;
+    }
+    const uint64_t roundTrip = sample.responseTime_ - sample.requestTime_;
+    if (roundTrip < bestRoundTrip) {
+      bestRoundTrip = roundTrip;
+      bestSample = &sample;
+    }
+  }
+
+  if (!bestSample) {
+    return;
+  }
+
+  const int64_t localMiddleTime =
+      static_cast<int64_t>(bestSample->requestTime_ + bestRoundTrip / 2);
+  std::lock_guard<std::mutex> lock(mutex_);
+  offset_ = static_cast<int64_t>(bestSample->serverTime_) - localMiddleTime;
+  syncTime_ = localTime;
+  isSynchronized_ = true;
+}
+
+void ServerClock::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  isSynchronized_ = false;
+}
+
+uint64_t ServerClock::getServerTime(uint64_t localTime) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<uint64_t>(static_cast<int64_t>(localTime) + offset_);
+}
+
+int64_t ServerClock::getOffset() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return offset_;
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/ticks_snapshot.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+
+TicksSnapshot::TicksSnapshot(uint64_t timeToLive) : timeToLive_(timeToLive) {}
+
+bool TicksSnapshot::get(common::Currency::Enum baseCurrency, uint64_t currentTime,
+                        CurrencyTicks& ticks) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(baseCurrency);
+  if (it == entries_.end()) {
+    return false;
+  }
+
+  const auto& entry = it->second;
+  if (currentTime < entry.updateTime_ || currentTime - entry.updateTime_ >= timeToLive_) {
+    return false;
+  }
+
+  ticks = entry.ticks_;
+  return true;
+}
+
+void TicksSnapshot::update(common::Currency::Enum baseCurrency, const CurrencyTicks& ticks,
+                           uint64_t currentTime) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto& entry = entries_[baseCurrency];
+  entry.ticks_ = ticks;
+  entry.updateTime_ = currentTime;
+}
+
+void TicksSnapshot::invalidate() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+}  // namespace stock_exchange
+}  // namespace auto_trader
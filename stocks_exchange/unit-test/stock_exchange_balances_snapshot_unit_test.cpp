@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "include/balances_snapshot.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+const uint64_t balancesTimeToLive = 5000;
+
+TEST(BalancesSnapshot, EmptySnapshotIsMissed) {
+  BalancesSnapshot snapshot(balancesTimeToLive);
+  CurrencyBalances balances;
+
+  EXPECT_FALSE(snapshot.get(0, balances));
+  EXPECT_TRUE(balances.empty());
+}
+
+TEST(BalancesSnapshot, SnapshotExpiresAfterTimeToLive) {
+  BalancesSnapshot snapshot(balancesTimeToLive);
+  snapshot.update({{common::Currency::BTC, 0.5}, {common::Currency::USDT, 120.0}}, 1000);
+
+  CurrencyBalances balances;
+  ASSERT_TRUE(snapshot.get(5999, balances));
+  EXPECT_EQ(balances.at(common::Currency::BTC), 0.5);
+  EXPECT_EQ(balances.at(common::Currency::USDT), 120.0);
+
+  EXPECT_FALSE(snapshot.get(6000, balances));
+}
+
+TEST(BalancesSnapshot, InvalidatedSnapshotIsMissedUntilUpdate) {
+  BalancesSnapshot snapshot(balancesTimeToLive);
+  snapshot.update({{common::Currency::BTC, 0.5}}, 1000);
+  snapshot.invalidate();
+
+  CurrencyBalances balances;
+  EXPECT_FALSE(snapshot.get(1001, balances));
+
+  snapshot.update({{common::Currency::BTC, 0.25}}, 1002);
+  ASSERT_TRUE(snapshot.get(1003, balances));
+  EXPECT_EQ(balances.at(common::Currency::BTC), 0.25);
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -309,6 +309,19 @@ TEST_F(BinanceQueryFixture, getMarketHistory) {
   EXPECT_EQ(marketData.size(), 2);
 }
 
+TEST_F(BinanceQueryFixture, getAccountOrder_RetriesOnceAfterInvalidTimestamp) {
+  mockBinanceQuery->DelegateToInvalidTimestampResponse();
+
+  EXPECT_CALL(*mockBinanceQuery, processHttpRequest(testing::_, testing::_, testing::_))
+      .Times(testing::AnyNumber());
+
+  auto order =
+      mockBinanceQuery->getAccountOrder(common::Currency::BTC, common::Currency::LTC, "myOrder1");
+
+  EXPECT_EQ(order.uuid_, "myOrder1");
+  EXPECT_EQ(mockBinanceQuery->getSignedRequestsCount(), 2);
+}
+
 }  // namespace unit_test
 }  // namespace stock_exchange
 }  // namespace auto_trader
\ No newline at end of file
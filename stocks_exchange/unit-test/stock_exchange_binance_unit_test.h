@@ -28,11 +28,14 @@
 #define STOCK_EXCHANGE_BINANCE_UNIT_TEST_H
 
 #include <istream>
+#include <string>
 
+#include "common/utils.h"
 #include "gmock/gmock.h"
 #include "include/base_query.h"
 #include "include/binance_query.h"
 #include "include/query_factory.h"
+#include "resources/resources.h"
 
 namespace auto_trader {
 namespace stock_exchange {
@@ -79,6 +82,28 @@ class FakeBinanceResponse {
 
     return fake_response;
   }
+
+  // Answers the time endpoint with the local time and rejects the first signed request with
+  // -1021, as Binance does when the request timestamp is outside recvWindow.
+  const std::string getInvalidTimestampThenAccountOrder(
+      const BaseQuery<Query>::ConnectionAttributes& host_and_port, Poco::Net::HTTPRequest& request,
+      const std::vector<HTTP_HEADERS>& headers) {
+    if (request.getURI().find(resources::binance::BINANCE_TIME) != std::string::npos) {
+      return "{\"serverTime\": " + std::to_string(common::getCurrentMSEpoch()) + "}";
+    }
+
+    if (signedRequestsCount_++ == 0) {
+      return "{\"code\": -1021, \"msg\": \"Timestamp for this request is outside of the "
+             "recvWindow.\"}";
+    }
+
+    return getAccountOrder(host_and_port, request, headers);
+  }
+
+  int getSignedRequestsCount() const { return signedRequestsCount_; }
+
+ private:
+  int signedRequestsCount_{0};
 };
 
 class MockBinanceQuery : public BinanceQuery {
@@ -98,6 +123,14 @@ class MockBinanceQuery : public BinanceQuery {
         .WillByDefault(testing::Invoke(&fake_response_, &FakeBinanceResponse::getAccountOrder));
   }
 
+  void DelegateToInvalidTimestampResponse() {
+    ON_CALL(*this, processHttpRequest(testing::_, testing::_, testing::_))
+        .WillByDefault(testing::Invoke(&fake_response_,
+                                       &FakeBinanceResponse::getInvalidTimestampThenAccountOrder));
+  }
+
+  int getSignedRequestsCount() const { return fake_response_.getSignedRequestsCount(); }
+
  private:
   FakeBinanceResponse fake_response_;
 };
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "include/candle_ring.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+const int64_t candleIntervalMs = 60000;
+const int64_t firstOpenTimeMs = 1546300800000;
+
+static common::MarketData makeCandle(int64_t index, double closePrice) {
+  common::MarketData candle(closePrice, closePrice, closePrice, closePrice, 1);
+  candle.date_ = common::Date::fromEpochMilliseconds(firstOpenTimeMs + index * candleIntervalMs);
+  return candle;
+}
+
+TEST(CandleRing, ResetSortsCandlesByOpenTime) {
+  CandleRing ring;
+  ring.reset({makeCandle(2, 3), makeCandle(0, 1), makeCandle(1, 2)});
+
+  auto candles = ring.getCandles();
+  ASSERT_EQ(3u, candles.size());
+  EXPECT_EQ(1, candles[0].closePrice_);
+  EXPECT_EQ(2, candles[1].closePrice_);
+  EXPECT_EQ(3, candles[2].closePrice_);
+  EXPECT_TRUE(ring.getLastOpenDate() == makeCandle(2, 0).date_);
+}
+
+TEST(CandleRing, MergePatchesOpenCandle) {
+  CandleRing ring;
+  ring.reset({makeCandle(0, 1), makeCandle(1, 2)});
+
+  EXPECT_TRUE(ring.merge({makeCandle(1, 5)}));
+
+  auto candles = ring.getCandles();
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_EQ(1, candles[0].closePrice_);
+  EXPECT_EQ(5, candles[1].closePrice_);
+}
+
+TEST(CandleRing, MergeAppendsNewCandlesAndKeepsWindowSize) {
+  CandleRing ring;
+  ring.reset({makeCandle(0, 1), makeCandle(1, 2), makeCandle(2, 3)});
+
+  EXPECT_TRUE(ring.merge({makeCandle(4, 7), makeCandle(2, 4), makeCandle(3, 5)}));
+
+  auto candles = ring.getCandles();
+  ASSERT_EQ(3u, candles.size());
+  EXPECT_EQ(4, candles[0].closePrice_);
+  EXPECT_EQ(5, candles[1].closePrice_);
+  EXPECT_EQ(7, candles[2].closePrice_);
+  EXPECT_TRUE(ring.getLastOpenDate() == makeCandle(4, 0).date_);
+}
+
+TEST(CandleRing, MergeSkipsCandlesOlderThanCache) {
+  CandleRing ring;
+  ring.reset({makeCandle(1, 2), makeCandle(2, 3)});
+
+  EXPECT_TRUE(ring.merge({makeCandle(0, 9), makeCandle(1, 9), makeCandle(2, 4)}));
+
+  auto candles = ring.getCandles();
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_EQ(2, candles[0].closePrice_);
+  EXPECT_EQ(4, candles[1].closePrice_);
+}
+
+TEST(CandleRing, MergeRejectsGap) {
+  CandleRing ring;
+  ring.reset({makeCandle(0, 1), makeCandle(1, 2)});
+
+  EXPECT_FALSE(ring.merge({makeCandle(3, 4), makeCandle(4, 5)}));
+
+  auto candles = ring.getCandles();
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_EQ(2, candles[1].closePrice_);
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
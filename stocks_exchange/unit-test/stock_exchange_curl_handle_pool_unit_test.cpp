@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <fstream>
+
+#include "gtest/gtest.h"
+#include "include/curl_handle_pool.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+static std::string createLocalFile(const std::string& name, const std::string& content) {
+  const std::string path = "curl_pool_" + name + ".json";
+  std::ofstream file(path, std::ios::trunc);
+  file << content;
+  return path;
+}
+
+static std::string createFileUrl(const std::string& path) {
+  char* realPath = realpath(path.c_str(), nullptr);
+  std::string url = std::string("file://") + realPath;
+  free(realPath);
+  return url;
+}
+
+TEST(CurlHandlePool, ReleasedHandleIsReused) {
+  CurlHandlePool pool;
+  CURL* firstCurl = nullptr;
+  {
+    auto handle = pool.acquire();
+    firstCurl = handle.get();
+    ASSERT_NE(firstCurl, nullptr);
+    EXPECT_EQ(pool.getIdleCount(), 0);
+  }
+  EXPECT_EQ(pool.getIdleCount(), 1);
+
+  auto handle = pool.acquire();
+  EXPECT_EQ(handle.get(), firstCurl);
+  EXPECT_EQ(pool.getIdleCount(), 0);
+}
+
+TEST(CurlHandlePool, MultiExecutorKeepsResponsesOrder) {
+  const std::vector<std::string> contents = {"{\"balance\":1}", "{\"orders\":[]}",
+                                             "{\"ohlc\":[[1,2,3,4]]}"};
+  std::vector<std::string> paths;
+  for (size_t index = 0; index < contents.size(); ++index) {
+    paths.push_back(createLocalFile(std::to_string(index), contents[index]));
+  }
+
+  CurlHandlePool pool;
+  CurlMultiExecutor executor;
+  std::vector<CurlHandlePool::Handle> handles;
+  std::vector<CURL*> curls;
+  std::vector<std::string> urls;
+  for (const auto& path : paths) {
+    handles.push_back(pool.acquire());
+    urls.push_back(createFileUrl(path));
+    curl_easy_setopt(handles.back().get(), CURLOPT_URL, urls.back().c_str());
+    curls.push_back(handles.back().get());
+  }
+
+  auto responses = executor.perform(curls);
+  EXPECT_EQ(responses, contents);
+
+  // The same handles run again once the previous transfers are removed from the multi handle.
+  EXPECT_EQ(executor.perform(curls), contents);
+
+  for (const auto& path : paths) {
+    std::remove(path.c_str());
+  }
+}
+
+TEST(CurlHandlePool, FailedTransferGivesEmptyResponse) {
+  const std::string path = createLocalFile("valid", "{}");
+  const std::string validUrl = createFileUrl(path);
+  const std::string missingUrl = validUrl + ".missing";
+
+  CurlHandlePool pool;
+  CurlMultiExecutor executor;
+  auto validHandle = pool.acquire();
+  auto missingHandle = pool.acquire();
+  curl_easy_setopt(validHandle.get(), CURLOPT_URL, validUrl.c_str());
+  curl_easy_setopt(missingHandle.get(), CURLOPT_URL, missingUrl.c_str());
+
+  auto responses = executor.perform({missingHandle.get(), validHandle.get()});
+  ASSERT_EQ(responses.size(), 2);
+  EXPECT_TRUE(responses[0].empty());
+  EXPECT_EQ(responses[1], "{}");
+
+  std::remove(path.c_str());
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -295,6 +295,19 @@ TEST_F(HuobiQueryFixture, GetAccountOrderTest) {
   EXPECT_EQ(order, expectedOrder);
 }
 
+TEST_F(HuobiQueryFixture, GetAllAccountOpenOrders_SkipsUnknownPair) {
+  mockHuobiQuery->DelegateToGetAllAccountOpenOrdersResponse();
+
+  std::vector<common::MarketOrder> orders;
+  ASSERT_NO_THROW(orders = mockHuobiQuery->getAllAccountOpenOrders());
+
+  ASSERT_EQ(orders.size(), 1);
+  EXPECT_EQ(orders.front().fromCurrency_, common::Currency::USDT);
+  EXPECT_EQ(orders.front().toCurrency_, common::Currency::ETH);
+  EXPECT_EQ(orders.front().quantity_, 43);
+  EXPECT_EQ(orders.front().orderType_, common::OrderType::BUY);
+}
+
 TEST_F(HuobiQueryFixture, GetMarketHistoryResponse_FakeData) {
   mockHuobiQuery->DelegateToMarketHistoryResponse();
 
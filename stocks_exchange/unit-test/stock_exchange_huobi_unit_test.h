@@ -64,6 +64,50 @@ class FakeHuobiResponse {
     return fakeResponse;
   }
 
+  std::string getAccountsResponse(CURL *curl) const {
+    std::string fakeResponse =
+        "{"
+        "\"status\" : \"ok\","
+        "\"data\" : ["
+        "{"
+        "\"id\" : 100009,"
+        "\"type\" : \"spot\","
+        "\"state\" : \"working\""
+        "}"
+        "]"
+        "}";
+
+    return fakeResponse;
+  }
+
+  // The second order is on a pair missing from the Huobi table, as if placed by hand.
+  std::string getAllAccountOpenOrdersResponse(CURL *curl) const {
+    std::string fakeResponse =
+        "{"
+        "\"status\" : \"ok\","
+        "\"data\" : ["
+        "{"
+        "\"id\" : 59378,"
+        "\"symbol\" : \"ethusdt\","
+        "\"amount\" : \"43\","
+        "\"price\" : \"100.23\","
+        "\"ts\" : 1494901162595,"
+        "\"type\" : \"buy-limit\""
+        "},"
+        "{"
+        "\"id\" : 59379,"
+        "\"symbol\" : \"unknownpair\","
+        "\"amount\" : \"5\","
+        "\"price\" : \"0.5\","
+        "\"ts\" : 1494901162600,"
+        "\"type\" : \"sell-limit\""
+        "}"
+        "]"
+        "}";
+
+    return fakeResponse;
+  }
+
   std::string getMarketHistoryResponse(CURL *curl) const {
     std::string fakeResponse =
         "{ "
@@ -108,6 +152,12 @@ class MockHuobiQuery : public HuobiQuery {
             testing::Invoke(&fake_response_, &FakeHuobiResponse::getMarketHistoryResponse));
   }
 
+  void DelegateToGetAllAccountOpenOrdersResponse() {
+    EXPECT_CALL(*this, sendRequest(::testing::_))
+        .WillOnce(testing::Return(fake_response_.getAccountsResponse(nullptr)))
+        .WillOnce(testing::Return(fake_response_.getAllAccountOpenOrdersResponse(nullptr)));
+  }
+
   void DelegateToGetAccountOrderResponse() {
     ON_CALL(*this, sendRequest(::testing::_))
         .WillByDefault(
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <Poco/JSON/Parser.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "include/kline_parser.h"
+#include "resources/resources.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+// Compares the kline readers with the JSON document parsing the queries used before them.
+// Disabled by default, run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*.
+
+const int benchmarkCandlesCount = 1000;
+const int benchmarkRepetitions = 200;
+
+static common::Date secondsToDate(time_t timestamp) {
+  return common::Date::fromEpochMilliseconds(static_cast<int64_t>(timestamp) * 1000);
+}
+
+static std::string makeBinanceResponse() {
+  std::ostringstream response;
+  response << "[";
+  for (int index = 0; index < benchmarkCandlesCount; ++index) {
+    int64_t openTime = 1546300800000 + index * 60000;
+    response << (index == 0 ? "" : ",") << "[" << openTime << ",\"0.0163" << index % 10
+             << "790\",\"0.01640000\",\"0.01575800\",\"0.01577" << index % 7
+             << "00\",\"148976.11427815\"," << openTime + 59999
+             << ",\"2434.19055334\",308,\"1756.87402397\",\"28.46694368\",\"0\"]";
+  }
+  response << "]";
+  return response.str();
+}
+
+static std::string makePoloniexResponse() {
+  std::ostringstream response;
+  response << "[";
+  for (int index = 0; index < benchmarkCandlesCount; ++index) {
+    response << (index == 0 ? "" : ",") << "{\"date\":" << 1405699200 + index * 300
+             << ",\"high\":0.0045388,\"low\":0.0040300" << index % 10
+             << ",\"open\":0.00404545,\"close\":0.0042759" << index % 9
+             << ",\"volume\":44.11655644,\"quoteVolume\":10259.29079097,"
+                "\"weightedAverage\":0.00429948}";
+  }
+  response << "]";
+  return response.str();
+}
+
+static double measureMilliseconds(const std::function<size_t()>& parse) {
+  size_t candlesCount = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int repetition = 0; repetition < benchmarkRepetitions; ++repetition) {
+    candlesCount += parse();
+  }
+  std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(static_cast<size_t>(benchmarkCandlesCount) * benchmarkRepetitions, candlesCount);
+  return elapsed.count() / benchmarkRepetitions;
+}
+
+static void report(const std::string& exchange, double documentMs, double readerMs) {
+  std::cout << exchange << " " << benchmarkCandlesCount << " candles: JSON document "
+            << documentMs << " ms, kline reader " << readerMs << " ms, speedup "
+            << documentMs / readerMs << "x" << std::endl;
+}
+
+TEST(KlineParserBenchmark, DISABLED_Binance) {
+  const std::string response = makeBinanceResponse();
+
+  double documentMs = measureMilliseconds([&]() {
+    Poco::JSON::Parser parser;
+    auto objects = parser.parse(response).extract<Poco::JSON::Array::Ptr>();
+
+    std::vector<common::MarketData> candles;
+    for (unsigned int index = 0; index < objects->size(); ++index) {
+      auto object = objects->getArray(index);
+
+      common::MarketData candle;
+      time_t timestamp = object->get(resources::binance::BINANCE_TIMESTAMP_INDEX);
+      candle.date_ = secondsToDate(timestamp / 1000);
+      candle.openPrice_ = object->get(resources::binance::BINANCE_OPEN_PRICE_INDEX);
+      candle.closePrice_ = object->get(resources::binance::BINANCE_CLOSE_PRICE_INDEX);
+      candle.lowPrice_ = object->get(resources::binance::BINANCE_LOW_PRICE_INDEX);
+      candle.highPrice_ = object->get(resources::binance::BINANCE_HIGH_PRICE_INDEX);
+      candle.volume_ = object->get(resources::binance::BINANCE_VOLUME_INDEX);
+      candles.push_back(candle);
+    }
+    return candles.size();
+  });
+
+  double readerMs = measureMilliseconds([&]() {
+    std::vector<common::MarketData> candles;
+    kline_parser::parseBinanceKlines(
+        response, [](time_t timestamp) { return secondsToDate(timestamp / 1000); }, candles);
+    return candles.size();
+  });
+
+  report("Binance", documentMs, readerMs);
+}
+
+TEST(KlineParserBenchmark, DISABLED_Poloniex) {
+  const std::string response = makePoloniexResponse();
+
+  double documentMs = measureMilliseconds([&]() {
+    Poco::JSON::Parser parser;
+    auto objects = parser.parse(response).extract<Poco::JSON::Array::Ptr>();
+
+    std::vector<common::MarketData> candles;
+    for (unsigned int index = 0; index < objects->size(); ++index) {
+      auto object = objects->getObject(index);
+
+      common::MarketData candle;
+      time_t timestamp = object->get(resources::poloniex::POLONIEX_DATE);
+      candle.date_ = secondsToDate(timestamp);
+      candle.openPrice_ = object->get(resources::poloniex::POLONIEX_OPEN_PRICE);
+      candle.closePrice_ = object->get(resources::poloniex::POLONIEX_CLOSE_PRICE);
+      candle.lowPrice_ = object->get(resources::poloniex::POLONIEX_LOW_PRICE);
+      candle.highPrice_ = object->get(resources::poloniex::POLONIEX_HIGH_PRICE);
+      candle.volume_ = object->get(resources::poloniex::POLONIEX_VOLUME_PRICE);
+      candles.push_back(candle);
+    }
+    return candles.size();
+  });
+
+  double readerMs = measureMilliseconds([&]() {
+    std::vector<common::MarketData> candles;
+    kline_parser::parsePoloniexKlines(response, secondsToDate, candles);
+    return candles.size();
+  });
+
+  report("Poloniex", documentMs, readerMs);
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "include/kline_parser.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+static common::Date secondsToDate(time_t timestamp) {
+  return common::Date::fromEpochMilliseconds(static_cast<int64_t>(timestamp) * 1000);
+}
+
+static common::Date millisecondsToDate(time_t timestamp) {
+  return common::Date::fromEpochMilliseconds(timestamp);
+}
+
+TEST(KlineParser, BinanceKlines) {
+  const std::string response =
+      "[[1499040000000,\"0.01634790\",\"0.80000000\",\"0.01575800\",\"0.01577100\","
+      "\"148976.11427815\",1499644799999,\"2434.19055334\",308,\"1756.87402397\","
+      "\"28.46694368\",\"17928899.62484339\"],\n"
+      " [1499040060000, \"0.01577100\", \"0.01600000\", \"0.01570000\", \"0.01590000\", "
+      "\"12.5\", 1499040119999, \"0\", 2, \"0\", \"0\", \"0\"]]";
+  std::vector<common::MarketData> candles;
+
+  ASSERT_TRUE(kline_parser::parseBinanceKlines(response, millisecondsToDate, candles));
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_TRUE(candles[0].date_ == millisecondsToDate(1499040000000));
+  EXPECT_EQ(0.01634790, candles[0].openPrice_);
+  EXPECT_EQ(0.80000000, candles[0].highPrice_);
+  EXPECT_EQ(0.01575800, candles[0].lowPrice_);
+  EXPECT_EQ(0.01577100, candles[0].closePrice_);
+  EXPECT_EQ(148976.11427815, candles[0].volume_);
+  EXPECT_TRUE(candles[1].date_ == millisecondsToDate(1499040060000));
+  EXPECT_EQ(0.01590000, candles[1].closePrice_);
+  EXPECT_EQ(12.5, candles[1].volume_);
+}
+
+TEST(KlineParser, BinanceErrorIsLeftToJsonParser) {
+  std::vector<common::MarketData> candles;
+
+  EXPECT_FALSE(kline_parser::parseBinanceKlines("{\"code\":-1121,\"msg\":\"Invalid symbol.\"}",
+                                                millisecondsToDate, candles));
+  EXPECT_FALSE(kline_parser::parseBinanceKlines("[[1499040000000,\"0.1\",\"0.2\"]]",
+                                                millisecondsToDate, candles));
+  EXPECT_FALSE(kline_parser::parseBinanceKlines("[[1499040000000,\"0.1\",\"0.2\",\"0.3\",\"0.4\","
+                                                "\"5\"],", millisecondsToDate, candles));
+  EXPECT_TRUE(candles.empty());
+}
+
+TEST(KlineParser, KrakenKlines) {
+  const std::string response =
+      "{\"error\":[],\"result\":{\"XXBTZUSD\":[[1616662740,\"52591.9\",\"52599.9\",\"52591.8\","
+      "\"52599.9\",\"52599.1\",\"0.11091626\",5],[1616662800,\"52600.0\",\"52674.9\",\"52599.9\","
+      "\"52665.2\",\"52643.3\",\"2.49035996\",30]],\"last\":1616662740}}";
+  std::vector<common::MarketData> candles;
+
+  ASSERT_TRUE(kline_parser::parseKrakenKlines(response, secondsToDate, candles));
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_TRUE(candles[0].date_ == secondsToDate(1616662740));
+  EXPECT_EQ(52591.9, candles[0].openPrice_);
+  EXPECT_EQ(52599.9, candles[0].highPrice_);
+  EXPECT_EQ(52591.8, candles[0].lowPrice_);
+  EXPECT_EQ(52599.9, candles[0].closePrice_);
+  EXPECT_EQ(0.11091626, candles[0].volume_);
+  EXPECT_EQ(2.49035996, candles[1].volume_);
+}
+
+TEST(KlineParser, KrakenErrorIsLeftToJsonParser) {
+  std::vector<common::MarketData> candles;
+
+  EXPECT_FALSE(kline_parser::parseKrakenKlines("{\"error\":[\"EQuery:Unknown asset pair\"]}",
+                                               secondsToDate, candles));
+  EXPECT_TRUE(candles.empty());
+}
+
+TEST(KlineParser, PoloniexKlines) {
+  const std::string response =
+      "[{\"date\":1405699200,\"high\":0.0045388,\"low\":0.00403001,\"open\":0.00404545,"
+      "\"close\":0.00427592,\"volume\":44.11655644,\"quoteVolume\":10259.29079097,"
+      "\"weightedAverage\":0.00429948},{\"date\":1405713600,\"high\":1.5e-7,\"low\":1E-8,"
+      "\"open\":12345678901234567890123,\"close\":-0.5,\"volume\":0,\"quoteVolume\":0,"
+      "\"weightedAverage\":0}]";
+  std::vector<common::MarketData> candles;
+
+  ASSERT_TRUE(kline_parser::parsePoloniexKlines(response, secondsToDate, candles));
+  ASSERT_EQ(2u, candles.size());
+  EXPECT_TRUE(candles[0].date_ == secondsToDate(1405699200));
+  EXPECT_EQ(0.0045388, candles[0].highPrice_);
+  EXPECT_EQ(0.00403001, candles[0].lowPrice_);
+  EXPECT_EQ(0.00404545, candles[0].openPrice_);
+  EXPECT_EQ(0.00427592, candles[0].closePrice_);
+  EXPECT_EQ(44.11655644, candles[0].volume_);
+  EXPECT_EQ(1.5e-7, candles[1].highPrice_);
+  EXPECT_EQ(1e-8, candles[1].lowPrice_);
+  EXPECT_EQ(12345678901234567890123.0, candles[1].openPrice_);
+  EXPECT_EQ(-0.5, candles[1].closePrice_);
+  EXPECT_EQ(0, candles[1].volume_);
+}
+
+TEST(KlineParser, HuobiKlines) {
+  const std::string response =
+      "{\"ch\":\"market.btcusdt.kline.1day\",\"status\":\"ok\",\"ts\":1499223904680,\"data\":["
+      "{\"id\":1499184000,\"amount\":37593.0266,\"count\":0,\"open\":1935.2000,"
+      "\"close\":1879.0000,\"low\":1856.0000,\"high\":1940.0000,\"vol\":71031537.97866500}]}";
+  std::vector<common::MarketData> candles;
+
+  ASSERT_TRUE(kline_parser::parseHuobiKlines(response, secondsToDate, candles));
+  ASSERT_EQ(1u, candles.size());
+  EXPECT_TRUE(candles[0].date_ == secondsToDate(1499184000));
+  EXPECT_EQ(1935.2, candles[0].openPrice_);
+  EXPECT_EQ(1879, candles[0].closePrice_);
+  EXPECT_EQ(1856, candles[0].lowPrice_);
+  EXPECT_EQ(1940, candles[0].highPrice_);
+  EXPECT_EQ(71031537.978665, candles[0].volume_);
+
+  EXPECT_FALSE(kline_parser::parseHuobiKlines(
+      "{\"status\":\"error\",\"err-code\":\"invalid-parameter\",\"data\":[]}", secondsToDate,
+      candles));
+  EXPECT_TRUE(candles.empty());
+}
+
+TEST(KlineParser, BittrexKlines) {
+  const std::string response =
+      "{\"success\":true,\"message\":\"\",\"result\":[{\"O\":0.01,\"H\":0.02,\"L\":0.005,"
+      "\"C\":0.015,\"V\":1200.5,\"T\":\"2019-01-02T03:04:05\",\"BV\":18.0075}]}";
+  std::vector<common::MarketData> candles;
+
+  ASSERT_TRUE(kline_parser::parseBittrexKlines(response, candles));
+  ASSERT_EQ(1u, candles.size());
+  EXPECT_TRUE(candles[0].date_ == common::Date::parseDate("2019-01-02T03:04:05"));
+  EXPECT_EQ(0.01, candles[0].openPrice_);
+  EXPECT_EQ(0.02, candles[0].highPrice_);
+  EXPECT_EQ(0.005, candles[0].lowPrice_);
+  EXPECT_EQ(0.015, candles[0].closePrice_);
+  EXPECT_EQ(18.0075, candles[0].volume_);
+
+  EXPECT_FALSE(kline_parser::parseBittrexKlines(
+      "{\"success\":false,\"message\":\"INVALID_MARKET\",\"result\":null}", candles));
+}
+
+TEST(KlineParser, KlinesIntoCandleSeries) {
+  const std::string response =
+      "[[1499040000000,\"0.01634790\",\"0.80000000\",\"0.01575800\",\"0.01577100\","
+      "\"148976.11427815\",1499644799999,\"2434.19055334\",308,\"1756.87402397\","
+      "\"28.46694368\",\"17928899.62484339\"],\n"
+      " [1499040060000, \"0.01577100\", \"0.01600000\", \"0.01570000\", \"0.01590000\", "
+      "\"12.5\", 1499040119999, \"0\", 2, \"0\", \"0\", \"0\"]]";
+  std::vector<common::MarketData> candles;
+  common::CandleSeries series;
+
+  ASSERT_TRUE(kline_parser::parseBinanceKlines(response, millisecondsToDate, candles));
+  ASSERT_TRUE(kline_parser::parseBinanceKlines(response, millisecondsToDate, series));
+  ASSERT_EQ(candles.size(), series.size());
+  for (size_t index = 0; index < candles.size(); ++index) {
+    EXPECT_TRUE(series.getCandle(index) == candles[index]);
+  }
+  EXPECT_EQ(1499040060000, series.getOpenTimes()[1]);
+  EXPECT_EQ(0.01590000, series.getClosePrices()[1]);
+
+  EXPECT_FALSE(kline_parser::parseHuobiKlines(
+      "{\"status\":\"error\",\"err-code\":\"invalid-parameter\",\"data\":[]}",
+      secondsToDate, series));
+  EXPECT_TRUE(series.empty());
+}
+
+TEST(KlineParser, PricesMatchStandardConversion) {
+  std::mt19937_64 generator(20190101);
+  std::uniform_real_distribution<double> prices(0, 100000);
+  const char* formats[] = {"%.8f", "%.2f", "%.17g", "%.3e"};
+
+  for (int index = 0; index < 10000; ++index) {
+    char price[64];
+    std::snprintf(price, sizeof(price), formats[index % 4], prices(generator));
+
+    std::string response = "[[0,\"" + std::string(price) + "\",1,2,3,4]]";
+    std::vector<common::MarketData> candles;
+    ASSERT_TRUE(kline_parser::parseBinanceKlines(response, millisecondsToDate, candles));
+    EXPECT_EQ(std::strtod(price, nullptr), candles[0].openPrice_) << price;
+  }
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
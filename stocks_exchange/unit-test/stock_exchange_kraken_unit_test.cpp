@@ -214,7 +214,7 @@ TEST_F(KrakenQueryFixture, KrakenQueryFixture_getAccountOpenOrders_TestgetAccoun
 TEST_F(KrakenQueryFixture, KrakenQueryFixture_getNonZeroBalance_TestgetNonZeroBalance) {
   mockKrakenQuery->DelegateToGetBalanceResponse();
 
-  EXPECT_CALL(*mockKrakenQuery, sendRequest(testing::_)).Times(3);
+  EXPECT_CALL(*mockKrakenQuery, sendRequest(testing::_)).Times(1);
 
   auto ADA_balance = mockKrakenQuery->getBalance(common::Currency::ADA);
   auto XRP_balance = mockKrakenQuery->getBalance(common::Currency::XRP);
@@ -276,6 +276,20 @@ TEST_F(KrakenQueryFixture, KrakenQueryFixture_Get_Currency_Tick_Test) {
   EXPECT_EQ(tick.ask_, currencyTickOnFakeResponseXRP_USD_ask);
 }
 
+TEST_F(KrakenQueryFixture, KrakenQueryFixture_Get_All_Ticks_Test) {
+  mockKrakenQuery->DelegateToAllTicksResponse();
+
+  EXPECT_CALL(*mockKrakenQuery, sendRequest(testing::_)).Times(1);
+
+  auto ticks = mockKrakenQuery->getAllTicks(common::Currency::USD);
+
+  ASSERT_EQ(ticks.size(), 3);
+  EXPECT_EQ(ticks.at(common::Currency::ADA).ask_, 0.0496);
+  EXPECT_EQ(ticks.at(common::Currency::BTC).bid_, 10150.0);
+  EXPECT_EQ(ticks.at(common::Currency::XRP).ask_, currencyTickOnFakeResponseXRP_USD_ask);
+  EXPECT_EQ(ticks.at(common::Currency::BTC).toCurrency_, common::Currency::BTC);
+}
+
 }  // namespace unit_test
 }  // namespace stock_exchange
 }  // namespace auto_trader
\ No newline at end of file
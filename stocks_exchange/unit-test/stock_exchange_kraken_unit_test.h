@@ -182,6 +182,23 @@ class FakeKrakenResponse {
     return fake_response;
   }
 
+  std::string getAllTicksResponse(CURL *curl) const {
+    std::string fake_response =
+        "{\"error\":[],"
+        "\"result\":{"
+        "\"ADAUSD\":"
+        "{\"a\":[\"0.04960000\",\"500\",\"500.000\"],"
+        "\"b\":[\"0.04950000\",\"700\",\"700.000\"]},"
+        "\"XXBTZUSD\":"
+        "{\"a\":[\"10150.10000\",\"1\",\"1.000\"],"
+        "\"b\":[\"10150.00000\",\"2\",\"2.000\"]},"
+        "\"XXRPZUSD\":"
+        "{\"a\":[\"0.31699000\",\"2085\",\"2085.000\"],"
+        "\"b\":[\"0.31688000\",\"4000\",\"4000.000\"]}}}";
+
+    return fake_response;
+  }
+
   std::string getOpenedOrders(CURL *curl) const {
     std::string fake_response =
         "{\"error\":[],"
@@ -252,6 +269,11 @@ class MockKrakenQuery : public KrakenQuery {
         .WillByDefault(testing::Invoke(&fake_response_, &FakeKrakenResponse::getCurrencyTick));
   }
 
+  void DelegateToAllTicksResponse() {
+    ON_CALL(*this, sendRequest(::testing::_))
+        .WillByDefault(testing::Invoke(&fake_response_, &FakeKrakenResponse::getAllTicksResponse));
+  }
+
   void DelegateToGetOpenedOrdersResponse() {
     ON_CALL(*this, sendRequest(::testing::_))
         .WillByDefault(testing::Invoke(&fake_response_, &FakeKrakenResponse::getOpenedOrders));
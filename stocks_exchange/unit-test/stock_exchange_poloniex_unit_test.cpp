@@ -26,6 +26,8 @@
 
 #include "stock_exchange_poloniex_unit_test.h"
 
+#include <algorithm>
+
 #include "common/currency.h"
 #include "common/enumerations/stock_exchange_type.h"
 #include "common/exceptions/stock_exchange_exception/invalid_stock_exchange_response_exception.h"
@@ -265,6 +267,22 @@ TEST_F(PoloniexQueryFixture, PoloniexQueryFixture_getAccountOpenOrders_response_
   EXPECT_TRUE(accountOpenOrders.size() > 0);
 }
 
+TEST_F(PoloniexQueryFixture, PoloniexQueryFixture_getAllAccountOpenOrders_response_Test) {
+  mockPoloniexQuery->DelegateToGetAccountOpenOrdersResponse();
+
+  EXPECT_CALL(*mockPoloniexQuery, sendRequest(testing::_)).Times(1);
+
+  auto accountOpenOrders = mockPoloniexQuery->getAllAccountOpenOrders();
+
+  ASSERT_EQ(accountOpenOrders.size(), 4);
+  auto ethOrders = std::count_if(accountOpenOrders.begin(), accountOpenOrders.end(),
+                                 [](const common::MarketOrder& order) {
+                                   return order.fromCurrency_ == common::Currency::BTC &&
+                                          order.toCurrency_ == common::Currency::ETH;
+                                 });
+  EXPECT_EQ(ethOrders, 2);
+}
+
 }  // namespace unit_test
 }  // namespace stock_exchange
 }  // namespace auto_trader
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "include/server_clock.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+const uint64_t resyncPeriod = 1000;
+
+TEST(ServerClock, OffsetIsTakenInTheMiddleOfRoundTrip) {
+  ServerClock clock(resyncPeriod);
+  EXPECT_TRUE(clock.isSyncRequired(0));
+
+  clock.synchronize({{1000, 1600, 1100}}, 1100);
+
+  EXPECT_EQ(clock.getOffset(), 550);
+  EXPECT_EQ(clock.getServerTime(2000), 2550);
+  EXPECT_FALSE(clock.isSyncRequired(1500));
+}
+
+TEST(ServerClock, ShortestRoundTripSampleWins) {
+  ServerClock clock(resyncPeriod);
+
+  clock.synchronize({{1000, 900, 1400}, {2000, 1940, 2020}, {3000, 3000, 3300}}, 3300);
+
+  EXPECT_EQ(clock.getOffset(), -70);
+}
+
+TEST(ServerClock, SyncIsRequiredAfterPeriodOrInvalidation) {
+  ServerClock clock(resyncPeriod);
+  clock.synchronize({{1000, 1000, 1000}}, 1000);
+
+  EXPECT_FALSE(clock.isSyncRequired(1999));
+  EXPECT_TRUE(clock.isSyncRequired(2000));
+
+  clock.synchronize({{2000, 2000, 2000}}, 2000);
+  clock.invalidate();
+  EXPECT_TRUE(clock.isSyncRequired(2001));
+}
+
+TEST(ServerClock, InvalidSamplesKeepPreviousOffset) {
+  ServerClock clock(resyncPeriod);
+  clock.synchronize({{1000, 1200, 1000}}, 1000);
+
+  clock.synchronize({{5000, 9000, 4000}}, 5000);
+
+  EXPECT_EQ(clock.getOffset(), 200);
+  EXPECT_TRUE(clock.isSyncRequired(5000));
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
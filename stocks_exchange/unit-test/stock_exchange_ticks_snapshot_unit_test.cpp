@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "include/ticks_snapshot.h"
+
+namespace auto_trader {
+namespace stock_exchange {
+namespace unit_test {
+
+const uint64_t ticksTimeToLive = 2000;
+
+static common::CurrencyTick makeTick(common::Currency::Enum baseCurrency,
+                                     common::Currency::Enum tradedCurrency, double bid, double ask) {
+  common::CurrencyTick tick;
+  tick.fromCurrency_ = baseCurrency;
+  tick.toCurrency_ = tradedCurrency;
+  tick.bid_ = bid;
+  tick.ask_ = ask;
+  return tick;
+}
+
+TEST(TicksSnapshot, EmptySnapshotIsMissed) {
+  TicksSnapshot snapshot(ticksTimeToLive);
+  CurrencyTicks ticks;
+
+  EXPECT_FALSE(snapshot.get(common::Currency::BTC, 0, ticks));
+  EXPECT_TRUE(ticks.empty());
+}
+
+TEST(TicksSnapshot, SnapshotIsKeptPerBaseCurrency) {
+  TicksSnapshot snapshot(ticksTimeToLive);
+  snapshot.update(common::Currency::BTC,
+                  {{common::Currency::ETH, makeTick(common::Currency::BTC, common::Currency::ETH,
+                                                    0.020, 0.021)}},
+                  1000);
+  snapshot.update(common::Currency::USDT,
+                  {{common::Currency::BTC, makeTick(common::Currency::USDT, common::Currency::BTC,
+                                                    9000.0, 9001.0)}},
+                  1500);
+
+  CurrencyTicks ticks;
+  ASSERT_TRUE(snapshot.get(common::Currency::BTC, 2999, ticks));
+  EXPECT_EQ(ticks.at(common::Currency::ETH).bid_, 0.020);
+  EXPECT_EQ(ticks.count(common::Currency::BTC), 0);
+
+  EXPECT_FALSE(snapshot.get(common::Currency::BTC, 3000, ticks));
+  ASSERT_TRUE(snapshot.get(common::Currency::USDT, 3000, ticks));
+  EXPECT_EQ(ticks.at(common::Currency::BTC).ask_, 9001.0);
+}
+
+TEST(TicksSnapshot, InvalidatedSnapshotIsMissed) {
+  TicksSnapshot snapshot(ticksTimeToLive);
+  snapshot.update(common::Currency::BTC,
+                  {{common::Currency::ETH, makeTick(common::Currency::BTC, common::Currency::ETH,
+                                                    0.020, 0.021)}},
+                  1000);
+  snapshot.invalidate();
+
+  CurrencyTicks ticks;
+  EXPECT_FALSE(snapshot.get(common::Currency::BTC, 1001, ticks));
+}
+
+}  // namespace unit_test
+}  // namespace stock_exchange
+}  // namespace auto_trader
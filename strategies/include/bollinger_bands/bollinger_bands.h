@@ -28,8 +28,10 @@
 #define STRATEGIES_BOLLINGER_BANDS_H
 
 #include <memory>
+#include <utility>
 
 #include "bollinger_bands_base.h"
+#include "bollinger_bands_utils.h"
 #include "bottom_line.h"
 #include "common/market_data.h"
 #include "common/market_order.h"
@@ -41,7 +43,9 @@ namespace strategies {
 
 class BollingerBands : public BollingerBandsBase {
  public:
-  void createLines(const std::vector<common::MarketData>& candles, int period,
+  using BollingerBandsBase::createLines;
+
+  void createLines(const common::CandleSeries& candles, int period,
                    common::BollingerInputType marketDataField,
                    short standartDeviationMultiplier = 2, short crossingInterval = 3,
                    double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) override;
@@ -60,14 +64,18 @@ class BollingerBands : public BollingerBandsBase {
   void setPercentageForBottomLine(short percentage) override;
 
  protected:
-  virtual void crossingToBuySignal(const std::vector<common::MarketData>& candles,
+  virtual void crossingToBuySignal(const common::MarketData& lastCandle,
                                    common::BollingerInputType marketDataField);
-  virtual void crossingToSellSignal(const std::vector<common::MarketData>& candles,
+  virtual void crossingToSellSignal(const common::MarketData& lastCandle,
                                     common::BollingerInputType marketDataField);
 
   bool isBuyCrossingDuplicatedOnInterval();
   bool isSellCrossingDuplicatedOnInterval();
 
+ private:
+  void addBandsPoints(const common::CandleSeries& candles,
+                      common::BollingerInputType marketDataField);
+
  protected:
   TopLine topLine_;
   MiddleLine middleLine_;
@@ -79,6 +87,12 @@ class BollingerBands : public BollingerBandsBase {
   short crossingInterval_{0};
   double lastBuyCrossingPoint_{0};
   double lastSellCrossingPoint_{0};
+
+ private:
+  common::MarketData lastCandle_;
+
+  size_t period_{0};
+  short standartDeviationMultiplier_{0};
 };
 
 }  // namespace strategies
@@ -27,6 +27,7 @@
 #ifndef STRATEGIES_BOLLINGER_BANDS_BASE_H
 #define STRATEGIES_BOLLINGER_BANDS_BASE_H
 
+#include "common/candle_series.h"
 #include "strategies/include/trade_strategy.h"
 
 namespace auto_trader {
@@ -36,11 +37,19 @@ class Line;
 
 class BollingerBandsBase : public TradeStrategy {
  public:
-  virtual void createLines(const std::vector<common::MarketData>& candles, int period,
+  virtual void createLines(const common::CandleSeries& candles, int period,
                            common::BollingerInputType marketDataField,
                            short standartDeviationCount = 2, short crossingInterval = 3,
                            double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) = 0;
 
+  void createLines(const std::vector<common::MarketData>& candles, int period,
+                   common::BollingerInputType marketDataField, short standartDeviationCount = 2,
+                   short crossingInterval = 3, double lastBuyCrossingPoint = 0,
+                   double lastSellCrossingPoint = 0) {
+    createLines(common::CandleSeries(candles), period, marketDataField, standartDeviationCount,
+                crossingInterval, lastBuyCrossingPoint, lastSellCrossingPoint);
+  }
+
   virtual Line getTopLine() const = 0;
   virtual Line getMiddleLine() const = 0;
   virtual Line getBottomLine() const = 0;
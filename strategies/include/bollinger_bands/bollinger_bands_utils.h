@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_BOLLINGER_BANDS_UTILS_H
 #define AUTO_TRADER_BOLLINGER_BANDS_UTILS_H
 
+#include "common/candle_series.h"
 #include "common/enumerations/bollinger_input_type.h"
 #include "common/market_data.h"
 
@@ -62,6 +63,24 @@ static double summationCandleFieldByEnum(const common::MarketData &candle,
   return result;
 }
 
+// Column of the input field, or nullptr for an unknown field, which counts as zero.
+static const double *getCandleField(const common::CandleSeries &candles,
+                                    common::BollingerInputType field) {
+  switch (field) {
+    case common::BollingerInputType::openPosition_:
+      return candles.getOpenPrices();
+    case common::BollingerInputType::closePosition_:
+      return candles.getClosePrices();
+    case common::BollingerInputType::lowPrice_:
+      return candles.getLowPrices();
+    case common::BollingerInputType::highPrice_:
+      return candles.getHighPrices();
+
+    default:
+      return nullptr;
+  }
+}
+
 }  // namespace bollinger_bands_utils
 }  // namespace strategies
 }  // namespace auto_trader
@@ -34,9 +34,8 @@ namespace strategies {
 
 class BottomLine : public Line {
  public:
-  void generateCoordinatesWithStandartDeviation(const Line& middleLine,
-                                                const std::vector<double>& standartDeviation,
-                                                short standartDeviationMultiplier);
+  void addPointWithStandartDeviation(double middlePoint, double standartDeviation,
+                                     short standartDeviationMultiplier);
 };
 
 }  // namespace strategies
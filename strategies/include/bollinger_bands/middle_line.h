@@ -27,19 +27,12 @@
 #ifndef STRATEGIES_MIDDLE_LINE_H
 #define STRATEGIES_MIDDLE_LINE_H
 
-#include "common/enumerations/bollinger_input_type.h"
-#include "common/enumerations/strategies_type.h"
-#include "common/market_data.h"
 #include "strategies/include/line.h"
 
 namespace auto_trader {
 namespace strategies {
 
-class MiddleLine : public Line {
- public:
-  void generateCoordinates(const std::vector<common::MarketData>& candles, int period,
-                           common::BollingerInputType field);
-};
+class MiddleLine : public Line {};
 
 }  // namespace strategies
 }  // namespace auto_trader
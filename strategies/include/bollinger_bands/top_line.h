@@ -35,9 +35,8 @@ namespace strategies {
 
 class TopLine : public Line {
  public:
-  void generateCoordinatesWithStandartDeviation(const Line& middleLine,
-                                                const std::vector<double>& standartDeviation,
-                                                short standartDeviationMultiplier);
+  void addPointWithStandartDeviation(double middlePoint, double standartDeviation,
+                                     short standartDeviationMultiplier);
 };
 
 }  // namespace strategies
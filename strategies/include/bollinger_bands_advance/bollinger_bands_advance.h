@@ -38,9 +38,9 @@ class BollingerBandsAdvance : public BollingerBands {
   void setPercentageForBottomLine(short percentage) override;
 
  protected:
-  void crossingToBuySignal(const std::vector<common::MarketData>& candles,
+  void crossingToBuySignal(const common::MarketData& lastCandle,
                            common::BollingerInputType marketDataField) override;
-  void crossingToSellSignal(const std::vector<common::MarketData>& candles,
+  void crossingToSellSignal(const common::MarketData& lastCandle,
                             common::BollingerInputType marketDataField) override;
 
  private:
@@ -34,13 +34,18 @@ namespace strategies {
 
 class ExponentialMovingAverage : public SimpleMovingAverage {
  public:
-  void createLine(const std::vector<common::MarketData>& marketData, int period,
-                  size_t crossingInterval, double lastBuyCrossingPoint,
-                  double lastSellCrossingPoint) override;
+  using SimpleMovingAverage::createLine;
+
+  void createLine(const common::CandleSeries& candles, int period, size_t crossingInterval,
+                  double lastBuyCrossingPoint, double lastSellCrossingPoint) override;
+
+ private:
+  void foldClosePrice(double closePrice);
 
  private:
-  void calculateEma(const std::vector<common::MarketData>& marketData, unsigned int fromIndex,
-                    unsigned int period);
+  // The first point is the plain average of the first `period` closes.
+  double seedSum_{0};
+  unsigned int seedCount_{0};
 };
 
 }  // namespace strategies
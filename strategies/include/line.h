@@ -37,14 +37,22 @@ class Line {
  public:
   inline void addPoint(double point) { points_.push_back(point); }
 
+  inline void addPoints(const std::vector<double>& points) {
+    points_.insert(points_.end(), points.begin(), points.end());
+  }
+
   inline double getPoint(size_t index) const { return points_.at(index); }
 
+  inline const double* getPoints() const { return points_.data(); }
+
   inline size_t getSize() const { return points_.size(); }
 
   inline bool empty() const { return points_.empty(); }
 
   inline double getLastPoint() const { return points_.back(); }
 
+  inline void removeLastPoint() { points_.pop_back(); }
+
   inline void clear() { points_.clear(); }
 
  protected:
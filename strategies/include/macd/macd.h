@@ -36,7 +36,9 @@ namespace strategies {
 
 class Macd : public MacdBase, public OscillatorBase {
  public:
-  void createLines(const std::vector<common::MarketData>& candles, int fastEmaPeriod = 12,
+  using MacdBase::createLines;
+
+  void createLines(const common::CandleSeries& candles, int fastEmaPeriod = 12,
                    int slowEmaPeriod = 26, int signalPeriod = 9,
                    size_t crossingInterval = 3) override;
 
@@ -50,14 +52,13 @@ class Macd : public MacdBase, public OscillatorBase {
   double getLastBuyCrossingPoint() const override;
   double getLastSellCrossingPoint() const override;
 
+  // MACD line minus signal line, aligned on the newest point.
+  Line getHistogram() const;
+
  private:
   void calculateMacdLine(const auto_trader::strategies::MovingAverageLine& emaFastLine,
                          const auto_trader::strategies::MovingAverageLine& emaSlowLine);
   void calculateSignalLine(int signalPeriod);
-  void calculateMacdHistogram(int linesSizeDifference);
-
- private:
-  Line histogram_;
 };
 
 }  // namespace strategies
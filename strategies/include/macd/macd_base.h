@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_STRATEGIES_MACD_BASE_H
 #define AUTO_TRADER_STRATEGIES_MACD_BASE_H
 
+#include "common/candle_series.h"
 #include "strategies/include/trade_strategy.h"
 
 namespace auto_trader {
@@ -34,9 +35,15 @@ namespace strategies {
 
 class MacdBase : public TradeStrategy {
  public:
-  virtual void createLines(const std::vector<common::MarketData>& candles, int fastEmaPeriod = 12,
+  virtual void createLines(const common::CandleSeries& candles, int fastEmaPeriod = 12,
                            int slowEmaPeriod = 26, int signalPeriod = 9,
                            size_t crossingInterval = 3) = 0;
+
+  void createLines(const std::vector<common::MarketData>& candles, int fastEmaPeriod = 12,
+                   int slowEmaPeriod = 26, int signalPeriod = 9, size_t crossingInterval = 3) {
+    createLines(common::CandleSeries(candles), fastEmaPeriod, slowEmaPeriod, signalPeriod,
+                crossingInterval);
+  }
 };
 
 }  // namespace strategies
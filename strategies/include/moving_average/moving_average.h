@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_STRATEGIES_MOVING_AVERAGE_H
 #define AUTO_TRADER_STRATEGIES_MOVING_AVERAGE_H
 
+#include "common/candle_series.h"
 #include "moving_average_line.h"
 #include "strategies/include/trade_strategy.h"
 
@@ -35,10 +36,17 @@ namespace strategies {
 
 class MovingAverage : public TradeStrategy {
  public:
-  virtual void createLine(const std::vector<common::MarketData>& candles, int period,
+  virtual void createLine(const common::CandleSeries& candles, int period,
                           size_t crossingInterval = 3, double lastBuyCrossingPoint = 0,
                           double lastSellCrossingPoint = 0) = 0;
 
+  void createLine(const std::vector<common::MarketData>& candles, int period,
+                  size_t crossingInterval = 3, double lastBuyCrossingPoint = 0,
+                  double lastSellCrossingPoint = 0) {
+    createLine(common::CandleSeries(candles), period, crossingInterval, lastBuyCrossingPoint,
+               lastSellCrossingPoint);
+  }
+
   virtual const MovingAverageLine& getLine() const = 0;
 };
 
@@ -43,9 +43,6 @@ class MovingAverageBase : public MovingAverage {
 
   const MovingAverageLine& getLine() const override;
 
- protected:
-  void calculateLastMarketData(const std::vector<common::MarketData>& marketData);
-
  protected:
   MovingAverageLine movingAverageLine_;
   common::MarketData latestMarketData_;
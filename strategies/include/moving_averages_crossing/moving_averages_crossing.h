@@ -39,6 +39,9 @@ namespace strategies {
 
 class MovingAveragesCrossing : public TradeStrategy {
  public:
+  void createLines(const common::CandleSeries &candles, int smallerPeriodSize,
+                   int biggerPeriodSize_, double lastBuyCrossingPoint, double lastSellCrossingPoint,
+                   common::MovingAverageType type);
   void createLines(const std::vector<common::MarketData> &marketData, int smallerPeriodSize,
                    int biggerPeriodSize_, double lastBuyCrossingPoint, double lastSellCrossingPoint,
                    common::MovingAverageType type);
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_ROLLING_EXTREMUM_H
+#define AUTO_TRADER_STRATEGIES_ROLLING_EXTREMUM_H
+
+#include <stddef.h>
+#include <deque>
+#include <functional>
+#include <utility>
+
+namespace auto_trader {
+namespace strategies {
+
+// Minimum/maximum of the last `period` values pushed into it, kept in a monotonic deque.
+// Every value enters and leaves the deque once, so a push is amortized O(1) instead of
+// rescanning the window. Shared by indicators that need the lowest low / highest high of a
+// lookback (stochastic %K, Donchian channels, Williams %R).
+template <typename Compare>
+class RollingExtremum {
+ public:
+  explicit RollingExtremum(size_t period) : period_(period) {}
+
+  void add(double value) {
+    if (period_ == 0) return;
+
+    while (!window_.empty() && !compare_(window_.back().second, value)) {
+      window_.pop_back();
+    }
+    window_.emplace_back(index_, value);
+
+    if (window_.front().first + period_ <= index_) {
+      window_.pop_front();
+    }
+    ++index_;
+  }
+
+  void reset() {
+    window_.clear();
+    index_ = 0;
+  }
+
+  inline bool isFull() const { return period_ != 0 && index_ >= period_; }
+  inline size_t getPeriod() const { return period_; }
+
+  inline double getValue() const { return window_.front().second; }
+
+ private:
+  std::deque<std::pair<size_t, double>> window_;
+  size_t period_;
+  size_t index_{0};
+  Compare compare_;
+};
+
+using RollingMinimum = RollingExtremum<std::less<double>>;
+using RollingMaximum = RollingExtremum<std::greater<double>>;
+
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_ROLLING_EXTREMUM_H
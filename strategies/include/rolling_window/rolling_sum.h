@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_ROLLING_SUM_H
+#define AUTO_TRADER_STRATEGIES_ROLLING_SUM_H
+
+#include <stddef.h>
+#include <vector>
+
+namespace auto_trader {
+namespace strategies {
+
+enum class SummationMode { PLAIN, COMPENSATED };
+
+// Running sum that carries the rounding error of every add separately (Neumaier), so adding and
+// removing values over thousands of candles does not drift away from the exact sum.
+class CompensatedSum {
+ public:
+  void add(double value);
+  void reset();
+
+  inline double getSum() const { return sum_ + compensation_; }
+
+ private:
+  double sum_{0};
+  double compensation_{0};
+};
+
+// Sum of the last `period` values pushed into it. Every push is O(1): the value that leaves
+// the window is subtracted instead of re-summing the whole window. In COMPENSATED mode the sum
+// is a CompensatedSum, so long windows do not drift away from the exact sum.
+class RollingSum {
+ public:
+  explicit RollingSum(size_t period, SummationMode mode = SummationMode::COMPENSATED);
+
+  void add(double value);
+  void reset();
+
+  inline bool isFull() const { return period_ != 0 && count_ == period_; }
+  inline size_t getCount() const { return count_; }
+  inline size_t getPeriod() const { return period_; }
+
+  double getSum() const;
+  double getMean() const;
+
+ private:
+  void accumulate(double value);
+
+ private:
+  std::vector<double> window_;
+  size_t period_;
+  size_t head_{0};
+  size_t count_{0};
+
+  SummationMode mode_;
+  double plainSum_{0};
+  CompensatedSum compensatedSum_;
+};
+
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_ROLLING_SUM_H
@@ -29,6 +29,7 @@
 
 #include "common/enumerations/order_type.h"
 #include "rsi_base.h"
+#include "strategies/include/rolling_window/rolling_sum.h"
 
 namespace auto_trader {
 namespace strategies {
@@ -37,9 +38,12 @@ class Rsi : public RsiBase {
  public:
   Rsi();
 
-  void createLine(const std::vector<common::MarketData>& candles, int period,
-                  size_t crossingInterval = 3, double lastBuyCrossingPoint = 0,
-                  double lastSellCrossingPoint = 0) override;
+  using RsiBase::createLine;
+
+  void createLine(const common::CandleSeries& candles, int period, size_t crossingInterval = 3,
+                  double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) override;
+
+  void update(const common::MarketData& candle) override;
 
   Line getRsiLine() const override;
 
@@ -51,10 +55,12 @@ class Rsi : public RsiBase {
 
   void setTopRsiIndex(unsigned int index) override;
   void setBottomRsiIndex(unsigned int index) override;
+  void setSmoothingType(common::RsiSmoothingType type) override;
 
  private:
-  void calculateRsiIndex(const std::vector<common::MarketData>& marketData, unsigned int fromIndex,
-                         unsigned int toIndex);
+  void resetAccumulators(int period);
+  void accumulateClosePrice(double closePrice);
+  void addRsiPoint(double averageGain, double averageLoss);
 
   void crossingToBuySignal();
   void crossingToSellSignal();
@@ -75,6 +81,18 @@ class Rsi : public RsiBase {
   unsigned int bottomRsiIndex_ = {20};
 
   size_t crossingInterval_ = {3};
+
+  common::RsiSmoothingType smoothingType_{common::RsiSmoothingType::SIMPLE};
+  size_t period_{0};
+
+  RollingSum gains_;
+  RollingSum losses_;
+  double averageGain_{0};
+  double averageLoss_{0};
+  size_t differencesCount_{0};
+
+  double lastClosePrice_{0};
+  bool hasLastClosePrice_{false};
 };
 
 }  // namespace strategies
@@ -27,6 +27,8 @@
 #ifndef AUTO_TRADER_STRATEGIES_RSI_BASE_H
 #define AUTO_TRADER_STRATEGIES_RSI_BASE_H
 
+#include "common/candle_series.h"
+#include "common/enumerations/rsi_smoothing_type.h"
 #include "strategies/include/line.h"
 #include "strategies/include/trade_strategy.h"
 
@@ -37,14 +39,24 @@ class Line;
 
 class RsiBase : public TradeStrategy {
  public:
-  virtual void createLine(const std::vector<common::MarketData>& candles, int period,
+  virtual void createLine(const common::CandleSeries& candles, int period,
                           size_t crossingInterval = 3, double lastBuyCrossingPoint = 0,
                           double lastSellCrossingPoint = 0) = 0;
 
+  void createLine(const std::vector<common::MarketData>& candles, int period,
+                  size_t crossingInterval = 3, double lastBuyCrossingPoint = 0,
+                  double lastSellCrossingPoint = 0) {
+    createLine(common::CandleSeries(candles), period, crossingInterval, lastBuyCrossingPoint,
+               lastSellCrossingPoint);
+  }
+
+  virtual void update(const common::MarketData& candle) = 0;
+
   virtual Line getRsiLine() const = 0;
 
   virtual void setTopRsiIndex(unsigned int index) = 0;
   virtual void setBottomRsiIndex(unsigned int index) = 0;
+  virtual void setSmoothingType(common::RsiSmoothingType type) = 0;
 };
 
 }  // namespace strategies
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_INDICATOR_KERNELS_H
+#define AUTO_TRADER_STRATEGIES_INDICATOR_KERNELS_H
+
+#include <stddef.h>
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+
+enum class InstructionSet { SCALAR, AVX2, NEON };
+
+// Column kernels shared by the indicators. The vector paths give each lane its own window and
+// apply the same operations in the same order as the scalar path, so the results are
+// bit-for-bit equal to it, which the unit tests check.
+struct IndicatorKernels {
+  InstructionSet instructionSet_;
+
+  // output[i] = mean of values[i .. i + period), summed with Neumaier compensation; one point
+  // per full window, see getWindowsCount(). The SMA line and the Bollinger middle line.
+  void (*movingAverage)(const double* values, size_t count, size_t period, double* output);
+
+  // output[i] = population standard deviation of values[i .. i + period) around means[i],
+  // where means are the movingAverage() of the same values. The Bollinger bands width.
+  void (*movingStandardDeviation)(const double* values, const double* means, size_t count,
+                                  size_t period, double* output);
+
+  // output[i] = minuend[i] - subtrahend[i]; the MACD line and the MACD histogram.
+  void (*subtract)(const double* minuend, const double* subtrahend, size_t count,
+                   double* output);
+};
+
+// Number of full windows of `period` values in `count` values.
+inline size_t getWindowsCount(size_t count, size_t period) {
+  return period != 0 && count >= period ? count - period + 1 : 0;
+}
+
+const IndicatorKernels& getScalarKernels();
+
+// Fastest kernels the running CPU supports, detected once on first use.
+const IndicatorKernels& getKernels();
+
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_INDICATOR_KERNELS_H
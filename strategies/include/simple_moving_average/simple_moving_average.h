@@ -34,14 +34,12 @@ namespace strategies {
 
 class SimpleMovingAverage : public MovingAverageBase {
  public:
-  void createLine(const std::vector<common::MarketData>& marketData, int period,
-                  size_t crossingInterval, double lastBuyCrossingPoint,
-                  double lastSellCrossingPoint) override;
+  using MovingAverageBase::createLine;
 
- protected:
-  void calculateSma(const std::vector<common::MarketData>& marketData, unsigned int fromIndex,
-                    unsigned int period);
+  void createLine(const common::CandleSeries& candles, int period, size_t crossingInterval,
+                  double lastBuyCrossingPoint, double lastSellCrossingPoint) override;
 
+ protected:
   void crossingToBuySignal();
   void crossingToSellSignal();
 
@@ -40,7 +40,9 @@ class StochasticOscillator : public StochasticOscillatorBase, public OscillatorB
  public:
   StochasticOscillator();
 
-  void createLines(const std::vector<common::MarketData>& candles,
+  using StochasticOscillatorBase::createLines;
+
+  void createLines(const common::CandleSeries& candles,
                    common::StochasticOscillatorType stochasticType, int periodsForClassicLine,
                    int smoothFastPeriod = 3, int smoothSlowPeriod = 3, size_t crossingInterval = 3,
                    double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) override;
@@ -62,13 +64,13 @@ class StochasticOscillator : public StochasticOscillatorBase, public OscillatorB
   bool checkBottomBound(int lineSize) const override;
 
  private:
-  void calculateStochasticLines(const std::vector<common::MarketData>& candles,
+  void calculateStochasticLines(const common::CandleSeries& candles,
                                 int periodsForClassicLine, int smoothFastPeriod,
                                 int smoothSlowPeriod,
                                 common::StochasticOscillatorType stochasticType);
 
  private:
-  Line calculateQuickLineForClassicFormula(const std::vector<common::MarketData>& candles,
+  Line calculateQuickLineForClassicFormula(const common::CandleSeries& candles,
                                            int quickLinePeriod);
   void calculateSmaForQuickLine(const Line& quickLineClassic, int quickPeriod);
   void calculateSmaForSlowLine(const Line& quickLineClassic, int slowPeriod);
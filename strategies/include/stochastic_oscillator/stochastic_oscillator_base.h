@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_STRATEGIES_STOCHASTIC_OSCILLATOR_BASE_H
 #define AUTO_TRADER_STRATEGIES_STOCHASTIC_OSCILLATOR_BASE_H
 
+#include "common/candle_series.h"
 #include "common/enumerations/stochastic_oscillator_type.h"
 #include "strategies/include/line.h"
 #include "strategies/include/trade_strategy.h"
@@ -36,12 +37,21 @@ namespace strategies {
 
 class StochasticOscillatorBase : public TradeStrategy {
  public:
-  virtual void createLines(const std::vector<common::MarketData>& candles,
+  virtual void createLines(const common::CandleSeries& candles,
                            common::StochasticOscillatorType stochasticType,
                            int periodsForClassicLine, int smoothFastPeriod = 3,
                            int smoothSlowPeriod = 3, size_t crossingInterval = 3,
                            double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) = 0;
 
+  void createLines(const std::vector<common::MarketData>& candles,
+                   common::StochasticOscillatorType stochasticType, int periodsForClassicLine,
+                   int smoothFastPeriod = 3, int smoothSlowPeriod = 3, size_t crossingInterval = 3,
+                   double lastBuyCrossingPoint = 0, double lastSellCrossingPoint = 0) {
+    createLines(common::CandleSeries(candles), stochasticType, periodsForClassicLine,
+                smoothFastPeriod, smoothSlowPeriod, crossingInterval, lastBuyCrossingPoint,
+                lastSellCrossingPoint);
+  }
+
   virtual Line getQuickLine() const = 0;
   virtual Line getSlowLine() const = 0;
 
@@ -27,7 +27,10 @@
 #ifndef AUTO_TRADER_STRATEGIES_STRATEGIES_UTILS_H
 #define AUTO_TRADER_STRATEGIES_STRATEGIES_UTILS_H
 
+#include <vector>
+
 #include "line.h"
+#include "simd/indicator_kernels.h"
 
 namespace auto_trader {
 namespace strategies {
@@ -36,22 +39,12 @@ namespace utils {
 static void calculateSma(const Line& inputLine, int period, Line* outLine) {
   outLine->clear();
 
-  auto inputLineSize = inputLine.getSize();
-  double sum = 0.0;
-  int fromPoint = 0;
-
-  for (int index = period; index <= inputLineSize; ++index) {
-    for (int currentPointIndex = fromPoint; currentPointIndex < index; ++currentPointIndex) {
-      auto currentPoint = inputLine.getPoint(currentPointIndex);
-      sum += currentPoint;
-    }
+  if (period <= 0) return;
 
-    double sma = sum / period;
-    outLine->addPoint(sma);
-
-    ++fromPoint;
-    sum = 0.0;
-  }
+  auto inputLineSize = inputLine.getSize();
+  std::vector<double> points(simd::getWindowsCount(inputLineSize, period));
+  simd::getKernels().movingAverage(inputLine.getPoints(), inputLineSize, period, points.data());
+  outLine->addPoints(points);
 }
 
 }  // namespace utils
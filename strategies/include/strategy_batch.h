@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_STRATEGY_BATCH_H
+#define AUTO_TRADER_STRATEGIES_STRATEGY_BATCH_H
+
+#include <functional>
+#include <vector>
+
+#include "common/candle_series.h"
+#include "common/enumerations/strategies_type.h"
+#include "common/market_data.h"
+#include "strategy_facade.h"
+#include "strategy_signal.h"
+#include "trade_strategy.h"
+
+namespace auto_trader {
+namespace strategies {
+
+// Evaluates one strategy configuration over many markets in a single call, e.g. every BTC pair
+// with the same Bollinger Bands settings. Each market is copied into one reused columnar
+// CandleSeries, so the indicator kernels stream its columns without a fresh allocation per
+// market, and the strategy of the facade is reused for all of them. A market whose lines cannot
+// be built gets a signal with isEvaluated_ == false and does not stop the others.
+class StrategyBatch {
+ public:
+  using Markets = std::vector<const std::vector<common::MarketData>*>;
+  using CreateFunction = std::function<void(TradeStrategy&, const common::CandleSeries&)>;
+
+  explicit StrategyBatch(StrategyFacade& strategies);
+
+  // One signal per market, in the order of markets.
+  std::vector<StrategySignal> evaluate(common::StrategiesType type, const Markets& markets,
+                                       const CreateFunction& create);
+  // Evaluates markets[begin, end) into marketSignals[begin, end), which must already be sized.
+  // Batches of different threads may fill disjoint ranges of the same signals.
+  void evaluate(common::StrategiesType type, const Markets& markets, size_t begin, size_t end,
+                const CreateFunction& create, std::vector<StrategySignal>& marketSignals);
+
+ private:
+  void loadCandles(const std::vector<common::MarketData>& marketData);
+
+ private:
+  StrategyFacade& strategies_;
+  common::CandleSeries candles_;
+};
+
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_STRATEGY_BATCH_H
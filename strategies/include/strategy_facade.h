@@ -46,6 +46,9 @@ namespace strategies {
 
 class StrategyFactory;
 
+// Lazily creates and then reuses one strategy of each type. The strategies are mutable and
+// shared by every caller of this facade, so it must not be used from several threads at once;
+// parallel workers lease their own facade from StrategyPool.
 class StrategyFacade {
  public:
   StrategyFacade();
@@ -59,9 +62,9 @@ class StrategyFacade {
   std::shared_ptr<StochasticOscillator> getStochasticOscillatorStrategy();
   std::shared_ptr<Macd> getMacdStrategy();
 
- private:
-  std::shared_ptr<TradeStrategy> getTradeStrategy(common::StrategiesType type);
+  std::shared_ptr<TradeStrategy> getStrategy(common::StrategiesType type);
 
+ private:
   template <typename T>
   std::shared_ptr<T> castStrategy(std::shared_ptr<TradeStrategy> strategy);
 
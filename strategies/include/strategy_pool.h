@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_STRATEGY_POOL_H
+#define AUTO_TRADER_STRATEGIES_STRATEGY_POOL_H
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "strategy_batch.h"
+#include "strategy_facade.h"
+
+namespace auto_trader {
+namespace strategies {
+
+// StrategyFacade hands out one mutable strategy per type, so two threads sharing a facade race
+// on the same lines. The pool gives every worker a context of its own: acquire() leases an idle
+// one, or creates it when all are busy, and the lease returns it on destruction. Contexts are kept
+// for reuse together with their strategies and candle series, which keep their capacity, so a
+// steady worker count costs no allocations after the first cycle. The pool is shared by every
+// trading session and must outlive its leases.
+class StrategyPool {
+ public:
+  // The strategies of one worker and the batch that evaluates markets with them.
+  class Context {
+   public:
+    Context();
+
+    Context(const Context&) = delete;
+    Context& operator=(const Context&) = delete;
+
+    StrategyFacade& getStrategies() { return strategies_; }
+    StrategyBatch& getBatch() { return batch_; }
+
+   private:
+    StrategyFacade strategies_;
+    StrategyBatch batch_;
+  };
+
+  class Lease {
+   public:
+    Lease(Lease&& lease) noexcept;
+    Lease& operator=(Lease&& lease) noexcept;
+    ~Lease();
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    Context& operator*() const { return *context_; }
+    Context* operator->() const { return context_.get(); }
+
+   private:
+    friend class StrategyPool;
+
+    Lease(StrategyPool& pool, std::unique_ptr<Context> context);
+
+    void release();
+
+   private:
+    StrategyPool* pool_;
+    std::unique_ptr<Context> context_;
+  };
+
+  explicit StrategyPool(size_t contextsCount = 0);
+
+  Lease acquire();
+
+  size_t getIdleCount() const;
+
+ private:
+  void release(std::unique_ptr<Context> context);
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<Context>> idleContexts_;
+};
+
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_STRATEGY_POOL_H
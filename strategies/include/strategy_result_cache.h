@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_STRATEGIES_STRATEGY_RESULT_CACHE_H
+#define AUTO_TRADER_STRATEGIES_STRATEGY_RESULT_CACHE_H
+
+#include <stdint.h>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "common/currency.h"
+#include "common/enumerations/stock_exchange_type.h"
+#include "common/enumerations/strategies_type.h"
+#include "common/enumerations/tick_interval.h"
+#include "common/market_data.h"
+#include "strategy_signal.h"
+
+namespace auto_trader {
+namespace strategies {
+
+// Undated candles cannot tell one candle close from the next, so their results are never stored.
+constexpr int64_t UNDATED_CANDLE_TIME = std::numeric_limits<int64_t>::min();
+
+struct StrategyResultKey {
+  common::StockExchangeType stockExchangeType_{common::StockExchangeType::UNKNOWN};
+  common::Currency::Enum baseCurrency_{common::Currency::UNKNOWN};
+  common::Currency::Enum tradedCurrency_{common::Currency::UNKNOWN};
+  common::TickInterval::Enum tickInterval_{common::TickInterval::UNKNOWN};
+  int64_t lastCandleTime_{0};
+  common::StrategiesType strategyType_{common::StrategiesType::UNKNOWN};
+  // Canonical text of the strategy settings. A hit needs the whole text to be equal, so two
+  // different settings can never share a result.
+  std::string settings_;
+
+  bool operator<(const StrategyResultKey& key) const;
+
+  static int64_t getLastCandleTime(const std::vector<common::MarketData>& candles);
+};
+
+// Signals evaluated during one trading cycle. The buying, selling and stop loss processors ask
+// for the same (market, interval, settings) in a cycle; the strategy batch of the cycle stores
+// the signal once and every later request reads it. Only evaluated signals of dated candles are
+// kept, so a failed market is evaluated, and reported, again. Call clear() when the cycle ends.
+// The cache is not locked; the thread running the cycle is the only one that touches it.
+class StrategyResultCache {
+ public:
+  bool find(const StrategyResultKey& key, StrategySignal& signal) const;
+  void insert(const StrategyResultKey& key, const StrategySignal& signal);
+
+  void clear();
+
+  size_t size() const;
+
+ private:
+  std::map<StrategyResultKey, StrategySignal> results_;
+};
+
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_STRATEGIES_STRATEGY_RESULT_CACHE_H
@@ -29,47 +29,13 @@
 #include "common/exceptions/strategy_exception/strategy_exception.h"
 #include "common/loggers/file_logger.h"
 #include "include/bollinger_bands/bollinger_bands_utils.h"
+#include "include/simd/indicator_kernels.h"
 #include "include/stdafx.h"
 
 namespace auto_trader {
 namespace strategies {
 
-std::vector<double> standartDeviation(const std::vector<common::MarketData>& candles, int period) {
-  std::vector<double> standartDeviationList;
-  standartDeviationList.reserve(candles.size() - period);
-
-  int fromCandle = 0;
-  for (int toCandle = period - 1; toCandle < candles.size(); ++toCandle) {
-    double sum = 0;
-
-    for (int j = fromCandle; j <= toCandle; ++j) {
-      sum += candles.at(j).closePrice_;
-    }
-
-    double average = sum / period;
-
-    std::vector<double> candlesMinusAverage;
-    for (int j = fromCandle; j <= toCandle; ++j) {
-      candlesMinusAverage.emplace_back(candles.at(j).closePrice_ - average);
-    }
-
-    for (auto& iterator : candlesMinusAverage) {
-      iterator = std::pow(iterator, 2);
-    }
-
-    sum = std::accumulate(candlesMinusAverage.begin(), candlesMinusAverage.end(), 0.0);
-    sum /= period;
-
-    double result = std::sqrt(sum);
-
-    standartDeviationList.emplace_back(result);
-    ++fromCandle;
-  }
-
-  return standartDeviationList;
-}
-
-void BollingerBands::createLines(const std::vector<common::MarketData>& candles, int period,
+void BollingerBands::createLines(const common::CandleSeries& candles, int period,
                                  common::BollingerInputType marketDataField,
                                  short standartDeviationMultiplier, short crossingInterval,
                                  double lastBuyCrossingPoint, double lastSellCrossingPoint) {
@@ -90,16 +56,52 @@ void BollingerBands::createLines(const std::vector<common::MarketData>& candles,
   lastBuyCrossingPoint_ = lastBuyCrossingPoint;
   lastSellCrossingPoint_ = lastSellCrossingPoint;
 
-  middleLine_.generateCoordinates(candles, period, marketDataField);
+  period_ = period > 0 ? period : 0;
+  standartDeviationMultiplier_ = standartDeviationMultiplier;
+  addBandsPoints(candles, marketDataField);
+  lastCandle_ = candles.getCandle(candles.size() - 1);
+
+  crossingToBuySignal(lastCandle_, marketDataField);
+  crossingToSellSignal(lastCandle_, marketDataField);
+}
 
-  auto standartDeviationList = standartDeviation(candles, period);
-  topLine_.generateCoordinatesWithStandartDeviation(middleLine_, standartDeviationList,
-                                                    standartDeviationMultiplier);
-  bottomLine_.generateCoordinatesWithStandartDeviation(middleLine_, standartDeviationList,
-                                                       standartDeviationMultiplier);
+void BollingerBands::addBandsPoints(const common::CandleSeries& candles,
+                                    common::BollingerInputType marketDataField) {
+  const size_t candlesCount = candles.size();
+  const double* closePrices = candles.getClosePrices();
+  const double* fieldPrices = bollinger_bands_utils::getCandleField(candles, marketDataField);
+
+  // An unknown input field counts as zero on every candle.
+  std::vector<double> zeroPrices;
+  if (!fieldPrices) {
+    zeroPrices.assign(candlesCount, 0);
+    fieldPrices = zeroPrices.data();
+  }
 
-  crossingToBuySignal(candles, marketDataField);
-  crossingToSellSignal(candles, marketDataField);
+  // Each point is computed from its own window alone, so it does not depend on where the
+  // history starts.
+  const auto& kernels = simd::getKernels();
+  const size_t windowsCount = simd::getWindowsCount(candlesCount, period_);
+  std::vector<double> middlePoints(windowsCount);
+  std::vector<double> closePriceAverages(windowsCount);
+  std::vector<double> standartDeviations(windowsCount);
+
+  kernels.movingAverage(fieldPrices, candlesCount, period_, middlePoints.data());
+  if (fieldPrices == closePrices) {
+    closePriceAverages = middlePoints;
+  } else {
+    kernels.movingAverage(closePrices, candlesCount, period_, closePriceAverages.data());
+  }
+  kernels.movingStandardDeviation(closePrices, closePriceAverages.data(), candlesCount, period_,
+                                  standartDeviations.data());
+
+  for (size_t index = 0; index < windowsCount; ++index) {
+    middleLine_.addPoint(middlePoints[index]);
+    topLine_.addPointWithStandartDeviation(middlePoints[index], standartDeviations[index],
+                                           standartDeviationMultiplier_);
+    bottomLine_.addPointWithStandartDeviation(middlePoints[index], standartDeviations[index],
+                                              standartDeviationMultiplier_);
+  }
 }
 
 bool BollingerBands::isNeedToBuy() const { return crossingForBuySignal_.second; }
@@ -120,11 +122,10 @@ void BollingerBands::setPercentageForTopLine(short percentage) {}
 
 void BollingerBands::setPercentageForBottomLine(short percentage) {}
 
-void BollingerBands::crossingToBuySignal(const std::vector<common::MarketData>& candles,
+void BollingerBands::crossingToBuySignal(const common::MarketData& lastCandle,
                                          common::BollingerInputType marketDataField) {
-  auto marketDataSize = candles.size();
-  auto lastMarketDataField = bollinger_bands_utils::summationCandleFieldByEnum(
-      candles.at(marketDataSize - 1), marketDataField);
+  auto lastMarketDataField =
+      bollinger_bands_utils::summationCandleFieldByEnum(lastCandle, marketDataField);
   if (bottomLine_.getLastPoint() > lastMarketDataField) {
     bool isDuplicate = isBuyCrossingDuplicatedOnInterval();
     if (!isDuplicate) {
@@ -138,11 +139,10 @@ void BollingerBands::crossingToBuySignal(const std::vector<common::MarketData>&
   }
 }
 
-void BollingerBands::crossingToSellSignal(const std::vector<common::MarketData>& candles,
+void BollingerBands::crossingToSellSignal(const common::MarketData& lastCandle,
                                           common::BollingerInputType marketDataField) {
-  auto marketDataSize = candles.size();
-  auto lastMarketDataField = bollinger_bands_utils::summationCandleFieldByEnum(
-      candles.at(marketDataSize - 1), marketDataField);
+  auto lastMarketDataField =
+      bollinger_bands_utils::summationCandleFieldByEnum(lastCandle, marketDataField);
   if (topLine_.getLastPoint() < lastMarketDataField) {
     bool isDuplicate = isSellCrossingDuplicatedOnInterval();
     if (!isDuplicate) {
@@ -32,15 +32,9 @@
 namespace auto_trader {
 namespace strategies {
 
-void TopLine::generateCoordinatesWithStandartDeviation(const Line& middleLine,
-                                                       const std::vector<double>& standartDeviation,
-                                                       short standartDeviationMultiplier) {
-  points_.reserve(middleLine.getSize());
-
-  for (int i = 0; i < middleLine.getSize(); ++i) {
-    points_.emplace_back(middleLine.getPoint(i) +
-                         (standartDeviationMultiplier * standartDeviation.at(i)));
-  }
+void TopLine::addPointWithStandartDeviation(double middlePoint, double standartDeviation,
+                                            short standartDeviationMultiplier) {
+  points_.emplace_back(middlePoint + (standartDeviationMultiplier * standartDeviation));
 }
 
 }  // namespace strategies
@@ -38,11 +38,10 @@ void BollingerBandsAdvance::setPercentageForBottomLine(short percentage) {
   percentageForBottomLine_ = percentage;
 }
 
-void BollingerBandsAdvance::crossingToBuySignal(const std::vector<common::MarketData>& candles,
+void BollingerBandsAdvance::crossingToBuySignal(const common::MarketData& lastCandle,
                                                 common::BollingerInputType marketDataField) {
-  auto marketDataSize = candles.size();
-  auto lastMarketDataField = bollinger_bands_utils::summationCandleFieldByEnum(
-      candles.at(marketDataSize - 1), marketDataField);
+  auto lastMarketDataField =
+      bollinger_bands_utils::summationCandleFieldByEnum(lastCandle, marketDataField);
   auto lastPointWithPercentage = calculatePercentagePointBottomLine(
       middleLine_.getLastPoint(), bottomLine_.getLastPoint(), percentageForBottomLine_);
   if (lastPointWithPercentage >= lastMarketDataField) {
@@ -58,11 +57,10 @@ void BollingerBandsAdvance::crossingToBuySignal(const std::vector<common::Market
   }
 }
 
-void BollingerBandsAdvance::crossingToSellSignal(const std::vector<common::MarketData>& candles,
+void BollingerBandsAdvance::crossingToSellSignal(const common::MarketData& lastCandle,
                                                  common::BollingerInputType marketDataField) {
-  auto marketDataSize = candles.size();
-  auto lastMarketDataField = bollinger_bands_utils::summationCandleFieldByEnum(
-      candles.at(marketDataSize - 1), marketDataField);
+  auto lastMarketDataField =
+      bollinger_bands_utils::summationCandleFieldByEnum(lastCandle, marketDataField);
   auto lastPointWithPercentage = calculatePercentagePointToTopLine(
       middleLine_.getLastPoint(), topLine_.getLastPoint(), percentageForTopLine_);
   if (lastPointWithPercentage <= lastMarketDataField) {
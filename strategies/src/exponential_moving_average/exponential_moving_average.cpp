@@ -26,7 +26,6 @@
 
 #include "include/exponential_moving_average/exponential_moving_average.h"
 
-#include "common/exceptions/strategy_exception/small_analyzed_period_exception.h"
 #include "common/exceptions/strategy_exception/strategy_exception.h"
 #include "common/loggers/file_logger.h"
 
@@ -36,28 +35,25 @@ namespace strategies {
 constexpr double CALCULATION_CONSTANT_TWO_FOR_EMA = 2.0;
 constexpr double CALCULATION_CONSTANT_ONE_FOR_EMA = 1.0;
 
-void ExponentialMovingAverage::createLine(const std::vector<common::MarketData>& marketData,
-                                          int period, size_t crossingInterval,
-                                          double lastBuyCrossingPoint,
+void ExponentialMovingAverage::createLine(const common::CandleSeries& candles, int period,
+                                          size_t crossingInterval, double lastBuyCrossingPoint,
                                           double lastSellCrossingPoint) {
   crossingForSellSignal_.second = false;
   crossingForBuySignal_.second = false;
 
-  if (marketData.size() == 0 || marketData.size() < period) {
+  if (candles.size() == 0 || candles.size() < period) {
     common::loggers::FileLogger::getLogger() << "EMA: bad data for creating line";
     throw common::exceptions::StrategyException(
         "Exponential Moving Average: not valid data for creating lines");
   }
 
-  calculateLastMarketData(marketData);
-
   crossingInterval_ = crossingInterval;
   lastBuyCrossingPoint_ = lastBuyCrossingPoint;
   lastSellCrossingPoint_ = lastSellCrossingPoint;
   movingAverageLine_.clear();
   movingAverageLine_.setPeriod(period);
 
-  size_t marketTicksCount = marketData.size();
+  size_t marketTicksCount = candles.size();
   if (marketTicksCount < period)
     throw common::exceptions::StrategyException(
         "Exponential Moving Average: market ticks count less than strategy period");
@@ -66,35 +62,33 @@ void ExponentialMovingAverage::createLine(const std::vector<common::MarketData>&
     throw common::exceptions::StrategyException(
         "Exponential Moving Average:crossing interval bigger than market ticks count");
 
-  for (int index = 0; index < marketTicksCount; ++index) {
-    if ((index + period) > marketTicksCount) {
-      break;
-    }
-    calculateEma(marketData, index, period);
+  seedSum_ = 0;
+  seedCount_ = 0;
+  const double* closePrices = candles.getClosePrices();
+  for (size_t index = 0; index < marketTicksCount; ++index) {
+    foldClosePrice(closePrices[index]);
   }
+  latestMarketData_ = candles.getCandle(marketTicksCount - 1);
 
   crossingToBuySignal();
   crossingToSellSignal();
 }
 
-void ExponentialMovingAverage::calculateEma(const std::vector<common::MarketData>& marketData,
-                                            unsigned int fromIndex, unsigned int period) {
-  if (movingAverageLine_.empty()) {
-    calculateSma(marketData, fromIndex, period);
+void ExponentialMovingAverage::foldClosePrice(double closePrice) {
+  const unsigned int period = movingAverageLine_.getPeriod();
+  if (seedCount_ < period) {
+    seedSum_ += closePrice;
+    ++seedCount_;
+    if (seedCount_ == period) {
+      movingAverageLine_.addPoint(seedSum_ / period);
+    }
     return;
   }
 
   double emaMultiplier =
       CALCULATION_CONSTANT_TWO_FOR_EMA / (period + CALCULATION_CONSTANT_ONE_FOR_EMA);
-  unsigned int toPeriod = fromIndex + period;
-
-  if (marketData.size() < toPeriod) {
-    throw common::exceptions::SmallAnalyzedPeriodException(std::to_string(marketData.size()));
-  }
-
-  double ema =
-      (marketData[toPeriod - 1].closePrice_ - movingAverageLine_.getLastPoint()) * emaMultiplier +
-      movingAverageLine_.getLastPoint();
+  double ema = (closePrice - movingAverageLine_.getLastPoint()) * emaMultiplier +
+               movingAverageLine_.getLastPoint();
   movingAverageLine_.addPoint(ema);
 }
 
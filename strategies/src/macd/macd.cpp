@@ -30,6 +30,7 @@
 #include "common/exceptions/strategy_exception/not_correct_lines_size_exception.h"
 #include "include/exponential_moving_average/exponential_moving_average.h"
 #include "include/strategies_utils.h"
+#include "strategies/include/simd/indicator_kernels.h"
 
 namespace auto_trader {
 namespace strategies {
@@ -56,13 +57,13 @@ void Macd::calculateMacdLine(const auto_trader::strategies::MovingAverageLine& e
     throw common::exceptions::NotCorrectLinesSizeException("MACD: not correct lines size");
   }
 
-  for (int index = 0; index < slowEmaLineSize; ++index) {
-    double point = emaFastLine_.getPoint(index + periodDifference) - emaSlowLine_.getPoint(index);
-    mainLine_.addPoint(point);
-  }
+  std::vector<double> points(slowEmaLineSize);
+  simd::getKernels().subtract(emaFastLine_.getPoints() + periodDifference,
+                              emaSlowLine_.getPoints(), points.size(), points.data());
+  mainLine_.addPoints(points);
 }
 
-void Macd::createLines(const std::vector<common::MarketData>& candles, int fastEmaPeriod,
+void Macd::createLines(const common::CandleSeries& candles, int fastEmaPeriod,
                        int slowEmaPeriod, int signalSmaPeriod, size_t crossingInterval) {
   if (fastEmaPeriod >= slowEmaPeriod) {
     throw common::exceptions::BadPeriodsForLinesException("MACD: bad periods for lines");
@@ -91,12 +92,16 @@ void Macd::calculateSignalLine(int signalSmaPeriod) {
   utils::calculateSma(mainLine_, signalSmaPeriod, &signalOscillatorLine_);
 }
 
-void Macd::calculateMacdHistogram(int linesSizeDifference) {
-  for (int index = 0; index < signalOscillatorLine_.getSize(); ++index) {
-    double point =
-        histogram_.getPoint(index + linesSizeDifference) - signalOscillatorLine_.getPoint(index);
-    histogram_.addPoint(point);
-  }
+Line Macd::getHistogram() const {
+  const size_t linesSizeDifference = mainLine_.getSize() - signalOscillatorLine_.getSize();
+
+  std::vector<double> points(signalOscillatorLine_.getSize());
+  simd::getKernels().subtract(mainLine_.getPoints() + linesSizeDifference,
+                              signalOscillatorLine_.getPoints(), points.size(), points.data());
+
+  Line histogram;
+  histogram.addPoints(points);
+  return histogram;
 }
 
 }  // namespace strategies
@@ -29,12 +29,6 @@
 namespace auto_trader {
 namespace strategies {
 
-void MovingAverageBase::calculateLastMarketData(
-    const std::vector<auto_trader::common::MarketData> &marketData) {
-  auto marketDataSize = marketData.size();
-  latestMarketData_ = marketData.at(marketDataSize - 1);
-}
-
 const MovingAverageLine &MovingAverageBase::getLine() const { return movingAverageLine_; }
 
 bool MovingAverageBase::isNeedToBuy() const { return crossingForBuySignal_.second; }
@@ -42,10 +42,18 @@ void MovingAveragesCrossing::createLines(const std::vector<common::MarketData> &
                                          int smallerPeriodSize, int biggerPeriodSize,
                                          double lastBuyCrossingPoint, double lastSellCrossingPoint,
                                          common::MovingAverageType type) {
+  createLines(common::CandleSeries(marketData), smallerPeriodSize, biggerPeriodSize,
+              lastBuyCrossingPoint, lastSellCrossingPoint, type);
+}
+
+void MovingAveragesCrossing::createLines(const common::CandleSeries &candles,
+                                         int smallerPeriodSize, int biggerPeriodSize,
+                                         double lastBuyCrossingPoint, double lastSellCrossingPoint,
+                                         common::MovingAverageType type) {
   crossingForSellSignal_.second = false;
   crossingForBuySignal_.second = false;
 
-  if (marketData.size() == 0 || marketData.size() < biggerPeriodSize) {
+  if (candles.size() == 0 || candles.size() < biggerPeriodSize) {
     common::loggers::FileLogger::getLogger() << "MAC: bad data for creating lines.";
     throw common::exceptions::StrategyException(
         "Moving Averages Crossing: not valid data for creating lines");
@@ -56,10 +64,10 @@ void MovingAveragesCrossing::createLines(const std::vector<common::MarketData> &
 
   auto movingAveragePtr = createMovingAverage(type);
 
-  movingAveragePtr->createLine(marketData, smallerPeriodSize);
+  movingAveragePtr->createLine(candles, smallerPeriodSize);
   smallerPeriodLine_ = movingAveragePtr->getLine();
 
-  movingAveragePtr->createLine(marketData, biggerPeriodSize);
+  movingAveragePtr->createLine(candles, biggerPeriodSize);
   biggerPeriodLine_ = movingAveragePtr->getLine();
 
   crossingToBuySignal();
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/rolling_window/rolling_sum.h"
+
+#include "include/stdafx.h"
+
+namespace auto_trader {
+namespace strategies {
+
+void CompensatedSum::add(double value) {
+  double total = sum_ + value;
+  if (std::fabs(sum_) >= std::fabs(value)) {
+    compensation_ += (sum_ - total) + value;
+  } else {
+    compensation_ += (value - total) + sum_;
+  }
+  sum_ = total;
+}
+
+void CompensatedSum::reset() {
+  sum_ = 0;
+  compensation_ = 0;
+}
+
+RollingSum::RollingSum(size_t period, SummationMode mode)
+    : window_(period, 0.0), period_(period), mode_(mode) {}
+
+void RollingSum::add(double value) {
+  if (period_ == 0) return;
+
+  if (isFull()) {
+    accumulate(-window_[head_]);
+  } else {
+    ++count_;
+  }
+
+  window_[head_] = value;
+  head_ = (head_ + 1) % period_;
+
+  accumulate(value);
+}
+
+void RollingSum::reset() {
+  head_ = 0;
+  count_ = 0;
+  plainSum_ = 0;
+  compensatedSum_.reset();
+}
+
+double RollingSum::getSum() const {
+  return mode_ == SummationMode::PLAIN ? plainSum_ : compensatedSum_.getSum();
+}
+
+double RollingSum::getMean() const { return count_ == 0 ? 0.0 : getSum() / count_; }
+
+void RollingSum::accumulate(double value) {
+  if (mode_ == SummationMode::PLAIN) {
+    plainSum_ += value;
+    return;
+  }
+
+  compensatedSum_.add(value);
+}
+
+}  // namespace strategies
+}  // namespace auto_trader
@@ -35,15 +35,21 @@ namespace strategies {
 constexpr int DEFAULT_TOP_RSI_INDEX = 70;
 constexpr int DEFAULT_BOTTOM_RSI_INDEX = 30;
 
-Rsi::Rsi() : topRsiIndex_(DEFAULT_TOP_RSI_INDEX), bottomRsiIndex_(DEFAULT_BOTTOM_RSI_INDEX) {}
+constexpr double NEUTRAL_RSI_POINT = 50.0;
+constexpr double MAX_RSI_POINT = 100.0;
 
-void Rsi::createLine(const std::vector<common::MarketData>& marketData, int period,
-                     size_t crossingInterval, double lastBuyCrossingPoint,
-                     double lastSellCrossingPoint) {
+Rsi::Rsi()
+    : topRsiIndex_(DEFAULT_TOP_RSI_INDEX),
+      bottomRsiIndex_(DEFAULT_BOTTOM_RSI_INDEX),
+      gains_(0),
+      losses_(0) {}
+
+void Rsi::createLine(const common::CandleSeries& candles, int period, size_t crossingInterval,
+                     double lastBuyCrossingPoint, double lastSellCrossingPoint) {
   crossingForBuySignal_.second = false;
   crossingForSellSignal_.second = false;
 
-  if (marketData.size() < period) {
+  if (candles.size() < period) {
     common::loggers::FileLogger::getLogger() << "RSI: bad data for creating line.";
     throw common::exceptions::StrategyException("RSI: not valid data for creating lines");
   }
@@ -53,13 +59,31 @@ void Rsi::createLine(const std::vector<common::MarketData>& marketData, int peri
   crossingInterval_ = crossingInterval;
 
   rsiLine_.clear();
+  resetAccumulators(period);
+
+  const double* closePrices = candles.getClosePrices();
+  for (size_t index = 0; index < candles.size(); ++index) {
+    accumulateClosePrice(closePrices[index]);
+  }
+
+  if (rsiLine_.empty()) return;
+
+  crossingToBuySignal();
+  crossingToSellSignal();
+}
 
-  int fromBound = 1;
-  for (int index = period; index < marketData.size(); ++index) {
-    calculateRsiIndex(marketData, fromBound, index);
-    ++fromBound;
+void Rsi::update(const common::MarketData& candle) {
+  if (period_ == 0) {
+    throw common::exceptions::StrategyException("RSI: line is not created before update");
   }
 
+  crossingForBuySignal_.second = false;
+  crossingForSellSignal_.second = false;
+
+  auto lineSize = rsiLine_.getSize();
+  accumulateClosePrice(candle.closePrice_);
+  if (rsiLine_.getSize() == lineSize) return;
+
   crossingToBuySignal();
   crossingToSellSignal();
 }
@@ -74,20 +98,64 @@ double Rsi::getLastBuyCrossingPoint() const { return lastBuyCrossingPoint_; }
 
 double Rsi::getLastSellCrossingPoint() const { return lastSellCrossingPoint_; }
 
-void Rsi::calculateRsiIndex(const std::vector<common::MarketData>& marketData,
-                            unsigned int fromIndex, unsigned int toIndex) {
-  double positiveDifference = 0.0;
-  double negativeDifference = 0.0;
-  for (unsigned int index = fromIndex; index <= toIndex; ++index) {
-    if (marketData.at(index - 1).closePrice_ < marketData.at(index).closePrice_) {
-      positiveDifference += marketData.at(index).closePrice_ - marketData.at(index - 1).closePrice_;
+void Rsi::resetAccumulators(int period) {
+  period_ = period;
+  gains_ = RollingSum(period);
+  losses_ = RollingSum(period);
+  averageGain_ = 0;
+  averageLoss_ = 0;
+  differencesCount_ = 0;
+  hasLastClosePrice_ = false;
+}
+
+void Rsi::accumulateClosePrice(double closePrice) {
+  if (!hasLastClosePrice_) {
+    lastClosePrice_ = closePrice;
+    hasLastClosePrice_ = true;
+    return;
+  }
+
+  double difference = closePrice - lastClosePrice_;
+  lastClosePrice_ = closePrice;
+
+  double gain = (difference > 0) ? difference : 0.0;
+  double loss = (difference < 0) ? -difference : 0.0;
+  ++differencesCount_;
+
+  if (smoothingType_ == common::RsiSmoothingType::WILDER) {
+    if (differencesCount_ < period_) {
+      averageGain_ += gain;
+      averageLoss_ += loss;
+      return;
+    }
+
+    if (differencesCount_ == period_) {
+      averageGain_ = (averageGain_ + gain) / period_;
+      averageLoss_ = (averageLoss_ + loss) / period_;
     } else {
-      negativeDifference += marketData.at(index - 1).closePrice_ - marketData.at(index).closePrice_;
+      averageGain_ = (averageGain_ * (period_ - 1) + gain) / period_;
+      averageLoss_ = (averageLoss_ * (period_ - 1) + loss) / period_;
     }
+
+    addRsiPoint(averageGain_, averageLoss_);
+    return;
   }
 
-  auto fraction = positiveDifference / negativeDifference;
-  auto rsiPoint = 100 - (100 / (1 + fraction));
+  gains_.add(gain);
+  losses_.add(loss);
+  if (gains_.isFull()) {
+    addRsiPoint(gains_.getSum(), losses_.getSum());
+  }
+}
+
+void Rsi::addRsiPoint(double averageGain, double averageLoss) {
+  if (averageLoss <= 0) {
+    rsiLine_.addPoint(averageGain > 0 ? MAX_RSI_POINT : NEUTRAL_RSI_POINT);
+    return;
+  }
+
+  auto fraction = averageGain / averageLoss;
+  auto rsiPoint = MAX_RSI_POINT - (MAX_RSI_POINT / (1 + fraction));
 
   rsiLine_.addPoint(rsiPoint);
 }
@@ -146,5 +214,7 @@ void Rsi::setTopRsiIndex(unsigned int index) { topRsiIndex_ = index; }
 
 void Rsi::setBottomRsiIndex(unsigned int index) { bottomRsiIndex_ = index; }
 
+void Rsi::setSmoothingType(common::RsiSmoothingType type) { smoothingType_ = type; }
+
 }  // namespace strategies
 }  // namespace auto_trader
\ No newline at end of file
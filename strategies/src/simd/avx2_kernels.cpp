@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/simd/indicator_kernels.h"
+
+#include "include/simd/kernels_detail.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AUTO_TRADER_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AUTO_TRADER_AVX2_TARGET
+#endif
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace {
+
+constexpr size_t LANES_COUNT = 4;
+
+// Lane i holds the window starting at values[window + i]; the windows left over past the last
+// full vector go through the scalar kernel.
+AUTO_TRADER_AVX2_TARGET void movingAverage(const double* values, size_t count, size_t period,
+                                           double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  const __m256d signMask = _mm256_set1_pd(-0.0);
+  const __m256d divisor = _mm256_set1_pd(static_cast<double>(period));
+
+  size_t window = 0;
+  for (; window + LANES_COUNT <= windowsCount; window += LANES_COUNT) {
+    __m256d sum = _mm256_setzero_pd();
+    __m256d compensation = _mm256_setzero_pd();
+    for (size_t index = 0; index < period; ++index) {
+      const __m256d value = _mm256_loadu_pd(values + window + index);
+      const __m256d total = _mm256_add_pd(sum, value);
+      // Neumaier: both branches of CompensatedSum::add, picked per lane.
+      const __m256d isSumLarger = _mm256_cmp_pd(_mm256_andnot_pd(signMask, sum),
+                                                _mm256_andnot_pd(signMask, value), _CMP_GE_OQ);
+      const __m256d sumLarger = _mm256_add_pd(_mm256_sub_pd(sum, total), value);
+      const __m256d valueLarger = _mm256_add_pd(_mm256_sub_pd(value, total), sum);
+      compensation = _mm256_add_pd(compensation,
+                                   _mm256_blendv_pd(valueLarger, sumLarger, isSumLarger));
+      sum = total;
+    }
+    _mm256_storeu_pd(output + window, _mm256_div_pd(_mm256_add_pd(sum, compensation), divisor));
+  }
+
+  if (window < windowsCount) {
+    getScalarKernels().movingAverage(values + window, count - window, period, output + window);
+  }
+}
+
+AUTO_TRADER_AVX2_TARGET void movingStandardDeviation(const double* values, const double* means,
+                                                     size_t count, size_t period,
+                                                     double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  const __m256d divisor = _mm256_set1_pd(static_cast<double>(period));
+
+  size_t window = 0;
+  for (; window + LANES_COUNT <= windowsCount; window += LANES_COUNT) {
+    const __m256d mean = _mm256_loadu_pd(means + window);
+    __m256d squaredDeviationsSum = _mm256_setzero_pd();
+    for (size_t index = 0; index < period; ++index) {
+      const __m256d deviation = _mm256_sub_pd(_mm256_loadu_pd(values + window + index), mean);
+      squaredDeviationsSum =
+          _mm256_add_pd(squaredDeviationsSum, _mm256_mul_pd(deviation, deviation));
+    }
+    _mm256_storeu_pd(output + window,
+                     _mm256_sqrt_pd(_mm256_div_pd(squaredDeviationsSum, divisor)));
+  }
+
+  if (window < windowsCount) {
+    getScalarKernels().movingStandardDeviation(values + window, means + window, count - window,
+                                               period, output + window);
+  }
+}
+
+AUTO_TRADER_AVX2_TARGET void subtract(const double* minuend, const double* subtrahend,
+                                      size_t count, double* output) {
+  size_t index = 0;
+  for (; index + LANES_COUNT <= count; index += LANES_COUNT) {
+    _mm256_storeu_pd(output + index, _mm256_sub_pd(_mm256_loadu_pd(minuend + index),
+                                                   _mm256_loadu_pd(subtrahend + index)));
+  }
+
+  for (; index < count; ++index) {
+    output[index] = minuend[index] - subtrahend[index];
+  }
+}
+
+const IndicatorKernels avx2Kernels = {InstructionSet::AVX2, movingAverage,
+                                       movingStandardDeviation, subtract};
+
+}  // namespace
+
+namespace detail {
+
+const IndicatorKernels* getAvx2Kernels() { return &avx2Kernels; }
+
+}  // namespace detail
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
+
+#else
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace detail {
+
+const IndicatorKernels* getAvx2Kernels() { return nullptr; }
+
+}  // namespace detail
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/simd/indicator_kernels.h"
+
+#include "include/simd/kernels_detail.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace {
+
+bool isAvx2Supported() {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#elif defined(_MSC_VER) && defined(_M_X64)
+  int registers[4];
+  __cpuid(registers, 0);
+  if (registers[0] < 7) {
+    return false;
+  }
+
+  __cpuid(registers, 1);
+  const bool isOsSavingYmm = (registers[2] & (1 << 27)) && ((_xgetbv(0) & 0x6) == 0x6);
+  if (!isOsSavingYmm) {
+    return false;
+  }
+
+  __cpuidex(registers, 7, 0);
+  return (registers[1] & (1 << 5)) != 0;
+#else
+  return false;
+#endif
+}
+
+const IndicatorKernels& selectKernels() {
+  if (const IndicatorKernels* neonKernels = detail::getNeonKernels()) {
+    return *neonKernels;
+  }
+
+  const IndicatorKernels* avx2Kernels = detail::getAvx2Kernels();
+  if (avx2Kernels && isAvx2Supported()) {
+    return *avx2Kernels;
+  }
+
+  return getScalarKernels();
+}
+
+}  // namespace
+
+const IndicatorKernels& getKernels() {
+  static const IndicatorKernels& kernels = selectKernels();
+  return kernels;
+}
+
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/simd/indicator_kernels.h"
+
+#include "include/simd/kernels_detail.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+#include <arm_neon.h>
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace {
+
+constexpr size_t LANES_COUNT = 2;
+
+// Lane i holds the window starting at values[window + i]; the windows left over past the last
+// full vector go through the scalar kernel.
+void movingAverage(const double* values, size_t count, size_t period, double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  const float64x2_t divisor = vdupq_n_f64(static_cast<double>(period));
+
+  size_t window = 0;
+  for (; window + LANES_COUNT <= windowsCount; window += LANES_COUNT) {
+    float64x2_t sum = vdupq_n_f64(0);
+    float64x2_t compensation = vdupq_n_f64(0);
+    for (size_t index = 0; index < period; ++index) {
+      const float64x2_t value = vld1q_f64(values + window + index);
+      const float64x2_t total = vaddq_f64(sum, value);
+      // Neumaier: both branches of CompensatedSum::add, picked per lane.
+      const uint64x2_t isSumLarger = vcgeq_f64(vabsq_f64(sum), vabsq_f64(value));
+      const float64x2_t sumLarger = vaddq_f64(vsubq_f64(sum, total), value);
+      const float64x2_t valueLarger = vaddq_f64(vsubq_f64(value, total), sum);
+      compensation = vaddq_f64(compensation, vbslq_f64(isSumLarger, sumLarger, valueLarger));
+      sum = total;
+    }
+    vst1q_f64(output + window, vdivq_f64(vaddq_f64(sum, compensation), divisor));
+  }
+
+  if (window < windowsCount) {
+    getScalarKernels().movingAverage(values + window, count - window, period, output + window);
+  }
+}
+
+void movingStandardDeviation(const double* values, const double* means, size_t count,
+                             size_t period, double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  const float64x2_t divisor = vdupq_n_f64(static_cast<double>(period));
+
+  size_t window = 0;
+  for (; window + LANES_COUNT <= windowsCount; window += LANES_COUNT) {
+    const float64x2_t mean = vld1q_f64(means + window);
+    float64x2_t squaredDeviationsSum = vdupq_n_f64(0);
+    for (size_t index = 0; index < period; ++index) {
+      const float64x2_t deviation = vsubq_f64(vld1q_f64(values + window + index), mean);
+      squaredDeviationsSum = vaddq_f64(squaredDeviationsSum, vmulq_f64(deviation, deviation));
+    }
+    vst1q_f64(output + window, vsqrtq_f64(vdivq_f64(squaredDeviationsSum, divisor)));
+  }
+
+  if (window < windowsCount) {
+    getScalarKernels().movingStandardDeviation(values + window, means + window, count - window,
+                                               period, output + window);
+  }
+}
+
+void subtract(const double* minuend, const double* subtrahend, size_t count, double* output) {
+  size_t index = 0;
+  for (; index + LANES_COUNT <= count; index += LANES_COUNT) {
+    vst1q_f64(output + index,
+              vsubq_f64(vld1q_f64(minuend + index), vld1q_f64(subtrahend + index)));
+  }
+
+  for (; index < count; ++index) {
+    output[index] = minuend[index] - subtrahend[index];
+  }
+}
+
+const IndicatorKernels neonKernels = {InstructionSet::NEON, movingAverage,
+                                       movingStandardDeviation, subtract};
+
+}  // namespace
+
+namespace detail {
+
+const IndicatorKernels* getNeonKernels() { return &neonKernels; }
+
+}  // namespace detail
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
+
+#else
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace detail {
+
+const IndicatorKernels* getNeonKernels() { return nullptr; }
+
+}  // namespace detail
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/simd/indicator_kernels.h"
+
+#include <cmath>
+
+#include "include/rolling_window/rolling_sum.h"
+#include "include/simd/kernels_detail.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace simd {
+namespace {
+
+void movingAverage(const double* values, size_t count, size_t period, double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  for (size_t window = 0; window < windowsCount; ++window) {
+    CompensatedSum sum;
+    for (size_t index = 0; index < period; ++index) {
+      sum.add(values[window + index]);
+    }
+    output[window] = sum.getSum() / period;
+  }
+}
+
+void movingStandardDeviation(const double* values, const double* means, size_t count,
+                             size_t period, double* output) {
+  const size_t windowsCount = getWindowsCount(count, period);
+  for (size_t window = 0; window < windowsCount; ++window) {
+    double squaredDeviationsSum = 0;
+    for (size_t index = 0; index < period; ++index) {
+      const double deviation = values[window + index] - means[window];
+      squaredDeviationsSum += deviation * deviation;
+    }
+    output[window] = std::sqrt(squaredDeviationsSum / period);
+  }
+}
+
+void subtract(const double* minuend, const double* subtrahend, size_t count, double* output) {
+  for (size_t index = 0; index < count; ++index) {
+    output[index] = minuend[index] - subtrahend[index];
+  }
+}
+
+const IndicatorKernels scalarKernels = {InstructionSet::SCALAR, movingAverage,
+                                         movingStandardDeviation, subtract};
+
+}  // namespace
+
+const IndicatorKernels& getScalarKernels() { return scalarKernels; }
+
+}  // namespace simd
+}  // namespace strategies
+}  // namespace auto_trader
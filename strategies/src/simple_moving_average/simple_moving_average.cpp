@@ -28,17 +28,18 @@
 
 #include "common/exceptions/strategy_exception/strategy_exception.h"
 #include "common/loggers/file_logger.h"
+#include "include/simd/indicator_kernels.h"
 
 namespace auto_trader {
 namespace strategies {
 
-void SimpleMovingAverage::createLine(const std::vector<common::MarketData>& marketData, int period,
+void SimpleMovingAverage::createLine(const common::CandleSeries& candles, int period,
                                      size_t crossingInterval, double lastBuyCrossingPoint,
                                      double lastSellCrossingPoint) {
   crossingForBuySignal_.second = false;
   crossingForSellSignal_.second = false;
 
-  size_t marketTicksCount = marketData.size();
+  size_t marketTicksCount = candles.size();
 
   if (marketTicksCount < period) {
     common::loggers::FileLogger::getLogger() << "SMA: bad data for creating line.";
@@ -46,36 +47,25 @@ void SimpleMovingAverage::createLine(const std::vector<common::MarketData>& mark
         "Simple Moving Average: not valid data for creating lines");
   }
 
-  calculateLastMarketData(marketData);
-
   lastBuyCrossingPoint_ = lastBuyCrossingPoint;
   lastSellCrossingPoint_ = lastSellCrossingPoint;
   crossingInterval_ = crossingInterval;
   movingAverageLine_.clear();
-
-  for (int index = 0; index < marketTicksCount; ++index) {
-    if ((index + period) > marketTicksCount) {
-      break;
-    }
-    calculateSma(marketData, index, period);
+  movingAverageLine_.setPeriod(period);
+
+  const size_t windowPeriod = period > 0 ? period : 0;
+  std::vector<double> points(simd::getWindowsCount(marketTicksCount, windowPeriod));
+  simd::getKernels().movingAverage(candles.getClosePrices(), marketTicksCount, windowPeriod,
+                                   points.data());
+  movingAverageLine_.addPoints(points);
+  if (marketTicksCount != 0) {
+    latestMarketData_ = candles.getCandle(marketTicksCount - 1);
   }
 
   crossingToBuySignal();
   crossingToSellSignal();
 }
 
-void SimpleMovingAverage::calculateSma(const std::vector<common::MarketData>& marketData,
-                                       unsigned int fromPeriod, unsigned int period) {
-  double sum = 0.0;
-  unsigned int toPeriod = fromPeriod + period;
-  for (unsigned int index = fromPeriod; index < toPeriod; ++index) {
-    sum += marketData[index].closePrice_;
-  }
-
-  double sma = sum / period;
-  movingAverageLine_.addPoint(sma);
-}
-
 void SimpleMovingAverage::crossingToBuySignal() {
   auto smaLineSize = movingAverageLine_.getSize();
   auto smaLastPoint = movingAverageLine_.getLastPoint();
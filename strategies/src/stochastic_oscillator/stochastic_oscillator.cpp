@@ -26,12 +26,10 @@
 
 #include "include/stochastic_oscillator/stochastic_oscillator.h"
 
-#include <algorithm>
-
 #include "common/exceptions/strategy_exception/strategy_exception.h"
 #include "common/exceptions/undefined_type_exception.h"
 #include "common/loggers/file_logger.h"
-#include "common/utils.h"
+#include "include/rolling_window/rolling_extremum.h"
 #include "include/strategies_utils.h"
 #include "resources/resources.h"
 
@@ -46,7 +44,7 @@ constexpr unsigned int DEFAULT_SMOOTHING_PERIOD = 3;
 StochasticOscillator::StochasticOscillator()
     : topBound_(DEFAULT_TOP_LEVEL_NUMBER), bottomBound_(DEFAULT_BOTTOM_LEVEL_NUMBER) {}
 
-void StochasticOscillator::createLines(const std::vector<common::MarketData> &candles,
+void StochasticOscillator::createLines(const common::CandleSeries &candles,
                                        common::StochasticOscillatorType stochasticType,
                                        int periodsForClassicLine, int smoothFastPeriod,
                                        int smoothSlowPeriod, size_t crossingInterval,
@@ -78,7 +76,7 @@ void StochasticOscillator::createLines(const std::vector<common::MarketData> &ca
 }
 
 void StochasticOscillator::calculateStochasticLines(
-    const std::vector<common::MarketData> &candles, int periodsForClassicLine, int smoothFastPeriod,
+    const common::CandleSeries &candles, int periodsForClassicLine, int smoothFastPeriod,
     int smoothSlowPeriod, common::StochasticOscillatorType stochasticType) {
   auto quickClassicLine = calculateQuickLineForClassicFormula(candles, periodsForClassicLine);
 
@@ -141,25 +139,24 @@ bool StochasticOscillator::checkBottomBound(int lineSize) const {
   return false;
 }
 
-Line StochasticOscillator::calculateQuickLineForClassicFormula(
-    const std::vector<common::MarketData> &candles, int quickLinePeriod) {
+Line StochasticOscillator::calculateQuickLineForClassicFormula(const common::CandleSeries &candles,
+                                                               int quickLinePeriod) {
   Line quickLine;
-  for (int i = quickLinePeriod; i <= candles.size(); ++i) {
-    int fromBound = i - quickLinePeriod;
-
-    auto fromIterator = candles.begin();
-    auto toIterator = candles.begin();
+  RollingMinimum lowestLow(quickLinePeriod);
+  RollingMaximum highestHigh(quickLinePeriod);
 
-    std::advance(fromIterator, fromBound);
-    std::advance(toIterator, i);
+  const double *lowPrices = candles.getLowPrices();
+  const double *highPrices = candles.getHighPrices();
+  const double *closePrices = candles.getClosePrices();
+  for (size_t index = 0; index < candles.size(); ++index) {
+    lowestLow.add(lowPrices[index]);
+    highestHigh.add(highPrices[index]);
+    if (!lowestLow.isFull()) continue;
 
-    auto min_low_price =
-        std::min_element(fromIterator, toIterator, common::lowPriceCompare)->lowPrice_;
-    auto max_high_price =
-        std::max_element(fromIterator, toIterator, common::highPriceCompare)->highPrice_;
+    auto min_low_price = lowestLow.getValue();
+    auto max_high_price = highestHigh.getValue();
 
-    auto currentCandleClosePrice = candles.at(i - 1).closePrice_;
-    double a = currentCandleClosePrice - min_low_price;
+    double a = closePrices[index] - min_low_price;
     double b = max_high_price - min_low_price;
 
     double quickLinePoint = (a / b) * 100;
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/strategy_batch.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace auto_trader {
+namespace strategies {
+
+StrategyBatch::StrategyBatch(StrategyFacade& strategies) : strategies_(strategies) {}
+
+std::vector<StrategySignal> StrategyBatch::evaluate(common::StrategiesType type,
+                                                    const Markets& markets,
+                                                    const CreateFunction& create) {
+  std::vector<StrategySignal> marketSignals(markets.size());
+  evaluate(type, markets, 0, markets.size(), create, marketSignals);
+  return marketSignals;
+}
+
+void StrategyBatch::evaluate(common::StrategiesType type, const Markets& markets, size_t begin,
+                             size_t end, const CreateFunction& create,
+                             std::vector<StrategySignal>& marketSignals) {
+  auto strategy = strategies_.getStrategy(type);
+
+  size_t candlesCapacity = 0;
+  for (size_t index = begin; index < end; ++index) {
+    candlesCapacity = std::max(candlesCapacity, markets[index] ? markets[index]->size() : 0);
+  }
+  candles_.reserve(candlesCapacity);
+
+  for (size_t index = begin; index < end; ++index) {
+    auto& signal = marketSignals[index];
+    if (!markets[index] || markets[index]->empty()) {
+      signal.error_ = "Strategy batch: market has no candles";
+      continue;
+    }
+
+    loadCandles(*markets[index]);
+    try {
+      create(*strategy, candles_);
+    } catch (const std::exception& exception) {
+      signal.error_ = exception.what();
+      continue;
+    }
+
+    signal.isEvaluated_ = true;
+    signal.isNeedToBuy_ = strategy->isNeedToBuy();
+    signal.isNeedToSell_ = strategy->isNeedToSell();
+    signal.lastBuyCrossingPoint_ = strategy->getLastBuyCrossingPoint();
+    signal.lastSellCrossingPoint_ = strategy->getLastSellCrossingPoint();
+  }
+}
+
+void StrategyBatch::loadCandles(const std::vector<common::MarketData>& marketData) {
+  candles_.clear();
+  for (const auto& candle : marketData) {
+    candles_.addCandle(candle);
+  }
+}
+
+}  // namespace strategies
+}  // namespace auto_trader
@@ -34,46 +34,46 @@ namespace strategies {
 StrategyFacade::StrategyFacade() : factory_(new StrategyFactory()) {}
 
 std::shared_ptr<BollingerBandsBase> StrategyFacade::getBollingerBandStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::BOLLINGER_BANDS);
+  auto strategy = getStrategy(common::StrategiesType::BOLLINGER_BANDS);
   return castStrategy<BollingerBandsBase>(strategy);
 }
 
 std::shared_ptr<BollingerBandsBase> StrategyFacade::getBollingerBandAdvanceStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::BOLLINGER_BANDS_ADVANCED);
+  auto strategy = getStrategy(common::StrategiesType::BOLLINGER_BANDS_ADVANCED);
   return castStrategy<BollingerBandsBase>(strategy);
 }
 
 std::shared_ptr<RsiBase> StrategyFacade::getRsiStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::RSI);
+  auto strategy = getStrategy(common::StrategiesType::RSI);
   return castStrategy<RsiBase>(strategy);
 }
 
 std::shared_ptr<SimpleMovingAverage> StrategyFacade::getSmaStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::SMA);
+  auto strategy = getStrategy(common::StrategiesType::SMA);
   return castStrategy<SimpleMovingAverage>(strategy);
 }
 
 std::shared_ptr<ExponentialMovingAverage> StrategyFacade::getEmaStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::EMA);
+  auto strategy = getStrategy(common::StrategiesType::EMA);
   return castStrategy<ExponentialMovingAverage>(strategy);
 }
 
 std::shared_ptr<MovingAveragesCrossing> StrategyFacade::getMACrossingStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::MA_CROSSING);
+  auto strategy = getStrategy(common::StrategiesType::MA_CROSSING);
   return castStrategy<MovingAveragesCrossing>(strategy);
 }
 
 std::shared_ptr<StochasticOscillator> StrategyFacade::getStochasticOscillatorStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::STOCHASTIC_OSCILLATOR);
+  auto strategy = getStrategy(common::StrategiesType::STOCHASTIC_OSCILLATOR);
   return castStrategy<StochasticOscillator>(strategy);
 }
 
 std::shared_ptr<Macd> StrategyFacade::getMacdStrategy() {
-  auto strategy = getTradeStrategy(common::StrategiesType::MACD);
+  auto strategy = getStrategy(common::StrategiesType::MACD);
   return castStrategy<Macd>(strategy);
 }
 
-std::shared_ptr<TradeStrategy> StrategyFacade::getTradeStrategy(common::StrategiesType type) {
+std::shared_ptr<TradeStrategy> StrategyFacade::getStrategy(common::StrategiesType type) {
   auto strategiesIterator = strategies_.find(type);
   if (strategiesIterator == strategies_.end()) {
     auto strategy = factory_->createStrategy(type);
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/strategy_pool.h"
+
+namespace auto_trader {
+namespace strategies {
+
+StrategyPool::Context::Context() : batch_(strategies_) {}
+
+StrategyPool::Lease::Lease(StrategyPool& pool, std::unique_ptr<Context> context)
+    : pool_(&pool), context_(std::move(context)) {}
+
+StrategyPool::Lease::Lease(Lease&& lease) noexcept
+    : pool_(lease.pool_), context_(std::move(lease.context_)) {}
+
+StrategyPool::Lease& StrategyPool::Lease::operator=(Lease&& lease) noexcept {
+  if (this != &lease) {
+    release();
+    pool_ = lease.pool_;
+    context_ = std::move(lease.context_);
+  }
+
+  return *this;
+}
+
+StrategyPool::Lease::~Lease() { release(); }
+
+void StrategyPool::Lease::release() {
+  if (context_) {
+    pool_->release(std::move(context_));
+  }
+}
+
+StrategyPool::StrategyPool(size_t contextsCount) {
+  idleContexts_.reserve(contextsCount);
+  for (size_t index = 0; index < contextsCount; ++index) {
+    idleContexts_.emplace_back(new Context());
+  }
+}
+
+StrategyPool::Lease StrategyPool::acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!idleContexts_.empty()) {
+      auto context = std::move(idleContexts_.back());
+      idleContexts_.pop_back();
+      return Lease(*this, std::move(context));
+    }
+  }
+
+  return Lease(*this, std::unique_ptr<Context>(new Context()));
+}
+
+size_t StrategyPool::getIdleCount() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return idleContexts_.size();
+}
+
+void StrategyPool::release(std::unique_ptr<Context> context) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  idleContexts_.push_back(std::move(context));
+}
+
+}  // namespace strategies
+}  // namespace auto_trader
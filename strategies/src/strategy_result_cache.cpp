@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/strategy_result_cache.h"
+
+#include <tuple>
+
+namespace auto_trader {
+namespace strategies {
+
+bool StrategyResultKey::operator<(const StrategyResultKey& key) const {
+  return std::tie(stockExchangeType_, baseCurrency_, tradedCurrency_, tickInterval_,
+                  lastCandleTime_, strategyType_, settings_) <
+         std::tie(key.stockExchangeType_, key.baseCurrency_, key.tradedCurrency_,
+                  key.tickInterval_, key.lastCandleTime_, key.strategyType_, key.settings_);
+}
+
+int64_t StrategyResultKey::getLastCandleTime(const std::vector<common::MarketData>& candles) {
+  if (candles.empty() || candles.back().date_ == common::Date()) {
+    return UNDATED_CANDLE_TIME;
+  }
+
+  return common::Date::toEpochMilliseconds(candles.back().date_);
+}
+
+bool StrategyResultCache::find(const StrategyResultKey& key, StrategySignal& signal) const {
+  auto resultIterator = results_.find(key);
+  if (resultIterator == results_.end()) {
+    return false;
+  }
+
+  signal = resultIterator->second;
+  return true;
+}
+
+void StrategyResultCache::insert(const StrategyResultKey& key, const StrategySignal& signal) {
+  if (key.lastCandleTime_ == UNDATED_CANDLE_TIME || !signal.isEvaluated_) {
+    return;
+  }
+
+  results_[key] = signal;
+}
+
+void StrategyResultCache::clear() { results_.clear(); }
+
+size_t StrategyResultCache::size() const { return results_.size(); }
+
+}  // namespace strategies
+}  // namespace auto_trader
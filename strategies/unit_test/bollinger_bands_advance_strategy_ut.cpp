@@ -48,7 +48,7 @@ TEST(BollingerBandsAdvance, isNeedToSellTrue) {
   EXPECT_TRUE(bbAdvanceStrategy->isNeedToSell());
   EXPECT_FALSE(bbAdvanceStrategy->isNeedToBuy());
 
-  EXPECT_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
+  EXPECT_DOUBLE_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
 }
 
 TEST(BollingerBandsAdvance, isNeedToSellFalse_Small_Percentage) {
@@ -63,7 +63,7 @@ TEST(BollingerBandsAdvance, isNeedToSellFalse_Small_Percentage) {
   EXPECT_FALSE(bbAdvanceStrategy->isNeedToSell());
   EXPECT_FALSE(bbAdvanceStrategy->isNeedToBuy());
 
-  EXPECT_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
+  EXPECT_DOUBLE_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
 }
 
 TEST(BollingerBandsAdvance, isNeedToSellFalse_DoubleCrossing) {
@@ -75,7 +75,7 @@ TEST(BollingerBandsAdvance, isNeedToSellFalse_DoubleCrossing) {
   bbAdvanceStrategy->createLines(BBAdvanceCandlesToSell, 20,
                                  common::BollingerInputType::closePosition_);
   EXPECT_TRUE(bbAdvanceStrategy->isNeedToSell());
-  EXPECT_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
+  EXPECT_DOUBLE_EQ(topCandleToSell, bbAdvanceStrategy->getTopLine().getLastPoint());
 
   auto candles = BBAdvanceCandlesToSell;
   candles.push_back(additionalCandleToCheckDoubleCrossingToSell);
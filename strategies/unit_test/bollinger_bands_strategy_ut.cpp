@@ -121,9 +121,9 @@ TEST(BollingerBands, CheckFirstPoints) {
   auto bbLines = facade.getBollingerBandStrategy();
   bbLines->createLines(candlesToSellTrue, 20, common::BollingerInputType::closePosition_);
 
-  EXPECT_EQ(bbLines->getTopLine().getPoint(0), topFirstPoint);
-  EXPECT_EQ(bbLines->getMiddleLine().getPoint(0), middleFirstPoint);
-  EXPECT_EQ(bbLines->getBottomLine().getPoint(0), bottomFirstPoint);
+  EXPECT_DOUBLE_EQ(bbLines->getTopLine().getPoint(0), topFirstPoint);
+  EXPECT_DOUBLE_EQ(bbLines->getMiddleLine().getPoint(0), middleFirstPoint);
+  EXPECT_DOUBLE_EQ(bbLines->getBottomLine().getPoint(0), bottomFirstPoint);
 }
 
 TEST(BollingerBands, BollingerBands_EmptyMarketData_Test) {
@@ -143,6 +143,55 @@ TEST(BollingerBands, BollingerBands_PeriodBiggerThanMarketDataSize_Test) {
                common::exceptions::StrategyException);
 }
 
+TEST(BollingerBands, PointsDoNotDependOnHistoryStart) {
+  const int period = 20;
+  std::vector<common::MarketData> candles;
+  for (size_t index = 0; index < 300; ++index) {
+    double closePrice = 4000 + static_cast<double>((index * 7919) % 113) / 7;
+    candles.push_back({closePrice - 1.5, closePrice, closePrice - 3.1, closePrice + 2.3, 1});
+  }
+
+  StrategyFacade facade;
+  auto fullHistory = facade.getBollingerBandStrategy();
+  fullHistory->createLines(candles, period, common::BollingerInputType::closePosition_);
+  const auto fullTopLine = fullHistory->getTopLine();
+  const auto fullMiddleLine = fullHistory->getMiddleLine();
+  const auto fullBottomLine = fullHistory->getBottomLine();
+
+  // Duplicate crossings are found by exact comparison with a point of an earlier, shifted
+  // history, so every point of the overlap must be bit-identical.
+  for (size_t offset : {1, 2, 250}) {
+    std::vector<common::MarketData> shiftedCandles(candles.begin() + offset, candles.end());
+    BollingerBands shifted;
+    shifted.createLines(shiftedCandles, period, common::BollingerInputType::closePosition_);
+
+    ASSERT_EQ(shifted.getBottomLine().getSize() + offset, fullBottomLine.getSize());
+    for (size_t index = 0; index < shifted.getBottomLine().getSize(); ++index) {
+      EXPECT_EQ(shifted.getTopLine().getPoint(index), fullTopLine.getPoint(index + offset));
+      EXPECT_EQ(shifted.getMiddleLine().getPoint(index), fullMiddleLine.getPoint(index + offset));
+      EXPECT_EQ(shifted.getBottomLine().getPoint(index), fullBottomLine.getPoint(index + offset));
+    }
+  }
+}
+
+TEST(BollingerBands, MiddleLineDoesNotDriftOnLongSeries) {
+  const size_t period = 200;
+  std::vector<common::MarketData> candles;
+  for (size_t index = 0; index < 20000; ++index) {
+    double closePrice = (index % 2 == 0) ? 1e12 + 0.1 : 0.3;
+    candles.push_back({closePrice, closePrice, closePrice, closePrice, 1});
+  }
+  for (size_t index = 0; index < period; ++index) {
+    candles.push_back({0.1, 0.1, 0.1, 0.1, 1});
+  }
+
+  StrategyFacade facade;
+  auto bollingerBands = facade.getBollingerBandStrategy();
+  bollingerBands->createLines(candles, period, common::BollingerInputType::closePosition_);
+
+  EXPECT_NEAR(bollingerBands->getMiddleLine().getLastPoint(), 0.1, 1e-9);
+}
+
 }  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
\ No newline at end of file
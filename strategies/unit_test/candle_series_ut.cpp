@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdint.h>
+
+#include "common/candle_series.h"
+#include "include/strategy_facade.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+TEST(CandleSeries, RoundTripsMarketData) {
+  std::vector<common::MarketData> candles;
+  for (int index = 0; index < 10; ++index) {
+    common::MarketData candle{100.0 + index, 101.0 + index, 99.0 + index, 102.0 + index, 5.0};
+    candle.date_ = common::Date{0, index, 12, 31, 12, 2019};
+    candles.emplace_back(candle);
+  }
+
+  common::CandleSeries series(candles);
+  ASSERT_EQ(series.size(), candles.size());
+
+  auto restored = series.toMarketData();
+  for (size_t index = 0; index < candles.size(); ++index) {
+    EXPECT_TRUE(restored[index] == candles[index]);
+    EXPECT_EQ(series.getPrices(common::CLOSE_PRICE)[index], candles[index].closePrice_);
+  }
+}
+
+TEST(CandleSeries, ColumnsAreAligned) {
+  common::CandleSeries series;
+  for (int index = 0; index < 7; ++index) {
+    series.addCandle(index * 60000, 1, 2, 0.5, 3, 10);
+  }
+
+  for (auto column : {series.getOpenPrices(), series.getClosePrices(), series.getLowPrices(),
+                      series.getHighPrices(), series.getVolumes()}) {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(column) % common::CandleSeries::COLUMN_ALIGNMENT, 0);
+  }
+}
+
+static void expectSameLine(const Line& expected, const Line& actual) {
+  ASSERT_EQ(expected.getSize(), actual.getSize());
+  for (size_t index = 0; index < expected.getSize(); ++index) {
+    EXPECT_EQ(expected.getPoint(index), actual.getPoint(index));
+  }
+}
+
+TEST(CandleSeries, StrategiesReadSeriesLikeRecords) {
+  std::vector<common::MarketData> candles;
+  for (size_t index = 0; index < 120; ++index) {
+    double closePrice = 4000 + static_cast<double>((index * 7919) % 113) / 7;
+    candles.push_back({closePrice - 1.5, closePrice, closePrice - 3.1, closePrice + 2.3, 1});
+  }
+  common::CandleSeries series(candles);
+
+  StrategyFacade fromRecords;
+  StrategyFacade fromSeries;
+
+  auto bollingerBands = fromRecords.getBollingerBandStrategy();
+  auto seriesBollingerBands = fromSeries.getBollingerBandStrategy();
+  bollingerBands->createLines(candles, 20, common::BollingerInputType::highPrice_);
+  seriesBollingerBands->createLines(series, 20, common::BollingerInputType::highPrice_);
+  expectSameLine(bollingerBands->getBottomLine(), seriesBollingerBands->getBottomLine());
+
+  auto rsi = fromRecords.getRsiStrategy();
+  auto seriesRsi = fromSeries.getRsiStrategy();
+  rsi->createLine(candles, 14);
+  seriesRsi->createLine(series, 14);
+  expectSameLine(rsi->getRsiLine(), seriesRsi->getRsiLine());
+
+  auto stochastic = fromRecords.getStochasticOscillatorStrategy();
+  auto seriesStochastic = fromSeries.getStochasticOscillatorStrategy();
+  stochastic->createLines(candles, common::StochasticOscillatorType::Full, 14);
+  seriesStochastic->createLines(series, common::StochasticOscillatorType::Full, 14);
+  expectSameLine(stochastic->getSlowLine(), seriesStochastic->getSlowLine());
+
+  auto crossing = fromRecords.getMACrossingStrategy();
+  auto seriesCrossing = fromSeries.getMACrossingStrategy();
+  crossing->createLines(candles, 10, 30, 0, 0, common::MovingAverageType::EXPONENTIAL);
+  seriesCrossing->createLines(series, 10, 30, 0, 0, common::MovingAverageType::EXPONENTIAL);
+  expectSameLine(crossing->getBiggerPeriodLine(), seriesCrossing->getBiggerPeriodLine());
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
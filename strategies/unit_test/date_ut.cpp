@@ -24,31 +24,23 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include "strategies/include/bollinger_bands/middle_line.h"
+#include <gtest/gtest.h>
 
-#include "include/bollinger_bands/bollinger_bands_utils.h"
+#include "common/date.h"
 
 namespace auto_trader {
 namespace strategies {
+namespace unit_test {
 
-void MiddleLine::generateCoordinates(const std::vector<common::MarketData>& candles, int period,
-                                     common::BollingerInputType field) {
-  if (candles.size() < period) return;
+TEST(Date, EpochMillisecondsConversion) {
+  common::Date date{0, 0, 0, 1, 1, 2020};
+  EXPECT_EQ(common::Date::toEpochMilliseconds(date), 1577836800000);
 
-  points_.reserve(candles.size() - period);
-
-  int fromCandle = 0;
-  for (int toCandle = period - 1; toCandle < candles.size(); ++toCandle) {
-    double sum = 0;
-
-    for (int j = fromCandle; j <= toCandle; ++j) {
-      sum += bollinger_bands_utils::summationCandleFieldByEnum(candles.at(j), field);
-    }
-
-    points_.emplace_back(sum / period);
-    ++fromCandle;
-  }
+  common::Date leapDay{59, 59, 23, 29, 2, 2020};
+  EXPECT_TRUE(common::Date::fromEpochMilliseconds(common::Date::toEpochMilliseconds(leapDay)) ==
+              leapDay);
 }
 
+}  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "include/simd/indicator_kernels.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+namespace {
+
+std::vector<double> generatePrices(size_t count, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> change(0, 1.5);
+
+  std::vector<double> prices;
+  double price = 8000;
+  for (size_t index = 0; index < count; ++index) {
+    price += change(generator);
+    prices.push_back(price);
+  }
+
+  return prices;
+}
+
+}  // namespace
+
+TEST(IndicatorKernels, MovingAverageMatchesScalarBitForBit) {
+  const auto& scalarKernels = simd::getScalarKernels();
+  const auto& kernels = simd::getKernels();
+
+  // Window counts below, at and above the lane width leave different tails to the scalar loop.
+  for (size_t period : {1, 2, 5, 20, 50}) {
+    for (size_t count : {period, period + 1, period + 3, period + 4, period + 5, size_t{257}}) {
+      const auto prices = generatePrices(count, 42);
+      const size_t windowsCount = simd::getWindowsCount(count, period);
+
+      std::vector<double> expected(windowsCount), actual(windowsCount);
+      scalarKernels.movingAverage(prices.data(), count, period, expected.data());
+      kernels.movingAverage(prices.data(), count, period, actual.data());
+      EXPECT_EQ(actual, expected) << "period " << period << ", count " << count;
+    }
+  }
+}
+
+TEST(IndicatorKernels, MovingStandardDeviationMatchesScalarBitForBit) {
+  const auto& scalarKernels = simd::getScalarKernels();
+  const auto& kernels = simd::getKernels();
+
+  for (size_t period : {1, 2, 5, 20, 50}) {
+    for (size_t count : {period, period + 1, period + 3, period + 4, period + 5, size_t{257}}) {
+      const auto prices = generatePrices(count, 7);
+      const size_t windowsCount = simd::getWindowsCount(count, period);
+      std::vector<double> means(windowsCount);
+      scalarKernels.movingAverage(prices.data(), count, period, means.data());
+
+      std::vector<double> expected(windowsCount), actual(windowsCount);
+      scalarKernels.movingStandardDeviation(prices.data(), means.data(), count, period,
+                                            expected.data());
+      kernels.movingStandardDeviation(prices.data(), means.data(), count, period,
+                                      actual.data());
+      EXPECT_EQ(actual, expected) << "period " << period << ", count " << count;
+    }
+  }
+}
+
+TEST(IndicatorKernels, WindowsMatchDirectComputation) {
+  const size_t period = 20;
+  const auto prices = generatePrices(100, 3);
+  const size_t windowsCount = simd::getWindowsCount(prices.size(), period);
+  ASSERT_EQ(windowsCount, prices.size() - period + 1);
+
+  const auto& kernels = simd::getKernels();
+  std::vector<double> means(windowsCount), deviations(windowsCount);
+  kernels.movingAverage(prices.data(), prices.size(), period, means.data());
+  kernels.movingStandardDeviation(prices.data(), means.data(), prices.size(), period,
+                                  deviations.data());
+
+  for (size_t window = 0; window < windowsCount; ++window) {
+    double sum = 0;
+    for (size_t index = window; index < window + period; ++index) {
+      sum += prices[index];
+    }
+    const double mean = sum / period;
+
+    double squaredDeviationsSum = 0;
+    for (size_t index = window; index < window + period; ++index) {
+      squaredDeviationsSum += (prices[index] - mean) * (prices[index] - mean);
+    }
+
+    EXPECT_NEAR(means[window], mean, 1e-9);
+    EXPECT_NEAR(deviations[window], std::sqrt(squaredDeviationsSum / period), 1e-9);
+  }
+}
+
+TEST(IndicatorKernels, NoWindowsWhenPeriodDoesNotFit) {
+  EXPECT_EQ(simd::getWindowsCount(5, 0), 0);
+  EXPECT_EQ(simd::getWindowsCount(5, 6), 0);
+  EXPECT_EQ(simd::getWindowsCount(5, 5), 1);
+
+  const auto prices = generatePrices(5, 1);
+  double untouched = -1;
+  simd::getKernels().movingAverage(prices.data(), prices.size(), 6, &untouched);
+  simd::getKernels().movingStandardDeviation(prices.data(), prices.data(), prices.size(), 6,
+                                             &untouched);
+  EXPECT_EQ(untouched, -1);
+}
+
+TEST(IndicatorKernels, SubtractMatchesScalarBitForBit) {
+  const auto& scalarKernels = simd::getScalarKernels();
+  const auto& kernels = simd::getKernels();
+
+  // Counts below, at and above the lane width leave different tails to the scalar loop.
+  for (size_t count : {1, 3, 4, 5, 20, 21, 22, 23, 257}) {
+    const auto minuend = generatePrices(count, 42);
+    const auto subtrahend = generatePrices(count, 7);
+
+    std::vector<double> expected(count), actual(count);
+    scalarKernels.subtract(minuend.data(), subtrahend.data(), count, expected.data());
+    kernels.subtract(minuend.data(), subtrahend.data(), count, actual.data());
+    EXPECT_EQ(actual, expected);
+  }
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
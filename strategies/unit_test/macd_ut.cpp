@@ -92,6 +92,17 @@ TEST(MacdStrategies, fastPeriodBiggerThenSlowPeriod) {
                common::exceptions::BadPeriodsForLinesException);
 }
 
+TEST(MacdStrategies, histogramIsAlignedOnNewestPoint) {
+  StrategyFacade facade;
+
+  auto macd = facade.getMacdStrategy();
+  macd->createLines(macdToSell, 12, 26, 9, 3);
+
+  // MACD line starts at the 26th candle and its 9 period signal line eight points later.
+  auto histogram = macd->getHistogram();
+  EXPECT_EQ(histogram.getSize(), macdToSell.size() - 26 + 1 - 9 + 1);
+}
+
 }  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "include/rolling_window/rolling_extremum.h"
+#include "include/rolling_window/rolling_sum.h"
+#include "include/strategies_utils.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+TEST(RollingSum, SumOfLastPeriodValues) {
+  RollingSum window(3);
+
+  window.add(1);
+  window.add(2);
+  EXPECT_FALSE(window.isFull());
+  EXPECT_DOUBLE_EQ(window.getSum(), 3);
+
+  window.add(3);
+  EXPECT_TRUE(window.isFull());
+  EXPECT_DOUBLE_EQ(window.getSum(), 6);
+  EXPECT_DOUBLE_EQ(window.getMean(), 2);
+
+  window.add(10);
+  EXPECT_DOUBLE_EQ(window.getSum(), 15);
+  EXPECT_EQ(window.getCount(), 3);
+
+  window.reset();
+  EXPECT_EQ(window.getCount(), 0);
+  EXPECT_DOUBLE_EQ(window.getSum(), 0);
+}
+
+TEST(RollingSum, CompensatedSumDoesNotDrift) {
+  const int period = 200;
+  RollingSum plain(period, SummationMode::PLAIN);
+  RollingSum compensated(period, SummationMode::COMPENSATED);
+
+  for (int index = 0; index < 10000; ++index) {
+    double value = (index % 2 == 0) ? 1e12 + 0.1 : 0.3;
+    plain.add(value);
+    compensated.add(value);
+  }
+
+  for (int index = 0; index < period; ++index) {
+    plain.add(0.1);
+    compensated.add(0.1);
+  }
+
+  const double expected = period * 0.1;
+  EXPECT_NEAR(compensated.getSum(), expected, 1e-9);
+  EXPECT_GT(std::fabs(plain.getSum() - expected), std::fabs(compensated.getSum() - expected));
+}
+
+TEST(RollingSum, SmaMatchesFullWindowSummation) {
+  Line input;
+  for (int index = 0; index < 50; ++index) {
+    input.addPoint(3800.0 + (index * 7 % 13) * 0.125);
+  }
+
+  const int period = 10;
+  Line sma;
+  utils::calculateSma(input, period, &sma);
+
+  ASSERT_EQ(sma.getSize(), input.getSize() - period + 1);
+  for (size_t point = 0; point < sma.getSize(); ++point) {
+    double sum = 0;
+    for (size_t index = point; index < point + period; ++index) {
+      sum += input.getPoint(index);
+    }
+    EXPECT_DOUBLE_EQ(sma.getPoint(point), sum / period);
+  }
+}
+
+TEST(RollingExtremum, MatchesWindowScan) {
+  const size_t period = 4;
+  std::vector<double> values = {5, 3, 3, 8, 1, 1, 7, 2, 9, 9, 4, 0, 6};
+
+  RollingMinimum minimum(period);
+  RollingMaximum maximum(period);
+
+  for (size_t index = 0; index < values.size(); ++index) {
+    minimum.add(values[index]);
+    maximum.add(values[index]);
+
+    if (index + 1 < period) {
+      EXPECT_FALSE(minimum.isFull());
+      continue;
+    }
+
+    auto from = values.begin() + (index + 1 - period);
+    auto to = values.begin() + index + 1;
+    EXPECT_EQ(minimum.getValue(), *std::min_element(from, to));
+    EXPECT_EQ(maximum.getValue(), *std::max_element(from, to));
+  }
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
@@ -132,6 +132,81 @@ TEST(Rsi, Rsi_PeriodBiggerThanMarketDataSize_Test) {
                common::exceptions::StrategyException);
 }
 
+TEST(Rsi, Rsi_WilderSmoothing_LineMatching_Test) {
+  const int period = 14;
+  StrategyFacade facade;
+  auto rsiStrategy = facade.getRsiStrategy();
+  rsiStrategy->setSmoothingType(common::RsiSmoothingType::WILDER);
+  rsiStrategy->createLine(rsiToSellSignal, period, 3);
+
+  auto line = rsiStrategy->getRsiLine();
+  ASSERT_EQ(line.getSize(), rsiToSellSignal.size() - period);
+
+  double averageGain = 0;
+  double averageLoss = 0;
+  for (size_t index = 1; index < rsiToSellSignal.size(); ++index) {
+    double difference = rsiToSellSignal[index].closePrice_ - rsiToSellSignal[index - 1].closePrice_;
+    double gain = difference > 0 ? difference : 0;
+    double loss = difference < 0 ? -difference : 0;
+
+    if (index <= period) {
+      averageGain += gain / period;
+      averageLoss += loss / period;
+    } else {
+      averageGain = (averageGain * (period - 1) + gain) / period;
+      averageLoss = (averageLoss * (period - 1) + loss) / period;
+    }
+
+    if (index >= period) {
+      double expected = 100 - 100 / (1 + averageGain / averageLoss);
+      EXPECT_NEAR(line.getPoint(index - period), expected, 1e-9);
+    }
+  }
+}
+
+TEST(Rsi, Rsi_Update_MatchesFullRecalculation_Test) {
+  for (auto smoothing : {common::RsiSmoothingType::SIMPLE, common::RsiSmoothingType::WILDER}) {
+    StrategyFacade streamingFacade;
+    auto streaming = streamingFacade.getRsiStrategy();
+    streaming->setTopRsiIndex(80);
+    streaming->setBottomRsiIndex(20);
+    streaming->setSmoothingType(smoothing);
+    streaming->createLine(rsiToSellSignal, 14, 3);
+    auto lastBuyCrossingPoint = streaming->getLastBuyCrossingPoint();
+    auto lastSellCrossingPoint = streaming->getLastSellCrossingPoint();
+    streaming->update(additionalCandleToSell);
+
+    StrategyFacade facade;
+    auto full = facade.getRsiStrategy();
+    full->setTopRsiIndex(80);
+    full->setBottomRsiIndex(20);
+    full->setSmoothingType(smoothing);
+    auto candles = rsiToSellSignal;
+    candles.emplace_back(additionalCandleToSell);
+    full->createLine(candles, 14, 3, lastBuyCrossingPoint, lastSellCrossingPoint);
+
+    auto streamingLine = streaming->getRsiLine();
+    auto fullLine = full->getRsiLine();
+    ASSERT_EQ(streamingLine.getSize(), fullLine.getSize());
+    EXPECT_EQ(streamingLine.getLastPoint(), fullLine.getLastPoint());
+    EXPECT_EQ(streaming->isNeedToSell(), full->isNeedToSell());
+    EXPECT_EQ(streaming->isNeedToBuy(), full->isNeedToBuy());
+  }
+}
+
+TEST(Rsi, Rsi_WindowWithoutLosses_Test) {
+  StrategyFacade facade;
+  auto rsiStrategy = facade.getRsiStrategy();
+
+  rsiStrategy->createLine(rsiOnlyGrowingCandles, 3, 0);
+  EXPECT_EQ(rsiStrategy->getRsiLine().getLastPoint(), 100);
+
+  rsiStrategy->createLine(rsiFlatCandles, 3, 0);
+  EXPECT_EQ(rsiStrategy->getRsiLine().getLastPoint(), 50);
+  EXPECT_FALSE(rsiStrategy->isNeedToBuy());
+  EXPECT_FALSE(rsiStrategy->isNeedToSell());
+}
+
 }  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
@@ -103,6 +103,14 @@ std::vector<common::MarketData> rsiFiveCandles = {
 
 std::vector<common::MarketData> rsiEmptyMarketData;
 
+std::vector<common::MarketData> rsiOnlyGrowingCandles = {
+    {10, 11, 10, 11, 1}, {11, 12, 11, 12, 1}, {12, 13, 12, 13, 1},
+    {13, 14, 13, 14, 1}, {14, 15, 14, 15, 1}, {15, 16, 15, 16, 1}};
+
+std::vector<common::MarketData> rsiFlatCandles = {
+    {10, 10, 10, 10, 1}, {10, 10, 10, 10, 1}, {10, 10, 10, 10, 1},
+    {10, 10, 10, 10, 1}, {10, 10, 10, 10, 1}, {10, 10, 10, 10, 1}};
+
 }  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
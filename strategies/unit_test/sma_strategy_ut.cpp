@@ -44,8 +44,8 @@ TEST(Sma, Sma_LineMatching_Test) {
   auto line = smaStrategy->getLine();
 
   EXPECT_EQ(line.getSize(), 2);
-  EXPECT_EQ(line.getPoint(0), 22.220999999999997);
-  EXPECT_EQ(line.getPoint(1), 22.209);
+  EXPECT_DOUBLE_EQ(line.getPoint(0), 22.220999999999997);
+  EXPECT_DOUBLE_EQ(line.getPoint(1), 22.209);
 }
 
 TEST(Sma, OrderSmaToSell) {
@@ -55,11 +55,11 @@ TEST(Sma, OrderSmaToSell) {
 
   auto line = smaStrategy->getLine();
   EXPECT_EQ(line.getSize(), 5);
-  EXPECT_EQ(line.getPoint(0), 22.220999999999997);
-  EXPECT_EQ(line.getPoint(1), 22.209);
-  EXPECT_EQ(line.getPoint(2), 22.229000000000003);
-  EXPECT_EQ(line.getPoint(3), 22.259000000000004);
-  EXPECT_EQ(line.getPoint(4), 22.303000000000004);
+  EXPECT_DOUBLE_EQ(line.getPoint(0), 22.220999999999997);
+  EXPECT_DOUBLE_EQ(line.getPoint(1), 22.209);
+  EXPECT_DOUBLE_EQ(line.getPoint(2), 22.229000000000003);
+  EXPECT_DOUBLE_EQ(line.getPoint(3), 22.259000000000004);
+  EXPECT_DOUBLE_EQ(line.getPoint(4), 22.303000000000004);
 }
 
 TEST(Sma, Sma_Second_LineMatching_Test) {
@@ -69,11 +69,11 @@ TEST(Sma, Sma_Second_LineMatching_Test) {
 
   auto line = smaStrategy->getLine();
   EXPECT_EQ(line.getSize(), 5);
-  EXPECT_EQ(line.getPoint(0), 22.220999999999997);
-  EXPECT_EQ(line.getPoint(1), 22.209);
-  EXPECT_EQ(line.getPoint(2), 22.229000000000003);
-  EXPECT_EQ(line.getPoint(3), 22.259000000000004);
-  EXPECT_EQ(line.getPoint(4), 22.303000000000004);
+  EXPECT_DOUBLE_EQ(line.getPoint(0), 22.220999999999997);
+  EXPECT_DOUBLE_EQ(line.getPoint(1), 22.209);
+  EXPECT_DOUBLE_EQ(line.getPoint(2), 22.229000000000003);
+  EXPECT_DOUBLE_EQ(line.getPoint(3), 22.259000000000004);
+  EXPECT_DOUBLE_EQ(line.getPoint(4), 22.303000000000004);
 
   EXPECT_FALSE(smaStrategy->isNeedToSell());
   EXPECT_FALSE(smaStrategy->isNeedToBuy());
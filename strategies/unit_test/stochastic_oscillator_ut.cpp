@@ -28,7 +28,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "common/exceptions/strategy_exception/strategy_exception.h"
+#include "common/utils.h"
 #include "include/strategy_facade.h"
 #include "include/strategy_factory.h"
 
@@ -221,6 +224,27 @@ TEST(SlowStochastic, SlowStochastic_PeriodBiggerThanMarketDataSize_Test) {
       common::exceptions::StrategyException);
 }
 
+TEST(QuickStochastic, QuickLineMatchesFullLookbackScan) {
+  const int period = 10;
+  StrategyFacade facade;
+
+  auto stoch = facade.getStochasticOscillatorStrategy();
+  stoch->createLines(stochasticToBuy, common::StochasticOscillatorType::Quick, period);
+  auto quickLine = stoch->getQuickLine();
+
+  ASSERT_EQ(quickLine.getSize(), stochasticToBuy.size() - period + 1);
+  for (size_t index = period; index <= stochasticToBuy.size(); ++index) {
+    auto from = stochasticToBuy.begin() + (index - period);
+    auto to = stochasticToBuy.begin() + index;
+    auto lowest = std::min_element(from, to, common::lowPriceCompare)->lowPrice_;
+    auto highest = std::max_element(from, to, common::highPriceCompare)->highPrice_;
+    auto close = stochasticToBuy.at(index - 1).closePrice_;
+    double expected = ((close - lowest) / (highest - lowest)) * 100;
+
+    EXPECT_EQ(quickLine.getPoint(index - period), expected);
+  }
+}
+
 }  // namespace unit_test
 }  // namespace strategies
 }  // namespace auto_trader
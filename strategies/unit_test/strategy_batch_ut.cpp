@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "include/bollinger_bands/bollinger_bands.h"
+#include "include/rsi/rsi.h"
+#include "include/strategy_batch.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+namespace {
+
+std::vector<std::vector<common::MarketData>> generateMarkets(size_t marketsCount,
+                                                             size_t candlesCount) {
+  std::mt19937 generator(7);
+  std::normal_distribution<double> change(0, 0.01);
+
+  std::vector<std::vector<common::MarketData>> markets(marketsCount);
+  for (auto& candles : markets) {
+    double price = 1;
+    for (size_t index = 0; index < candlesCount; ++index) {
+      const double openPrice = price;
+      price *= 1 + change(generator);
+      candles.emplace_back(common::MarketData{openPrice, price, std::min(openPrice, price),
+                                              std::max(openPrice, price), 100});
+    }
+  }
+
+  return markets;
+}
+
+StrategyBatch::Markets toBatchMarkets(
+    const std::vector<std::vector<common::MarketData>>& markets) {
+  StrategyBatch::Markets batchMarkets;
+  for (const auto& candles : markets) {
+    batchMarkets.push_back(&candles);
+  }
+
+  return batchMarkets;
+}
+
+void createBands(TradeStrategy& strategy, const common::CandleSeries& candles) {
+  auto& bands = static_cast<BollingerBandsBase&>(strategy);
+  bands.createLines(candles, 20, common::BollingerInputType::closePosition_, 2, 3, 0, 0);
+}
+
+void createRsi(TradeStrategy& strategy, const common::CandleSeries& candles) {
+  auto& rsi = static_cast<RsiBase&>(strategy);
+  rsi.setTopRsiIndex(70);
+  rsi.setBottomRsiIndex(30);
+  rsi.createLine(candles, 14, 3, 0, 0);
+}
+
+void expectSameSignal(const StrategySignal& signal, const TradeStrategy& strategy) {
+  EXPECT_TRUE(signal.isEvaluated_);
+  EXPECT_EQ(signal.isNeedToBuy_, strategy.isNeedToBuy());
+  EXPECT_EQ(signal.isNeedToSell_, strategy.isNeedToSell());
+  EXPECT_EQ(signal.lastBuyCrossingPoint_, strategy.getLastBuyCrossingPoint());
+  EXPECT_EQ(signal.lastSellCrossingPoint_, strategy.getLastSellCrossingPoint());
+}
+
+}  // namespace
+
+TEST(StrategyBatch, BollingerBandsMatchesPerMarketEvaluation) {
+  const auto markets = generateMarkets(100, 300);
+
+  StrategyFacade strategies;
+  StrategyBatch batch(strategies);
+  auto signals = batch.evaluate(common::StrategiesType::BOLLINGER_BANDS, toBatchMarkets(markets),
+                                createBands);
+
+  ASSERT_EQ(signals.size(), markets.size());
+  for (size_t index = 0; index < markets.size(); ++index) {
+    BollingerBands bands;
+    createBands(bands, common::CandleSeries(markets[index]));
+    expectSameSignal(signals[index], bands);
+  }
+}
+
+TEST(StrategyBatch, RsiMatchesPerMarketEvaluation) {
+  const auto markets = generateMarkets(100, 300);
+
+  StrategyFacade strategies;
+  StrategyBatch batch(strategies);
+  auto signals =
+      batch.evaluate(common::StrategiesType::RSI, toBatchMarkets(markets), createRsi);
+
+  ASSERT_EQ(signals.size(), markets.size());
+  for (size_t index = 0; index < markets.size(); ++index) {
+    Rsi rsi;
+    createRsi(rsi, common::CandleSeries(markets[index]));
+    expectSameSignal(signals[index], rsi);
+  }
+}
+
+TEST(StrategyBatch, FailedMarketDoesNotStopOthers) {
+  auto markets = generateMarkets(4, 50);
+  markets[1].resize(5);
+  markets[2].clear();
+
+  StrategyFacade strategies;
+  StrategyBatch batch(strategies);
+  auto signals = batch.evaluate(common::StrategiesType::BOLLINGER_BANDS, toBatchMarkets(markets),
+                                createBands);
+
+  ASSERT_EQ(signals.size(), markets.size());
+  EXPECT_TRUE(signals[0].isEvaluated_);
+  EXPECT_FALSE(signals[1].isEvaluated_);
+  EXPECT_FALSE(signals[1].error_.empty());
+  EXPECT_FALSE(signals[2].isEvaluated_);
+  EXPECT_FALSE(signals[2].error_.empty());
+  EXPECT_TRUE(signals[3].isEvaluated_);
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+
+#include "include/rsi/rsi.h"
+#include "include/strategy_pool.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+namespace {
+
+std::vector<common::MarketData> generateCandles(unsigned int seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<double> change(0, 0.02);
+
+  std::vector<common::MarketData> candles;
+  double price = 10;
+  for (int index = 0; index < 200; ++index) {
+    const double openPrice = price;
+    price *= 1 + change(generator);
+    candles.emplace_back(common::MarketData{openPrice, price, std::min(openPrice, price),
+                                            std::max(openPrice, price), 1});
+  }
+
+  return candles;
+}
+
+void createRsi(TradeStrategy& strategy, const common::CandleSeries& candles) {
+  auto& rsi = static_cast<RsiBase&>(strategy);
+  rsi.setTopRsiIndex(70);
+  rsi.setBottomRsiIndex(30);
+  rsi.createLine(candles, 14, 3, 0, 0);
+}
+
+}  // namespace
+
+TEST(StrategyPool, ReusesReleasedContexts) {
+  StrategyPool pool(1);
+  EXPECT_EQ(pool.getIdleCount(), 1);
+
+  StrategyPool::Context* leasedContext = nullptr;
+  {
+    auto lease = pool.acquire();
+    leasedContext = &*lease;
+    EXPECT_EQ(pool.getIdleCount(), 0);
+
+    auto secondLease = pool.acquire();
+    EXPECT_NE(&*secondLease, leasedContext);
+    EXPECT_NE(&secondLease->getStrategies(), &lease->getStrategies());
+  }
+
+  EXPECT_EQ(pool.getIdleCount(), 2);
+
+  auto lease = pool.acquire();
+  auto movedLease = std::move(lease);
+  EXPECT_EQ(pool.getIdleCount(), 1);
+}
+
+TEST(StrategyPool, WorkersEvaluateRangesOfOneBatch) {
+  const size_t marketsCount = 64;
+  std::vector<std::vector<common::MarketData>> markets;
+  StrategyBatch::Markets batchMarkets;
+  for (size_t index = 0; index < marketsCount; ++index) {
+    markets.emplace_back(generateCandles(index));
+  }
+  for (const auto& candles : markets) {
+    batchMarkets.push_back(&candles);
+  }
+
+  StrategyFacade serialStrategies;
+  StrategyBatch serialBatch(serialStrategies);
+  auto expected = serialBatch.evaluate(common::StrategiesType::RSI, batchMarkets, createRsi);
+
+  StrategyPool pool;
+  std::vector<StrategySignal> actual(marketsCount);
+  std::vector<std::thread> workers;
+  const size_t workersCount = 4;
+  const size_t marketsPerWorker = marketsCount / workersCount;
+  for (size_t worker = 0; worker < workersCount; ++worker) {
+    workers.emplace_back([&, worker]() {
+      auto lease = pool.acquire();
+      lease->getBatch().evaluate(common::StrategiesType::RSI, batchMarkets,
+                                 worker * marketsPerWorker, (worker + 1) * marketsPerWorker,
+                                 createRsi, actual);
+    });
+  }
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  for (size_t index = 0; index < marketsCount; ++index) {
+    EXPECT_TRUE(actual[index].isEvaluated_);
+    EXPECT_EQ(actual[index].isNeedToBuy_, expected[index].isNeedToBuy_);
+    EXPECT_EQ(actual[index].isNeedToSell_, expected[index].isNeedToSell_);
+    EXPECT_EQ(actual[index].lastBuyCrossingPoint_, expected[index].lastBuyCrossingPoint_);
+    EXPECT_EQ(actual[index].lastSellCrossingPoint_, expected[index].lastSellCrossingPoint_);
+  }
+  // A worker that finishes before another starts hands its context over instead of a new one.
+  EXPECT_GE(pool.getIdleCount(), 1);
+  EXPECT_LE(pool.getIdleCount(), workersCount);
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "include/strategy_result_cache.h"
+#include "model/include/settings/strategies_settings/sma_settings.h"
+
+namespace auto_trader {
+namespace strategies {
+namespace unit_test {
+
+namespace {
+
+std::vector<common::MarketData> createCandles() {
+  std::vector<common::MarketData> candles;
+  for (int index = 0; index < 30; ++index) {
+    candles.emplace_back(common::MarketData{100.0 + index, 101.0 + index, 99.0, 102.0, 1.0});
+  }
+
+  return candles;
+}
+
+StrategyResultKey createSmaKey(int64_t lastCandleTime, const std::string& settings = "10 3") {
+  StrategyResultKey key;
+  key.stockExchangeType_ = common::StockExchangeType::Binance;
+  key.baseCurrency_ = common::Currency::BTC;
+  key.tradedCurrency_ = common::Currency::ETH;
+  key.tickInterval_ = common::TickInterval::ONE_HOUR;
+  key.lastCandleTime_ = lastCandleTime;
+  key.strategyType_ = common::StrategiesType::SMA;
+  key.settings_ = settings;
+  return key;
+}
+
+}  // namespace
+
+TEST(StrategyResultCache, StoresOneSignalPerKey) {
+  StrategyResultCache cache;
+  StrategySignal signal;
+  EXPECT_FALSE(cache.find(createSmaKey(1000), signal));
+
+  StrategySignal buySignal;
+  buySignal.isEvaluated_ = true;
+  buySignal.isNeedToBuy_ = true;
+  buySignal.lastBuyCrossingPoint_ = 101.5;
+  cache.insert(createSmaKey(1000), buySignal);
+
+  ASSERT_TRUE(cache.find(createSmaKey(1000), signal));
+  EXPECT_TRUE(signal.isNeedToBuy_);
+  EXPECT_EQ(signal.lastBuyCrossingPoint_, 101.5);
+
+  EXPECT_FALSE(cache.find(createSmaKey(2000), signal));
+  cache.insert(createSmaKey(2000), buySignal);
+  EXPECT_EQ(cache.size(), 2);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.find(createSmaKey(1000), signal));
+}
+
+TEST(StrategyResultCache, DifferentSettingsNeverShareResult) {
+  model::SmaSettings settings;
+  settings.strategiesType_ = common::StrategiesType::SMA;
+  settings.lastBuyCrossingPoint_ = 0.1;
+  model::SmaSettings nextSettings = settings;
+  nextSettings.lastBuyCrossingPoint_ = std::nextafter(0.1, 1.0);
+  ASSERT_NE(settings.getResultKey(), nextSettings.getResultKey());
+
+  StrategyResultCache cache;
+  StrategySignal evaluatedSignal;
+  evaluatedSignal.isEvaluated_ = true;
+  cache.insert(createSmaKey(1000, settings.getResultKey()), evaluatedSignal);
+
+  StrategySignal signal;
+  EXPECT_TRUE(cache.find(createSmaKey(1000, settings.getResultKey()), signal));
+  EXPECT_FALSE(cache.find(createSmaKey(1000, nextSettings.getResultKey()), signal));
+}
+
+TEST(StrategyResultCache, FailedEvaluationIsNotCached) {
+  StrategyResultCache cache;
+  StrategySignal failedSignal;
+  failedSignal.error_ = "Simple Moving Average: not valid data for creating lines";
+  cache.insert(createSmaKey(1000), failedSignal);
+
+  StrategySignal signal;
+  EXPECT_FALSE(cache.find(createSmaKey(1000), signal));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(StrategyResultCache, UndatedHistoryIsNotCached) {
+  StrategyResultCache cache;
+  const auto candles = createCandles();
+  auto key = createSmaKey(StrategyResultKey::getLastCandleTime(candles));
+  EXPECT_EQ(key.lastCandleTime_, UNDATED_CANDLE_TIME);
+
+  StrategySignal evaluatedSignal;
+  evaluatedSignal.isEvaluated_ = true;
+  cache.insert(key, evaluatedSignal);
+
+  StrategySignal signal;
+  EXPECT_FALSE(cache.find(key, signal));
+  EXPECT_EQ(cache.size(), 0);
+}
+
+}  // namespace unit_test
+}  // namespace strategies
+}  // namespace auto_trader
@@ -29,7 +29,9 @@
 
 #include <QtCore/QThread>
 #include <QtWidgets/QApplication>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "app_chart_updater.h"
 #include "app_stats_updater.h"
@@ -43,9 +45,11 @@
 #include "model/include/holders/trade_signaled_strategy_market_holder.h"
 #include "model/include/settings/app_settings.h"
 #include "stocks_exchange/include/stock_exchange_library.h"
-#include "strategies/include/strategy_facade.h"
+#include "strategies/include/strategy_pool.h"
+#include "trading_engine.h"
 #include "trading_manager.h"
 #include "trading_message_sender.h"
+#include "trading_worker_pool.h"
 
 namespace auto_trader {
 namespace trader {
@@ -100,6 +104,10 @@ class AppController : public QObject, public common::AppListener {
 
   void stopTradingThread();
 
+  // Trades the named configurations in the background until the application closes, next to
+  // the configuration started from the main window.
+  void runTradingEngine(const std::vector<std::string> &configurationNames);
+
  public slots:
   void refreshTradingCurrenciesUI();
   void refreshAllCurrenciesUI();
@@ -136,22 +144,25 @@ class AppController : public QObject, public common::AppListener {
 
   std::unique_ptr<common::GuiListener> guiListener_;
 
-  std::unique_ptr<strategies::StrategyFacade> strategyFacade_;
   std::unique_ptr<stock_exchange::StockExchangeLibrary> stockExchangeLibrary_;
 
   std::unique_ptr<AppStatsUpdater> appStatsUpdater_;
   std::unique_ptr<AppChartUpdater> appChartUpdater_;
 
+  std::unique_ptr<TradingWorkerPool> workerPool_;
+  std::unique_ptr<strategies::StrategyPool> strategyPool_;
   std::unique_ptr<TradingMessageSender> messageSender_;
   std::unique_ptr<TradingManager> tradingManager_;
 
   std::unique_ptr<database::Database> databaseProvider_;
+  std::unique_ptr<TradingEngine> tradingEngine_;
 
   model::AppSettings appSettings_;
 
   QThread statsUpdateThread_;
   QThread chartUpdateThread_;
   QThread tradingThread_;
+  std::thread tradingEngineThread_;
 };
 
 }  // namespace trader
@@ -27,6 +27,7 @@
 #ifndef AUTO_TRADER_TRADING_BUYING_STRATEGY_PROCESSOR_H
 #define AUTO_TRADER_TRADING_BUYING_STRATEGY_PROCESSOR_H
 
+#include <functional>
 #include <memory>
 #include <set>
 
@@ -43,9 +44,14 @@
 #include "model/include/trade_configuration.h"
 #include "stocks_exchange/include/currency_lots_holder.h"
 #include "stocks_exchange/include/stock_exchange_library.h"
-#include "strategies/include/strategy_facade.h"
+#include "strategies/include/strategy_pool.h"
+#include "strategies/include/strategy_result_cache.h"
+#include "trading_lookback_planner.h"
 #include "trading_manager.h"
+#include "trading_market_histories.h"
 #include "trading_message_sender.h"
+#include "trading_strategy_evaluator.h"
+#include "trading_worker_pool.h"
 
 namespace auto_trader {
 
@@ -63,13 +69,15 @@ namespace trader {
 class TradingBuyingStrategyProcessor : private model::StrategySettingsVisitor {
  public:
   TradingBuyingStrategyProcessor(
-      stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyFacade &strategiesLibrary,
+      stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyPool &strategyPool,
       database::Database &databaseProvider, common::AppListener &appListener,
       const model::StrategiesSettingsHolder &strategiesSettingsHolder,
       model::TradeOrdersHolder &tradeOrdersHolder,
       model::TradeSignaledStrategyMarketHolder &tradeSignaledStrategyMarketHolder,
       const model::TradeConfiguration &tradeConfiguration, TradingMessageSender &messageSender,
-      const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager);
+      const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager,
+      TradingWorkerPool &workerPool, TradingMarketHistories &marketHistories,
+      strategies::StrategyResultCache &resultCache);
 
   void run();
 
@@ -90,10 +98,11 @@ class TradingBuyingStrategyProcessor : private model::StrategySettingsVisitor {
   void updateCrossingPoint(const model::StrategySettings &strategySettings,
                            double lastCrossingPoint);
   common::MarketHistoryPtr getMarketHistory(common::TickInterval::Enum interval) const;
+  common::MarketHistoryPtr getMarketHistory(common::Currency::Enum tradedCurrency,
+                                            common::TickInterval::Enum interval) const;
 
  private:
   stock_exchange::QueryProcessor &queryProcessor_;
-  strategies::StrategyFacade &strategiesLibrary_;
   database::Database &databaseProvider_;
   common::AppListener &appListener_;
   const model::TradeConfiguration &tradeConfiguration_;
@@ -103,10 +112,14 @@ class TradingBuyingStrategyProcessor : private model::StrategySettingsVisitor {
   TradingMessageSender &messageSender_;
   const stock_exchange::CurrencyLotsHolder &lotsHolder_;
   const TradingManager &tradingManager_;
+  TradingWorkerPool &workerPool_;
+  TradingMarketHistories &marketHistories_;
+  TradingStrategyEvaluator strategyEvaluator_;
 
  private:
   std::map<common::StrategiesType, common::MarketData> strategyMarkets_;
   std::map<const model::StrategySettings *, double> strategyCrossingPoints_;
+  CandlesLookbacks candlesLookbacks_;
 
   common::Currency::Enum currentTradedCurrency;
   bool processingResult;
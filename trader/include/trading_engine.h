@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_ENGINE_H
+#define AUTO_TRADER_TRADING_ENGINE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/listeners/app_listener.h"
+#include "common/listeners/gui_listener.h"
+#include "database/include/database.h"
+#include "model/include/holders/strategies_settings_holder.h"
+#include "model/include/holders/trade_configs_holder.h"
+#include "model/include/settings/app_settings.h"
+#include "stocks_exchange/include/query_processor.h"
+#include "strategies/include/strategy_pool.h"
+#include "trading_session.h"
+#include "trading_worker_pool.h"
+
+namespace auto_trader {
+namespace trader {
+
+// Trades several configurations in one process, a TradingSession each. Every session keeps its
+// own schedule; the engine wakes at the earliest one and runs the cycles that are due one after
+// another. The per-market work of every cycle fans out on the worker pool, with strategies leased
+// from the strategy pool; the sessions share both pools with each other and with the rest of the
+// application.
+class TradingEngine {
+ public:
+  TradingEngine(stock_exchange::QueryProcessor& queryProcessor,
+                database::Database& databaseProvider, common::AppListener& appListener,
+                common::GuiListener& guiListener, model::AppSettings& appSettings,
+                model::StrategiesSettingsHolder& strategiesSettingsHolder,
+                model::TradeConfigsHolder& tradeConfigsHolder, TradingWorkerPool& workerPool,
+                strategies::StrategyPool& strategyPool);
+
+  TradingEngine(const TradingEngine&) = delete;
+  TradingEngine& operator=(const TradingEngine&) = delete;
+
+  // Trades the named configurations until stop() is called or every session has stopped.
+  // Throws when two configurations trade the same market, since the database keeps the orders
+  // of a market for one configuration.
+  void run(const std::vector<std::string>& configurationNames);
+  // Also cancels a run that has not started yet, e.g. one still waiting for its thread.
+  void stop();
+
+  bool isRunning() const;
+
+ private:
+  void checkMarkets(const std::vector<std::string>& configurationNames) const;
+
+ private:
+  stock_exchange::QueryProcessor& queryProcessor_;
+  database::Database& databaseProvider_;
+  common::AppListener& appListener_;
+  common::GuiListener& guiListener_;
+  model::AppSettings& appSettings_;
+  model::StrategiesSettingsHolder& strategiesSettingsHolder_;
+  model::TradeConfigsHolder& tradeConfigsHolder_;
+
+  TradingWorkerPool& workerPool_;
+  strategies::StrategyPool& strategyPool_;
+
+  std::vector<std::unique_ptr<TradingSession>> sessions_;
+
+  mutable std::mutex locker_;
+  std::condition_variable condVar_;
+  std::atomic_bool isRunning_;
+  bool isStopRequested_;
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_ENGINE_H
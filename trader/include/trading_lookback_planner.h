@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_LOOKBACK_PLANNER_H
+#define AUTO_TRADER_TRADING_LOOKBACK_PLANNER_H
+
+#include <map>
+
+#include "common/enumerations/tick_interval.h"
+#include "model/include/settings/strategies_settings/strategy_settings.h"
+#include "model/include/settings/strategies_settings/strategy_settings_visitor.h"
+
+namespace auto_trader {
+namespace trader {
+
+typedef std::map<common::TickInterval::Enum, size_t> CandlesLookbacks;
+
+// Counts how many of the newest candles a strategy needs per tick interval: the longest
+// indicator window, its crossing interval and the still-open candle. Exponential averages start
+// from a simple average of their first period, so they get emaWarmUpFactor periods of history
+// for the seed to fade out before the candles the strategy looks at.
+class TradingLookbackPlanner : private model::StrategySettingsVisitor {
+ public:
+  static constexpr double DEFAULT_EMA_WARM_UP_FACTOR = 3.0;
+
+  explicit TradingLookbackPlanner(double emaWarmUpFactor = DEFAULT_EMA_WARM_UP_FACTOR);
+
+  CandlesLookbacks plan(const model::StrategySettings& strategySettings);
+
+ private:
+  void visit(const model::BollingerBandsSettings& bandsSettings) final;
+  void visit(const model::BollingerBandsAdvancedSettings& bandsAdvancedSettings) final;
+  void visit(const model::RsiSettings& rsiSettings) final;
+  void visit(const model::EmaSettings& emaSettings) final;
+  void visit(const model::SmaSettings& smaSettings) final;
+  void visit(const model::MovingAveragesCrossingSettings& movingAveragesCrossingSettings) final;
+  void visit(const model::StochasticOscillatorSettings& stochasticOscillatorSettings) final;
+  void visit(const model::CustomStrategySettings& customStrategySettings) final;
+
+ private:
+  size_t getEmaWindow(int period) const;
+  void addLookback(common::TickInterval::Enum interval, size_t window, int crossingInterval);
+
+ private:
+  double emaWarmUpFactor_;
+  CandlesLookbacks lookbacks_;
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_LOOKBACK_PLANNER_H
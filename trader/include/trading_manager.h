@@ -29,12 +29,15 @@
 
 #include <QObject>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <unordered_set>
 
 #include "common/currency.h"
 #include "common/enumerations/stock_exchange_type.h"
+#include "common/enumerations/tick_interval.h"
 #include "common/listeners/gui_listener.h"
 #include "common/market_order.h"
 #include "database/include/database.h"
@@ -48,8 +51,12 @@
 #include "model/include/trade_configuration.h"
 #include "stocks_exchange/include/currency_lots_holder.h"
 #include "stocks_exchange/include/stock_exchange_library.h"
-#include "strategies/include/strategy_facade.h"
+#include "strategies/include/strategy_pool.h"
+#include "strategies/include/strategy_result_cache.h"
+#include "trading_market_histories.h"
 #include "trading_message_sender.h"
+#include "trading_scheduler.h"
+#include "trading_worker_pool.h"
 
 namespace auto_trader {
 namespace trader {
@@ -59,13 +66,15 @@ class TradingManager : public QObject {
 
  public:
   TradingManager(stock_exchange::QueryProcessor& queryProcessor,
-                 strategies::StrategyFacade& strategyFacade, database::Database& databaseProvider,
+                 strategies::StrategyPool& strategyPool, database::Database& databaseProvider,
                  common::AppListener& appListener, common::GuiListener& guiListener,
                  model::AppSettings& appSettings, TradingMessageSender& messageSender_,
                  model::StrategiesSettingsHolder& strategiesSettingsHolder,
                  model::TradeOrdersHolder& tradeOrdersHolder,
                  model::TradeConfigsHolder& tradeConfigsHolder,
-                 model::TradeSignaledStrategyMarketHolder& tradeSignaledStrategyMarketHolder);
+                 model::TradeSignaledStrategyMarketHolder& tradeSignaledStrategyMarketHolder,
+                 TradingWorkerPool& workerPool,
+                 const std::string& configurationName = std::string());
 
   void reset(bool value);
 
@@ -76,9 +85,32 @@ class TradingManager : public QObject {
  public:
   bool isRunning() const;
 
+  // The steps of startTradingSlot, for running the manager as a session of a TradingEngine.
+  // runCycle returns false once trading stopped; the next cycle is due at getNextWakeUp.
+  void startTrading();
+  bool runCycle();
+  void finishTrading();
+  TradingScheduler::Clock::time_point getNextWakeUp() const;
+
+  // Empty when the manager trades the current configuration of the holder.
+  const std::string& getConfigurationName() const;
+
+  // Guards the strategies settings, which the sessions of every configuration update and save.
+  static std::mutex& getStrategiesSettingsMutex();
+
  private:
-  void prepareBuying();
-  void prepareSelling();
+  model::TradeConfiguration& takeTradeConfiguration() const;
+
+  // Intervals of the current strategy, whose candle closes trigger its runs.
+  std::set<common::TickInterval::Enum> getStrategyIntervals() const;
+
+  // The database writes of one cycle are committed together once it ends.
+  bool tradeCycle();
+
+  // Open orders of all traded markets from one request, shared by both prepare steps of a cycle.
+  bool fetchAccountOpenOrders(std::vector<common::MarketOrder>& openOrders);
+  void prepareBuying(const std::vector<common::MarketOrder>& openOrders);
+  void prepareSelling(const std::vector<common::MarketOrder>& openOrders);
 
   void loadOrders();
 
@@ -94,7 +126,8 @@ class TradingManager : public QObject {
       const std::set<common::MarketOrder>& orders);
 
   void uploadBuyingOrders();
-  void uploadSellOrders();
+  // Take profit runs on every cycle, the selling strategy only when a candle of it closed.
+  void uploadSellOrders(bool isStrategyDue);
 
   void runStopLoss();
 
@@ -112,7 +145,7 @@ class TradingManager : public QObject {
 
  private:
   stock_exchange::QueryProcessor& queryProcessor_;
-  strategies::StrategyFacade& strategyFacade_;
+  strategies::StrategyPool& strategyPool_;
   database::Database& databaseProvider_;
   common::AppListener& appListener_;
   common::GuiListener& guiListener_;
@@ -123,6 +156,13 @@ class TradingManager : public QObject {
   model::TradeSignaledStrategyMarketHolder& tradeSignaledStrategyMarketHolder_;
   TradingMessageSender& messageSender_;
   stock_exchange::CurrencyLotsHolder currencyLotsHolder_;
+  TradingWorkerPool& workerPool_;
+  TradingMarketHistories marketHistories_;
+  strategies::StrategyResultCache resultCache_;
+
+  const std::string configurationName_;
+  model::TradeConfiguration* tradeConfiguration_;
+  std::unique_ptr<TradingScheduler> scheduler_;
 
   std::mutex locker_;
   std::condition_variable condVar_;
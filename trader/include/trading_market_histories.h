@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_MARKET_HISTORIES_H
+#define AUTO_TRADER_TRADING_MARKET_HISTORIES_H
+
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+#include "common/currency.h"
+#include "common/enumerations/tick_interval.h"
+#include "common/market_history.h"
+#include "stocks_exchange/include/query.h"
+#include "trading_lookback_planner.h"
+#include "trading_worker_pool.h"
+
+namespace auto_trader {
+namespace trader {
+
+// Candles downloaded during one trading cycle, shared by every strategy and processor of the
+// cycle. The first request of a market and interval downloads it; repeated and concurrent
+// requests of the same market wait for that download instead of starting their own.
+class TradingMarketHistories {
+ public:
+  // Requests the market history without a candles count, at the exchange default size.
+  static constexpr size_t ALL_CANDLES = std::numeric_limits<size_t>::max();
+
+  // The newest candlesCount candles of the market. A failed download is rethrown to every
+  // request waiting for it and is not kept, so a later request tries again.
+  common::MarketHistoryPtr get(stock_exchange::Query& query, common::Currency::Enum baseCurrency,
+                               common::Currency::Enum tradedCurrency,
+                               common::TickInterval::Enum interval, size_t candlesCount);
+
+  // Downloads every traded market at every planned interval on the worker pool, so the strategy
+  // pass finds them ready.
+  void load(stock_exchange::Query& query, common::Currency::Enum baseCurrency,
+            const std::vector<common::Currency::Enum>& tradedCurrencies,
+            const CandlesLookbacks& candlesLookbacks, TradingWorkerPool& workerPool);
+
+  // Starts a new cycle.
+  void clear();
+
+ private:
+  typedef std::tuple<common::Currency::Enum, common::Currency::Enum, common::TickInterval::Enum>
+      MarketKey;
+
+  struct Download {
+    size_t candlesCount_;
+    std::shared_future<std::shared_ptr<const common::MarketHistory>> marketHistory_;
+  };
+
+  std::mutex mutex_;
+  std::map<MarketKey, std::shared_ptr<Download>> downloads_;
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_MARKET_HISTORIES_H
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_SCHEDULER_H
+#define AUTO_TRADER_TRADING_SCHEDULER_H
+
+#include <chrono>
+#include <map>
+#include <set>
+
+#include "common/enumerations/tick_interval.h"
+
+namespace auto_trader {
+namespace trader {
+
+// Decides when the trading loop wakes up and whether the strategy runs then. Order statuses,
+// take profit and stop loss are polled every ordersPollingPeriod, while the strategy runs only
+// once a candle of one of its intervals has closed. All markets of an exchange share the candle
+// boundaries of an interval, so one close per interval covers every traded pair. A closed candle
+// is given settlementDelay to appear in the exchange history before it is requested. Candle
+// boundaries are taken in the exchange time zone, candlesUtcOffset east of UTC.
+class TradingScheduler {
+ public:
+  typedef std::chrono::system_clock Clock;
+
+  static const std::chrono::seconds DEFAULT_SETTLEMENT_DELAY;
+
+  // A zero polling period runs the whole cycle back to back, the strategy included.
+  explicit TradingScheduler(std::chrono::seconds ordersPollingPeriod,
+                            std::chrono::seconds settlementDelay = DEFAULT_SETTLEMENT_DELAY,
+                            std::chrono::seconds candlesUtcOffset = std::chrono::seconds(0));
+
+  // Schedules the candle closes of intervals not scheduled yet and drops the ones no longer used.
+  void setIntervals(const std::set<common::TickInterval::Enum>& intervals, Clock::time_point now);
+
+  // Moves the schedule to now. Returns true on the first step and whenever a candle closed since
+  // the previous step.
+  bool takeStep(Clock::time_point now);
+
+  Clock::time_point getNextWakeUp() const;
+
+  // The end of the candle that is open at time, or time itself for an unknown interval.
+  static Clock::time_point getCandleClose(
+      common::TickInterval::Enum interval, Clock::time_point time,
+      std::chrono::seconds candlesUtcOffset = std::chrono::seconds(0));
+
+ private:
+  std::chrono::seconds ordersPollingPeriod_;
+  std::chrono::seconds settlementDelay_;
+  std::chrono::seconds candlesUtcOffset_;
+
+  std::map<common::TickInterval::Enum, Clock::time_point> candlesSettlements_;
+  Clock::time_point nextOrdersPolling_;
+  bool isFirstStep_;
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_SCHEDULER_H
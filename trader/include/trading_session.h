@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_SESSION_H
+#define AUTO_TRADER_TRADING_SESSION_H
+
+#include <string>
+
+#include "common/listeners/app_listener.h"
+#include "common/listeners/gui_listener.h"
+#include "database/include/database.h"
+#include "model/include/holders/strategies_settings_holder.h"
+#include "model/include/holders/trade_configs_holder.h"
+#include "model/include/holders/trade_orders_holder.h"
+#include "model/include/holders/trade_signaled_strategy_market_holder.h"
+#include "model/include/settings/app_settings.h"
+#include "stocks_exchange/include/query_processor.h"
+#include "strategies/include/strategy_pool.h"
+#include "trading_manager.h"
+#include "trading_message_sender.h"
+#include "trading_worker_pool.h"
+
+namespace auto_trader {
+namespace trader {
+
+// One trade configuration traded by its own TradingManager. The orders, signaled markets,
+// indicator results and message prefix of a session are its own; the query processor with its
+// connection pools and candle caches, the worker and strategy pools, the database and the
+// settings are shared by all sessions.
+class TradingSession {
+ public:
+  TradingSession(const std::string& configurationName,
+                 stock_exchange::QueryProcessor& queryProcessor,
+                 database::Database& databaseProvider, common::AppListener& appListener,
+                 common::GuiListener& guiListener, model::AppSettings& appSettings,
+                 model::StrategiesSettingsHolder& strategiesSettingsHolder,
+                 model::TradeConfigsHolder& tradeConfigsHolder, TradingWorkerPool& workerPool,
+                 strategies::StrategyPool& strategyPool);
+
+  TradingSession(const TradingSession&) = delete;
+  TradingSession& operator=(const TradingSession&) = delete;
+
+  TradingManager& getTradingManager();
+  TradingMessageSender& getMessageSender();
+
+ private:
+  model::TradeOrdersHolder tradeOrdersHolder_;
+  model::TradeSignaledStrategyMarketHolder tradeSignaledStrategyMarketHolder_;
+  TradingMessageSender messageSender_;
+  TradingManager tradingManager_;
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_SESSION_H
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_STRATEGY_EVALUATOR_H
+#define AUTO_TRADER_TRADING_STRATEGY_EVALUATOR_H
+
+#include <functional>
+#include <vector>
+
+#include "common/currency.h"
+#include "common/enumerations/strategies_type.h"
+#include "common/enumerations/tick_interval.h"
+#include "common/market_history.h"
+#include "model/include/settings/strategies_settings/strategy_settings.h"
+#include "model/include/settings/strategies_settings/strategy_settings_visitor.h"
+#include "model/include/trade_configuration.h"
+#include "strategies/include/strategy_batch.h"
+#include "strategies/include/strategy_pool.h"
+#include "strategies/include/strategy_result_cache.h"
+#include "strategies/include/strategy_signal.h"
+#include "trading_worker_pool.h"
+
+namespace auto_trader {
+namespace trader {
+
+// Evaluates the indicators of one trade configuration into the cycle's result cache.
+// evaluateMarkets() runs one strategy batch per indicator over all the traded markets, and the
+// buying, selling and stop loss processors then read every (market, indicator) signal with
+// evaluate(). evaluate() builds lines only for what the batch did not cover, e.g. after an order
+// moved a crossing point of the settings. The markets of a batch are split into one range per
+// worker; every worker evaluates its range with a context leased from the strategy pool, and the
+// cache is filled on the calling thread once all of them are done.
+class TradingStrategyEvaluator : private model::StrategySettingsVisitor {
+ public:
+  using MarketHistoryGetter = std::function<common::MarketHistoryPtr(
+      common::Currency::Enum tradedCurrency, common::TickInterval::Enum interval)>;
+
+  TradingStrategyEvaluator(strategies::StrategyPool& strategyPool,
+                           strategies::StrategyResultCache& resultCache,
+                           TradingWorkerPool& workerPool,
+                           const model::TradeConfiguration& tradeConfiguration);
+
+  // A market whose history cannot be read is skipped here and reported by evaluate().
+  void evaluateMarkets(const model::StrategySettings& strategySettings,
+                       const std::vector<common::Currency::Enum>& tradedCurrencies,
+                       const MarketHistoryGetter& getMarketHistory);
+
+  // Throws StrategyException when the lines of the market cannot be built.
+  strategies::StrategySignal evaluate(common::Currency::Enum tradedCurrency,
+                                      const model::StrategySettings& strategySettings,
+                                      const common::MarketHistory& marketHistory);
+
+ private:
+  void visit(const model::BollingerBandsSettings& bandsSettings) final;
+  void visit(const model::BollingerBandsAdvancedSettings& bandsAdvancedSettings) final;
+  void visit(const model::RsiSettings& rsiSettings) final;
+  void visit(const model::EmaSettings& emaSettings) final;
+  void visit(const model::SmaSettings& smaSettings) final;
+  void visit(const model::MovingAveragesCrossingSettings& movingAveragesCrossingSettings) final;
+  void visit(const model::StochasticOscillatorSettings& stochasticOscillatorSettings) final;
+  void visit(const model::CustomStrategySettings& customStrategySettings) final;
+
+  void bindIndicator(const model::StrategySettings& strategySettings,
+                     common::StrategiesType strategyType,
+                     strategies::StrategyBatch::CreateFunction createLines);
+  void evaluateBoundIndicator(const model::StrategySettings& strategySettings);
+  void evaluateRange(const strategies::StrategyBatch::Markets& markets, size_t begin, size_t end,
+                     std::vector<strategies::StrategySignal>& marketSignals);
+
+  strategies::StrategyResultKey createKey(common::Currency::Enum tradedCurrency,
+                                          const model::StrategySettings& strategySettings,
+                                          const common::MarketHistory& marketHistory) const;
+
+ private:
+  strategies::StrategyPool& strategyPool_;
+  strategies::StrategyResultCache& resultCache_;
+  TradingWorkerPool& workerPool_;
+  const model::TradeConfiguration& tradeConfiguration_;
+
+  // Indicator of the settings visited last.
+  common::StrategiesType strategyType_{common::StrategiesType::UNKNOWN};
+  strategies::StrategyBatch::CreateFunction createLines_;
+
+  // Markets of the running evaluateMarkets() call; null outside of it.
+  const std::vector<common::Currency::Enum>* tradedCurrencies_{nullptr};
+  const MarketHistoryGetter* getMarketHistory_{nullptr};
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_STRATEGY_EVALUATOR_H
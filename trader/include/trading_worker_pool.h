@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef AUTO_TRADER_TRADING_WORKER_POOL_H
+#define AUTO_TRADER_TRADING_WORKER_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace auto_trader {
+namespace trader {
+
+// A fixed set of threads for fanning the per-market work of a trading cycle out. Every batch
+// splits its task indices into one queue per participating worker, the calling thread
+// included; a worker drains its own queue from the front and then steals from the back of the
+// others, so one slow download does not hold the rest of its share back.
+class TradingWorkerPool {
+ public:
+  // workersCount counts the thread calling run(), so a pool of one runs everything inline.
+  explicit TradingWorkerPool(size_t workersCount = getDefaultWorkersCount());
+  ~TradingWorkerPool();
+
+  TradingWorkerPool(const TradingWorkerPool&) = delete;
+  TradingWorkerPool& operator=(const TradingWorkerPool&) = delete;
+
+  // Calls task for every index below tasksCount on at most parallelism workers and returns once
+  // all calls have finished. The task must not throw. Batches of concurrent callers run one
+  // after another.
+  void run(size_t tasksCount, size_t parallelism, const std::function<void(size_t)>& task);
+
+  size_t getWorkersCount() const { return threads_.size() + 1; }
+
+  static size_t getDefaultWorkersCount();
+
+ private:
+  struct TaskQueue {
+    std::mutex mutex_;
+    std::deque<size_t> indices_;
+  };
+
+  void work(size_t threadIndex);
+  void processTasks(size_t queueIndex);
+  bool takeTask(size_t queueIndex, size_t& taskIndex);
+
+ private:
+  std::vector<std::thread> threads_;
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+
+  std::mutex runMutex_;
+
+  std::mutex batchMutex_;
+  std::condition_variable batchStarted_;
+  std::condition_variable batchFinished_;
+  const std::function<void(size_t)>* task_{nullptr};
+  size_t batchId_{0};
+  size_t participantsCount_{0};
+  size_t busyWorkersCount_{0};
+  bool isStopping_{false};
+};
+
+}  // namespace trader
+}  // namespace auto_trader
+
+#endif  // AUTO_TRADER_TRADING_WORKER_POOL_H
@@ -74,7 +74,6 @@ AppController::AppController(QApplication &application) : application_(applicati
   tradeOrdersHolder_ = std::make_unique<model::TradeOrdersHolder>();
   tradeSignaledStrategyMarketHolder_ = std::make_unique<model::TradeSignaledStrategyMarketHolder>();
 
-  strategyFacade_ = std::make_unique<strategies::StrategyFacade>();
   stockExchangeLibrary_ = std::make_unique<stock_exchange::StockExchangeLibrary>();
 
   guiListener_ = std::make_unique<view::GuiProcessor>(*this);
@@ -87,14 +86,24 @@ AppController::AppController(QApplication &application) : application_(applicati
   appChartUpdater_->moveToThread(&chartUpdateThread_);
   chartUpdateThread_.start();
 
-  databaseProvider_ = std::make_unique<database::Database>();
+  databaseProvider_ = std::make_unique<database::Database>(/*isWriteBehind=*/true);
 
   messageSender_ = std::make_unique<TradingMessageSender>(*guiListener_, appSettings_);
 
+  // One pool serves the window's trading and every configuration of the trading engine.
+  workerPool_ = std::make_unique<TradingWorkerPool>();
+  // A strategy context for every worker, so a trading cycle leases without creating one.
+  strategyPool_ = std::make_unique<strategies::StrategyPool>(workerPool_->getWorkersCount());
+
   tradingManager_ = std::make_unique<TradingManager>(
-      stockExchangeLibrary_->getQueryProcessor(), *strategyFacade_, *databaseProvider_, *this,
+      stockExchangeLibrary_->getQueryProcessor(), *strategyPool_, *databaseProvider_, *this,
       *guiListener_, appSettings_, *messageSender_, *strategiesSettingsHolder_, *tradeOrdersHolder_,
-      *tradeConfigurationsHolder_, *tradeSignaledStrategyMarketHolder_);
+      *tradeConfigurationsHolder_, *tradeSignaledStrategyMarketHolder_, *workerPool_);
+
+  tradingEngine_ = std::make_unique<TradingEngine>(
+      stockExchangeLibrary_->getQueryProcessor(), *databaseProvider_, *this, *guiListener_,
+      appSettings_, *strategiesSettingsHolder_, *tradeConfigurationsHolder_, *workerPool_,
+      *strategyPool_);
 
   tradingManager_->moveToThread(&tradingThread_);
   tradingThread_.start();
@@ -267,6 +276,8 @@ void AppController::loadAppSettings() {
     common::loggers::FileLogger::getLogger() << exception.what();
   }
 
+  stockExchangeLibrary_->getQueryProcessor().setMaxConnectionsPerHost(
+      appSettings_.maxConnectionsPerHost_);
   changeTheme(appSettings_.theme_);
 }
 
@@ -468,6 +479,25 @@ void AppController::stopTradingThread() {
 
   tradingThread_.quit();
   tradingThread_.wait();
+
+  tradingEngine_->stop();
+  if (tradingEngineThread_.joinable()) {
+    tradingEngineThread_.join();
+  }
+}
+
+void AppController::runTradingEngine(const std::vector<std::string> &configurationNames) {
+  if (tradingEngineThread_.joinable()) {
+    return;
+  }
+
+  tradingEngineThread_ = std::thread([this, configurationNames]() {
+    try {
+      tradingEngine_->run(configurationNames);
+    } catch (std::exception &exception) {
+      common::loggers::FileLogger::getLogger() << exception.what();
+    }
+  });
 }
 
 void AppController::stopStatsUpdater() {
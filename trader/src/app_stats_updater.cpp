@@ -313,8 +313,8 @@ void AppStatsUpdater::refreshTradingCurrencies() {
       try {
         common::CurrencyTick currencyTick{0.0, 0.0, coinSettings.baseCurrency_,
                                           coinSettings.tradedCurrencies_[index]};
-        auto tick = query->getCurrencyTick(coinSettings.baseCurrency_,
-                                           coinSettings.tradedCurrencies_[index]);
+        auto tick = query->getTickFromAllTicks(coinSettings.baseCurrency_,
+                                               coinSettings.tradedCurrencies_[index]);
         currencyTick.bid_ = tick.bid_;
         currencyTick.ask_ = tick.ask_;
 
@@ -358,7 +358,7 @@ void AppStatsUpdater::refreshAllCurrencies() {
       }
       try {
         auto toCurrency = allTradedCurrencies.at(index);
-        auto tick = query->getCurrencyTick(coinSettings.baseCurrency_, toCurrency);
+        auto tick = query->getTickFromAllTicks(coinSettings.baseCurrency_, toCurrency);
         common::CurrencyTick currencyTick{tick.ask_, tick.bid_, coinSettings.baseCurrency_,
                                           toCurrency};
         allCurrencies_.push_back(currencyTick);
@@ -387,7 +387,13 @@ void AppStatsUpdater::refreshAccountBalance() {
   auto query = queryProcessor.getQuery(stockExchangeSettings.stockExchangeType_);
 
   try {
-    double baseCurrencyBalance = query->getBalance(coinSettings.baseCurrency_);
+    auto balances = query->getBalances();
+    auto getCurrencyBalance = [&balances](common::Currency::Enum currency) {
+      auto balanceIt = balances.find(currency);
+      return balanceIt != balances.end() ? balanceIt->second : 0.0;
+    };
+
+    double baseCurrencyBalance = getCurrencyBalance(coinSettings.baseCurrency_);
     accountBalance_.emplace_back(std::make_pair(coinSettings.baseCurrency_, baseCurrencyBalance));
 
     size_t tradedCurrenciesCount = coinSettings.tradedCurrencies_.size();
@@ -399,7 +405,7 @@ void AppStatsUpdater::refreshAccountBalance() {
         emit statsUpdateInterrupted();
         return;
       }
-      double balance = query->getBalance(coinSettings.tradedCurrencies_[index]);
+      double balance = getCurrencyBalance(coinSettings.tradedCurrencies_[index]);
       accountBalance_.emplace_back(std::make_pair(coinSettings.tradedCurrencies_[index], balance));
     }
   } catch (std::exception& exception) {
@@ -472,12 +478,15 @@ void AppStatsUpdater::refreshOpenOrders() {
         emit statsUpdateInterrupted();
         return;
       }
+      const auto& tradedCoins = coinSettings.tradedCurrencies_;
+      auto allOrders = query->getAllAccountOpenOrders();
       std::vector<common::MarketOrder> marketOrders;
-      for (const auto& tradedCoin : coinSettings.tradedCurrencies_) {
-        std::vector<common::MarketOrder> allOrders =
-            query->getAccountOpenOrders(coinSettings.baseCurrency_, tradedCoin);
-        std::copy(allOrders.begin(), allOrders.end(), std::back_inserter(marketOrders));
-      }
+      std::copy_if(allOrders.begin(), allOrders.end(), std::back_inserter(marketOrders),
+                   [&](const common::MarketOrder& order) {
+                     return order.fromCurrency_ == coinSettings.baseCurrency_ &&
+                            std::find(tradedCoins.begin(), tradedCoins.end(),
+                                      order.toCurrency_) != tradedCoins.end();
+                   });
       auto buyOrders = filtrateOrdersForType(marketOrders, common::OrderType::BUY);
       auto sellOrders = filtrateOrdersForType(marketOrders, common::OrderType::SELL);
 
@@ -29,10 +29,13 @@
 #include <QMessageBox>
 #include <QPixmap>
 #include <QSplashScreen>
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QSharedMemory>
 #include <QtCore/QSystemSemaphore>
 #include <QtWidgets/QApplication>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "common/exceptions/base_exception.h"
 #include "common/loggers/file_logger.h"
@@ -70,6 +73,20 @@ int Trader::init(int argc, char** argv) {
   sharedMemory.create(1);
   semaphore.release();
 
+  // Configurations given with --configurations are traded together by the trading engine.
+  QCommandLineParser commandLineParser;
+  QCommandLineOption configurationsOption(
+      "configurations", "Trade configurations traded in the background, comma separated.",
+      "names");
+  commandLineParser.addOption(configurationsOption);
+  commandLineParser.process(application);
+
+  std::vector<std::string> engineConfigurations;
+  for (const auto& name :
+       commandLineParser.value(configurationsOption).split(",", QString::SkipEmptyParts)) {
+    engineConfigurations.push_back(name.trimmed().toStdString());
+  }
+
   application.setAttribute(Qt::AA_DisableWindowContextHelpButton);
   setlocale(LC_NUMERIC, "C");
   auto appController_ = std::make_unique<AppController>(application);
@@ -91,6 +108,10 @@ int Trader::init(int argc, char** argv) {
 
     appController_->startStatsUpdater();
 
+    if (!engineConfigurations.empty()) {
+      appController_->runTradingEngine(engineConfigurations);
+    }
+
     guiListener.refreshStrategiesView();
     guiListener.refreshTradeConfigurationView();
     guiListener.refreshStockExchangeChartInterval();
@@ -26,6 +26,8 @@
 
 #include "include/trading_buying_strategy_processor.h"
 
+#include <cmath>
+
 #include "model/include/settings/strategies_settings/bollinger_bands_advanced_settings.h"
 #include "model/include/settings/strategies_settings/bollinger_bands_settings.h"
 #include "model/include/settings/strategies_settings/custom_strategy_settings.h"
@@ -41,15 +43,16 @@ namespace auto_trader {
 namespace trader {
 
 TradingBuyingStrategyProcessor::TradingBuyingStrategyProcessor(
-    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyFacade &strategiesLibrary,
+    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyPool &strategyPool,
     database::Database &databaseProvider, common::AppListener &appListener,
     const model::StrategiesSettingsHolder &strategiesSettingsHolder,
     model::TradeOrdersHolder &tradeOrdersHolder,
     model::TradeSignaledStrategyMarketHolder &tradeSignaledStrategyMarketHolder,
     const model::TradeConfiguration &tradeConfiguration, TradingMessageSender &messageSender,
-    const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager)
+    const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager,
+    TradingWorkerPool &workerPool, TradingMarketHistories &marketHistories,
+    strategies::StrategyResultCache &resultCache)
     : queryProcessor_(queryProcessor),
-      strategiesLibrary_(strategiesLibrary),
       databaseProvider_(databaseProvider),
       appListener_(appListener),
       tradeConfiguration_(tradeConfiguration),
@@ -59,6 +62,9 @@ TradingBuyingStrategyProcessor::TradingBuyingStrategyProcessor(
       messageSender_(messageSender),
       lotsHolder_(lotsHolder),
       tradingManager_(tradingManager),
+      workerPool_(workerPool),
+      marketHistories_(marketHistories),
+      strategyEvaluator_(strategyPool, resultCache, workerPool, tradeConfiguration),
       currentTradedCurrency(common::Currency::UNKNOWN),
       processingResult(true) {}
 
@@ -72,6 +78,14 @@ void TradingBuyingStrategyProcessor::run() {
 
   bool anyIndicatorTriggered =
       tradeConfiguration_.getBuySettings().openOrderWhenAnyIndicatorIsTriggered_;
+  candlesLookbacks_ = TradingLookbackPlanner().plan(strategySettings);
+  marketHistories_.load(*query, coinSettings.baseCurrency_, coinSettings.tradedCurrencies_,
+                        candlesLookbacks_, workerPool_);
+  strategyEvaluator_.evaluateMarkets(
+      strategySettings, coinSettings.tradedCurrencies_,
+      [this](common::Currency::Enum tradedCurrency, common::TickInterval::Enum interval) {
+        return getMarketHistory(tradedCurrency, interval);
+      });
 
   size_t tradedCurrenciesSize = coinSettings.tradedCurrencies_.size();
   for (int index = 0; index < tradedCurrenciesSize; ++index) {
@@ -142,18 +156,14 @@ void TradingBuyingStrategyProcessor::visit(const model::BollingerBandsSettings &
     }
   }
 
-  auto currentStrategy = strategiesLibrary_.getBollingerBandStrategy();
-  currentStrategy->createLines(marketHistory->marketData_, bandsSettings.period_,
-                               bandsSettings.bbInputType_, bandsSettings.standardDeviations_,
-                               bandsSettings.crossingInterval_, bandsSettings.lastBuyCrossingPoint_,
-                               bandsSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, bandsSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::BOLLINGER_BANDS] = marketData;
-  strategyCrossingPoints_[&bandsSettings] = currentStrategy->getLastBuyCrossingPoint();
+  strategyCrossingPoints_[&bandsSettings] = signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(
@@ -169,10 +179,6 @@ void TradingBuyingStrategyProcessor::visit(
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getBollingerBandAdvanceStrategy();
-  currentStrategy->setPercentageForBottomLine(bollingerBandsAdvancedSettings.bottomLinePercentage_);
-  currentStrategy->setPercentageForTopLine(bollingerBandsAdvancedSettings.topLinePercentage_);
-
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency,
           common::StrategiesType::BOLLINGER_BANDS_ADVANCED)) {
@@ -185,20 +191,15 @@ void TradingBuyingStrategyProcessor::visit(
       return;
     }
   }
-  currentStrategy->createLines(marketHistory->marketData_, bollingerBandsAdvancedSettings.period_,
-                               bollingerBandsAdvancedSettings.bbInputType_,
-                               bollingerBandsAdvancedSettings.standardDeviations_,
-                               bollingerBandsAdvancedSettings.crossingInterval_,
-                               bollingerBandsAdvancedSettings.lastBuyCrossingPoint_,
-                               bollingerBandsAdvancedSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, bollingerBandsAdvancedSettings,
+                                            *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::BOLLINGER_BANDS_ADVANCED] = marketData;
-  strategyCrossingPoints_[&bollingerBandsAdvancedSettings] =
-      currentStrategy->getLastBuyCrossingPoint();
+  strategyCrossingPoints_[&bollingerBandsAdvancedSettings] = signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(const model::RsiSettings &rsiSettings) {
@@ -213,8 +214,6 @@ void TradingBuyingStrategyProcessor::visit(const model::RsiSettings &rsiSettings
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getRsiStrategy();
-
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency, common::StrategiesType::RSI)) {
     auto lastSavedMarketData = tradeSignaledStrategyMarketHolder_.getMarket(
@@ -226,18 +225,13 @@ void TradingBuyingStrategyProcessor::visit(const model::RsiSettings &rsiSettings
     }
   }
 
-  currentStrategy->setTopRsiIndex(rsiSettings.topLevel_);
-  currentStrategy->setBottomRsiIndex(rsiSettings.bottomLevel_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, rsiSettings, *marketHistory);
 
-  currentStrategy->createLine(marketHistory->marketData_, rsiSettings.period_,
-                              rsiSettings.crossingInterval_, rsiSettings.lastBuyCrossingPoint_,
-                              rsiSettings.lastSellCrossingPoint_);
-
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::RSI] = marketData;
-  strategyCrossingPoints_[&rsiSettings] = currentStrategy->getLastBuyCrossingPoint();
+  strategyCrossingPoints_[&rsiSettings] = signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(const model::EmaSettings &emaSettings) {
@@ -252,7 +246,6 @@ void TradingBuyingStrategyProcessor::visit(const model::EmaSettings &emaSettings
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getEmaStrategy();
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency, common::StrategiesType::EMA)) {
     auto lastSavedMarketData = tradeSignaledStrategyMarketHolder_.getMarket(
@@ -264,17 +257,15 @@ void TradingBuyingStrategyProcessor::visit(const model::EmaSettings &emaSettings
     }
   }
 
-  currentStrategy->createLine(marketHistory->marketData_, emaSettings.period_,
-                              emaSettings.crossingInterval_, emaSettings.lastBuyCrossingPoint_,
-                              emaSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, emaSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   common::MarketData marketData = marketHistory->marketData_.back();
 
   strategyMarkets_[common::StrategiesType::EMA] = marketData;
-  strategyCrossingPoints_[&emaSettings] = currentStrategy->getLastBuyCrossingPoint();
+  strategyCrossingPoints_[&emaSettings] = signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(const model::SmaSettings &smaSettings) {
@@ -289,7 +280,6 @@ void TradingBuyingStrategyProcessor::visit(const model::SmaSettings &smaSettings
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getSmaStrategy();
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency, common::StrategiesType::SMA)) {
     auto lastSavedMarketData = tradeSignaledStrategyMarketHolder_.getMarket(
@@ -301,16 +291,14 @@ void TradingBuyingStrategyProcessor::visit(const model::SmaSettings &smaSettings
     }
   }
 
-  currentStrategy->createLine(marketHistory->marketData_, smaSettings.period_,
-                              smaSettings.crossingInterval_, smaSettings.lastBuyCrossingPoint_,
-                              smaSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, smaSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::SMA] = marketData;
-  strategyCrossingPoints_[&smaSettings] = currentStrategy->getLastBuyCrossingPoint();
+  strategyCrossingPoints_[&smaSettings] = signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(
@@ -325,8 +313,6 @@ void TradingBuyingStrategyProcessor::visit(
     processingResult = (anyIndicatorTriggered) ? (processingResult | false) : (false);
     return;
   }
-  auto currentStrategy = strategiesLibrary_.getMACrossingStrategy();
-  currentStrategy->setCrossingInterval(movingAveragesCrossingSettings.crossingInterval_);
 
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency, common::StrategiesType::MA_CROSSING)) {
@@ -339,20 +325,16 @@ void TradingBuyingStrategyProcessor::visit(
     }
   }
 
-  currentStrategy->createLines(marketHistory->marketData_,
-                               movingAveragesCrossingSettings.smallerPeriod_,
-                               movingAveragesCrossingSettings.biggerPeriod_,
-                               movingAveragesCrossingSettings.lastBuyCrossingPoint_,
-                               movingAveragesCrossingSettings.lastSellCrossingPoint_,
-                               movingAveragesCrossingSettings.movingAverageType_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, movingAveragesCrossingSettings,
+                                            *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::MA_CROSSING] = marketData;
   strategyCrossingPoints_[&movingAveragesCrossingSettings] =
-      currentStrategy->getLastBuyCrossingPoint();
+      signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(
@@ -368,8 +350,6 @@ void TradingBuyingStrategyProcessor::visit(
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getStochasticOscillatorStrategy();
-
   if (tradeSignaledStrategyMarketHolder_.containMarket(
           coinSettings.baseCurrency_, currentTradedCurrency,
           common::StrategiesType::STOCHASTIC_OSCILLATOR)) {
@@ -383,25 +363,16 @@ void TradingBuyingStrategyProcessor::visit(
     }
   }
 
-  currentStrategy->setBottomLevel(stochasticOscillatorSettings.bottomLevel);
-  currentStrategy->setTopLevel(stochasticOscillatorSettings.topLevel);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency, stochasticOscillatorSettings,
+                                            *marketHistory);
 
-  currentStrategy->createLines(marketHistory->marketData_,
-                               stochasticOscillatorSettings.stochasticType_,
-                               stochasticOscillatorSettings.periodsForClassicLine_,
-                               stochasticOscillatorSettings.smoothFastPeriod_,
-                               stochasticOscillatorSettings.smoothSlowPeriod_,
-                               stochasticOscillatorSettings.crossingInterval_,
-                               stochasticOscillatorSettings.lastBuyCrossingPoint_,
-                               stochasticOscillatorSettings.lastSellCrossingPoint_);
-
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 
   auto marketData = marketHistory->marketData_.back();
   strategyMarkets_[common::StrategiesType::STOCHASTIC_OSCILLATOR] = marketData;
   strategyCrossingPoints_[&stochasticOscillatorSettings] =
-      currentStrategy->getLastBuyCrossingPoint();
+      signal.lastBuyCrossingPoint_;
 }
 
 void TradingBuyingStrategyProcessor::visit(
@@ -417,18 +388,28 @@ void TradingBuyingStrategyProcessor::visit(
 
 common::MarketHistoryPtr TradingBuyingStrategyProcessor::getMarketHistory(
     common::TickInterval::Enum interval) const {
+  return getMarketHistory(currentTradedCurrency, interval);
+}
+
+common::MarketHistoryPtr TradingBuyingStrategyProcessor::getMarketHistory(
+    common::Currency::Enum tradedCurrency, common::TickInterval::Enum interval) const {
   auto &coinSettings = tradeConfiguration_.getCoinSettings();
   auto &stockExchangeSettings = tradeConfiguration_.getStockExchangeSettings();
   auto query = queryProcessor_.getQuery(stockExchangeSettings.stockExchangeType_);
 
-  auto marketHistory =
-      query->getMarketHistory(coinSettings.baseCurrency_, currentTradedCurrency, interval);
-  return marketHistory;
+  auto candlesLookback = candlesLookbacks_.find(interval);
+  size_t candlesCount = (candlesLookback == candlesLookbacks_.end())
+                            ? TradingMarketHistories::ALL_CANDLES
+                            : candlesLookback->second;
+
+  return marketHistories_.get(*query, coinSettings.baseCurrency_, tradedCurrency, interval,
+                              candlesCount);
 }
 
 void TradingBuyingStrategyProcessor::updateCrossingPoint(
     const model::StrategySettings &strategySettings, double lastCrossingPoint) {
   // TODO: Revise this logic after release.
+  std::lock_guard<std::mutex> lock(TradingManager::getStrategiesSettingsMutex());
   auto &settings = const_cast<model::StrategySettings &>(strategySettings);
   settings.lastBuyCrossingPoint_ = lastCrossingPoint;
 
@@ -445,7 +426,7 @@ common::MarketOrder TradingBuyingStrategyProcessor::openOrder(common::Currency::
   int openPositions = tradeOrdersHolder_.getBuyOpenPositionsForMarket(coinSettings.baseCurrency_,
                                                                       currentTradedCurrency);
 
-  auto currentTick = query->getCurrencyTick(coinSettings.baseCurrency_, currentTradedCurrency);
+  auto currentTick = query->getTickFromAllTicks(coinSettings.baseCurrency_, currentTradedCurrency);
   double price = currentTick.ask_;
 
   auto baseAmountPerEachOrder = buySettings.getBaseCurrencyAmountPerEachOrder();
@@ -530,11 +511,11 @@ common::MarketOrder TradingBuyingStrategyProcessor::openOrder(common::Currency::
     }
   }
   auto currentOrder = query->buyOrder(fromCurrency, toCurrency, quantity, price);
+  query->invalidateBalances();
 
   const std::string message = "Opened buy order : " + currentOrder.toString();
   messageSender_.sendMessage(message);
-  databaseProvider_.insertMarketOrder(currentOrder);
-  currentOrder.databaseId_ = databaseProvider_.getLastInsertRowId();
+  currentOrder.databaseId_ = databaseProvider_.insertMarketOrder(currentOrder);
   tradeOrdersHolder_.addBuyOrder(currentOrder);
 
   return currentOrder;
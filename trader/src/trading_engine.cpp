@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_engine.h"
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <set>
+#include <utility>
+
+#include "common/exceptions/model_exception/trading_model_exception.h"
+
+namespace auto_trader {
+namespace trader {
+
+TradingEngine::TradingEngine(stock_exchange::QueryProcessor& queryProcessor,
+                             database::Database& databaseProvider,
+                             common::AppListener& appListener, common::GuiListener& guiListener,
+                             model::AppSettings& appSettings,
+                             model::StrategiesSettingsHolder& strategiesSettingsHolder,
+                             model::TradeConfigsHolder& tradeConfigsHolder,
+                             TradingWorkerPool& workerPool,
+                             strategies::StrategyPool& strategyPool)
+    : queryProcessor_(queryProcessor),
+      databaseProvider_(databaseProvider),
+      appListener_(appListener),
+      guiListener_(guiListener),
+      appSettings_(appSettings),
+      strategiesSettingsHolder_(strategiesSettingsHolder),
+      tradeConfigsHolder_(tradeConfigsHolder),
+      workerPool_(workerPool),
+      strategyPool_(strategyPool),
+      isRunning_(false),
+      isStopRequested_(false) {}
+
+void TradingEngine::run(const std::vector<std::string>& configurationNames) {
+  checkMarkets(configurationNames);
+
+  {
+    std::lock_guard<std::mutex> lock(locker_);
+    if (isStopRequested_) {
+      isStopRequested_ = false;
+      return;
+    }
+
+    sessions_.clear();
+    for (const auto& configurationName : configurationNames) {
+      sessions_.push_back(std::make_unique<TradingSession>(
+          configurationName, queryProcessor_, databaseProvider_, appListener_, guiListener_,
+          appSettings_, strategiesSettingsHolder_, tradeConfigsHolder_, workerPool_,
+          strategyPool_));
+    }
+    isRunning_ = true;
+  }
+
+  // A session whose step throws is reported on its own channel and leaves the engine.
+  std::vector<char> isSessionRunning(sessions_.size(), 1);
+  auto runStep = [&](size_t sessionIndex, const std::function<bool(TradingManager&)>& step) {
+    auto& session = *sessions_[sessionIndex];
+    try {
+      if (!step(session.getTradingManager())) {
+        isSessionRunning[sessionIndex] = 0;
+      }
+    } catch (std::exception& exception) {
+      session.getMessageSender().sendMessage(exception.what());
+      isSessionRunning[sessionIndex] = 0;
+    }
+  };
+
+  // The managers fan their markets out on the shared pool, which runs one batch at a time and
+  // cannot be entered from its own tasks, so the sessions themselves run on this thread.
+  std::vector<char> isSessionStarted(sessions_.size(), 0);
+  for (size_t sessionIndex = 0; sessionIndex < sessions_.size(); ++sessionIndex) {
+    runStep(sessionIndex, [](TradingManager& tradingManager) {
+      tradingManager.startTrading();
+      return true;
+    });
+    isSessionStarted[sessionIndex] = isSessionRunning[sessionIndex];
+  }
+
+  while (isRunning_) {
+    auto now = TradingScheduler::Clock::now();
+    for (size_t sessionIndex = 0; sessionIndex < sessions_.size() && isRunning_; ++sessionIndex) {
+      if (isSessionRunning[sessionIndex] &&
+          sessions_[sessionIndex]->getTradingManager().getNextWakeUp() <= now) {
+        runStep(sessionIndex,
+                [](TradingManager& tradingManager) { return tradingManager.runCycle(); });
+      }
+    }
+
+    auto nextWakeUp = TradingScheduler::Clock::time_point::max();
+    for (size_t sessionIndex = 0; sessionIndex < sessions_.size(); ++sessionIndex) {
+      if (isSessionRunning[sessionIndex]) {
+        nextWakeUp =
+            std::min(nextWakeUp, sessions_[sessionIndex]->getTradingManager().getNextWakeUp());
+      }
+    }
+
+    if (nextWakeUp == TradingScheduler::Clock::time_point::max()) {
+      break;
+    }
+
+    std::unique_lock<std::mutex> lock(locker_);
+    condVar_.wait_until(lock, nextWakeUp, [&]() { return !isRunning_; });
+  }
+
+  isRunning_ = false;
+  for (size_t sessionIndex = 0; sessionIndex < sessions_.size(); ++sessionIndex) {
+    auto& tradingManager = sessions_[sessionIndex]->getTradingManager();
+    tradingManager.stopTradingSlot();
+    if (isSessionStarted[sessionIndex]) {
+      tradingManager.finishTrading();
+    }
+  }
+}
+
+void TradingEngine::stop() {
+  std::lock_guard<std::mutex> lock(locker_);
+  isStopRequested_ = !isRunning_;
+  isRunning_ = false;
+  for (auto& session : sessions_) {
+    session->getTradingManager().stopTradingSlot();
+  }
+
+  condVar_.notify_all();
+}
+
+bool TradingEngine::isRunning() const { return isRunning_; }
+
+void TradingEngine::checkMarkets(const std::vector<std::string>& configurationNames) const {
+  std::set<std::pair<common::Currency::Enum, common::Currency::Enum>> markets;
+  for (const auto& configurationName : configurationNames) {
+    const auto& coinSettings =
+        tradeConfigsHolder_.getTradeConfiguration(configurationName).getCoinSettings();
+    for (auto tradedCurrency : coinSettings.tradedCurrencies_) {
+      if (!markets.emplace(coinSettings.baseCurrency_, tradedCurrency).second) {
+        throw common::exceptions::TradingModelException(
+            "Market " + common::Currency::toString(coinSettings.baseCurrency_) + "/" +
+            common::Currency::toString(tradedCurrency) +
+            " is traded by several configurations, including '" + configurationName + "'.");
+      }
+    }
+  }
+}
+
+}  // namespace trader
+}  // namespace auto_trader
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_lookback_planner.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "model/include/settings/strategies_settings/bollinger_bands_advanced_settings.h"
+#include "model/include/settings/strategies_settings/bollinger_bands_settings.h"
+#include "model/include/settings/strategies_settings/custom_strategy_settings.h"
+#include "model/include/settings/strategies_settings/ema_settings.h"
+#include "model/include/settings/strategies_settings/ma_crossing_settings.h"
+#include "model/include/settings/strategies_settings/rsi_settings.h"
+#include "model/include/settings/strategies_settings/sma_settings.h"
+#include "model/include/settings/strategies_settings/stochastic_oscillator_settings.h"
+
+namespace auto_trader {
+namespace trader {
+
+constexpr double TradingLookbackPlanner::DEFAULT_EMA_WARM_UP_FACTOR;
+
+TradingLookbackPlanner::TradingLookbackPlanner(double emaWarmUpFactor)
+    : emaWarmUpFactor_(std::max(1.0, emaWarmUpFactor)) {}
+
+CandlesLookbacks TradingLookbackPlanner::plan(const model::StrategySettings& strategySettings) {
+  lookbacks_.clear();
+  strategySettings.accept(*this);
+  return lookbacks_;
+}
+
+void TradingLookbackPlanner::visit(const model::BollingerBandsSettings& bandsSettings) {
+  addLookback(bandsSettings.tickInterval_, bandsSettings.period_,
+              bandsSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(
+    const model::BollingerBandsAdvancedSettings& bandsAdvancedSettings) {
+  addLookback(bandsAdvancedSettings.tickInterval_, bandsAdvancedSettings.period_,
+              bandsAdvancedSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(const model::RsiSettings& rsiSettings) {
+  // Gains and losses are differences of neighbouring candles, so one more candle is needed.
+  size_t window = rsiSettings.smoothingType_ == common::RsiSmoothingType::WILDER
+                      ? getEmaWindow(rsiSettings.period_)
+                      : rsiSettings.period_;
+  addLookback(rsiSettings.tickInterval_, window + 1, rsiSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(const model::EmaSettings& emaSettings) {
+  addLookback(emaSettings.tickInterval_, getEmaWindow(emaSettings.period_),
+              emaSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(const model::SmaSettings& smaSettings) {
+  addLookback(smaSettings.tickInterval_, smaSettings.period_, smaSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(
+    const model::MovingAveragesCrossingSettings& movingAveragesCrossingSettings) {
+  auto biggerPeriod = std::max(movingAveragesCrossingSettings.smallerPeriod_,
+                               movingAveragesCrossingSettings.biggerPeriod_);
+  size_t window =
+      movingAveragesCrossingSettings.movingAverageType_ == common::MovingAverageType::EXPONENTIAL
+          ? getEmaWindow(biggerPeriod)
+          : std::max(0, biggerPeriod);
+  addLookback(movingAveragesCrossingSettings.tickInterval_, window,
+              movingAveragesCrossingSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(
+    const model::StochasticOscillatorSettings& stochasticOscillatorSettings) {
+  auto window = stochasticOscillatorSettings.periodsForClassicLine_ +
+                stochasticOscillatorSettings.smoothFastPeriod_ +
+                stochasticOscillatorSettings.smoothSlowPeriod_;
+  addLookback(stochasticOscillatorSettings.tickInterval_, std::max(0, window),
+              stochasticOscillatorSettings.crossingInterval_);
+}
+
+void TradingLookbackPlanner::visit(const model::CustomStrategySettings& customStrategySettings) {
+  size_t strategiesCount = customStrategySettings.getStrategiesCount();
+  for (int index = 0; index < strategiesCount; ++index) {
+    customStrategySettings.getStrategy(index)->accept(*this);
+  }
+}
+
+size_t TradingLookbackPlanner::getEmaWindow(int period) const {
+  return static_cast<size_t>(std::ceil(std::max(0, period) * emaWarmUpFactor_));
+}
+
+void TradingLookbackPlanner::addLookback(common::TickInterval::Enum interval, size_t window,
+                                         int crossingInterval) {
+  // The last candle is still open, so it does not count towards the closed window.
+  size_t lookback = window + std::max(0, crossingInterval) + 1;
+  auto& intervalLookback = lookbacks_[interval];
+  intervalLookback = std::max(intervalLookback, lookback);
+}
+
+}  // namespace trader
+}  // namespace auto_trader
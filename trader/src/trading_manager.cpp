@@ -27,13 +27,18 @@
 #include "include/trading_manager.h"
 
 #include <QDateTime>
+#include <algorithm>
+#include <chrono>
 #include <exception>
 #include <thread>
 
 #include "common/loggers/file_logger.h"
+#include "common/tick_interval_ratio.h"
 #include "features/include/stop_loss_announcer.h"
 #include "features/include/telegram_announcer.h"
 #include "include/trading_buying_strategy_processor.h"
+#include "include/trading_lookback_planner.h"
+#include "include/trading_scheduler.h"
 #include "include/trading_selling_strategy_processor.h"
 #include "model/include/orders/orders_profit.h"
 #include "stocks_exchange/include/query_processor.h"
@@ -52,14 +57,31 @@ static std::set<common::MarketOrder> getOrdersForType(
   return ordersForType;
 }
 
+static std::vector<common::MarketOrder> getOrdersForMarkets(
+    const std::vector<common::MarketOrder> &allOrders, const model::CoinSettings &coinSettings) {
+  std::vector<common::MarketOrder> marketsOrders;
+  for (const auto &order : allOrders) {
+    if (order.fromCurrency_ != coinSettings.baseCurrency_) continue;
+
+    const auto &tradedCurrencies = coinSettings.tradedCurrencies_;
+    if (std::find(tradedCurrencies.begin(), tradedCurrencies.end(), order.toCurrency_) !=
+        tradedCurrencies.end()) {
+      marketsOrders.push_back(order);
+    }
+  }
+
+  return marketsOrders;
+}
+
 TradingManager::TradingManager(
-    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyFacade &strategyFacade,
+    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyPool &strategyPool,
     database::Database &databaseProvider, common::AppListener &appListener,
     common::GuiListener &guiListener, model::AppSettings &appSettings,
     TradingMessageSender &messageSender, model::StrategiesSettingsHolder &strategiesSettingsHolder,
     model::TradeOrdersHolder &tradeOrdersHolder, model::TradeConfigsHolder &tradeConfigsHolder,
-    model::TradeSignaledStrategyMarketHolder &tradeSignaledStrategyMarketHolder)
-    : strategyFacade_(strategyFacade),
+    model::TradeSignaledStrategyMarketHolder &tradeSignaledStrategyMarketHolder,
+    TradingWorkerPool &workerPool, const std::string &configurationName)
+    : strategyPool_(strategyPool),
       queryProcessor_(queryProcessor),
       databaseProvider_(databaseProvider),
       appListener_(appListener),
@@ -70,13 +92,27 @@ TradingManager::TradingManager(
       tradeConfigsHolder_(tradeConfigsHolder),
       tradeSignaledStrategyMarketHolder_(tradeSignaledStrategyMarketHolder),
       messageSender_(messageSender),
+      workerPool_(workerPool),
+      configurationName_(configurationName),
+      tradeConfiguration_(nullptr),
       isRunning_(false),
       isReset_(false) {}
 
 void TradingManager::startTradingSlot() {
+  startTrading();
+
+  while (runCycle()) {
+    std::unique_lock<std::mutex> lock(locker_);
+    condVar_.wait_until(lock, getNextWakeUp(), [&]() { return !isRunning_; });
+  }
+
+  finishTrading();
+}
+
+void TradingManager::startTrading() {
   isRunning_ = true;
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
-  currentTradeConfiguration.start();
+  tradeConfiguration_ = &takeTradeConfiguration();
+  tradeConfiguration_->start();
 
   messageSender_.setDefaultPrefix();
 
@@ -96,37 +132,67 @@ void TradingManager::startTradingSlot() {
 
   currencyLotsHolder_.clear();
 
-  auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
+  auto stockExchangeType = tradeConfiguration_->getStockExchangeSettings().stockExchangeType_;
   auto query = queryProcessor_.getQuery(stockExchangeType);
   currencyLotsHolder_ = query->getCurrencyLotsHolder();
 
   loadOrders();
+  databaseProvider_.commit();
+
+  scheduler_ = std::make_unique<TradingScheduler>(
+      std::chrono::minutes(appSettings_.tradingTimeout_),
+      TradingScheduler::DEFAULT_SETTLEMENT_DELAY,
+      common::getStockExchangeCandlesUtcOffset(stockExchangeType));
+}
 
-  while (currentTradeConfiguration.isRunning() && isRunning_) {
-    prepareBuying();
-    prepareSelling();
+bool TradingManager::runCycle() {
+  bool isCycleCompleted = tradeCycle();
+  databaseProvider_.commit();
+  return isCycleCompleted;
+}
 
+bool TradingManager::tradeCycle() {
+  if (!tradeConfiguration_->isRunning() || !isRunning_) {
+    return false;
+  }
+
+  scheduler_->setIntervals(getStrategyIntervals(), TradingScheduler::Clock::now());
+  bool isStrategyDue = scheduler_->takeStep(TradingScheduler::Clock::now());
+
+  if (isStrategyDue) {
+    // Indicator results and candles are shared by the processors of one cycle only.
+    resultCache_.clear();
+    marketHistories_.clear();
+  }
+
+  std::vector<common::MarketOrder> openOrders;
+  if (fetchAccountOpenOrders(openOrders)) {
+    prepareBuying(openOrders);
+    prepareSelling(openOrders);
+  }
+
+  if (isStrategyDue) {
     uploadBuyingOrders();
 
     if (!isRunning()) {
-      break;
+      return false;
     }
+  }
 
-    uploadSellOrders();
+  uploadSellOrders(isStrategyDue);
 
-    if (!isRunning()) {
-      break;
-    }
+  if (!isRunning()) {
+    return false;
+  }
 
-    runStopLoss();
+  runStopLoss();
 
-    appListener_.refreshTradingView();
+  appListener_.refreshTradingView();
+  return true;
+}
 
-    std::unique_lock<std::mutex> lock(locker_);
-    std::chrono::duration<int, std::milli> milli_seconds_type{appSettings_.tradingTimeout_ * 60 *
-                                                              1000};
-    condVar_.wait_for(lock, milli_seconds_type, [&]() { return !isRunning_; });
-  }
+void TradingManager::finishTrading() {
+  databaseProvider_.flush();
 
   if (QCoreApplication::instance()) {
     messageSender_.setDefaultPrefix();
@@ -134,7 +200,19 @@ void TradingManager::startTradingSlot() {
     emit tradingStopped();
   }
 
-  currentTradeConfiguration.stop();
+  tradeConfiguration_->stop();
+  tradeConfiguration_ = nullptr;
+}
+
+TradingScheduler::Clock::time_point TradingManager::getNextWakeUp() const {
+  return scheduler_->getNextWakeUp();
+}
+
+const std::string &TradingManager::getConfigurationName() const { return configurationName_; }
+
+std::mutex &TradingManager::getStrategiesSettingsMutex() {
+  static std::mutex strategiesSettingsMutex;
+  return strategiesSettingsMutex;
 }
 
 void TradingManager::stopTradingSlot() {
@@ -153,23 +231,52 @@ bool TradingManager::isRunning() const { return isRunning_; }
 
 void TradingManager::reset(bool value) { isReset_ = value; }
 
-void TradingManager::prepareBuying() {
+model::TradeConfiguration &TradingManager::takeTradeConfiguration() const {
+  if (configurationName_.empty()) {
+    return tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  }
+
+  return tradeConfigsHolder_.takeTradeConfiguration(configurationName_);
+}
+
+std::set<common::TickInterval::Enum> TradingManager::getStrategyIntervals() const {
+  std::set<common::TickInterval::Enum> intervals;
   try {
-    messageSender_.setBuyingPrefix();
-    auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+    auto &currentTradeConfiguration = takeTradeConfiguration();
+    const auto &strategySettings =
+        strategiesSettingsHolder_.getCustomStrategy(currentTradeConfiguration.getStrategyName());
+    for (const auto &candlesLookback : TradingLookbackPlanner().plan(strategySettings)) {
+      intervals.insert(candlesLookback.first);
+    }
+  } catch (std::exception &) {
+    // The strategy processors report an unknown strategy on every run.
+  }
+
+  return intervals;
+}
+
+bool TradingManager::fetchAccountOpenOrders(std::vector<common::MarketOrder> &openOrders) {
+  try {
+    auto &currentTradeConfiguration = takeTradeConfiguration();
     auto stockExchangeType =
         currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
     auto query = queryProcessor_.getQuery(stockExchangeType);
-    auto coinSettings = currentTradeConfiguration.getCoinSettings();
+    const auto &coinSettings = currentTradeConfiguration.getCoinSettings();
 
-    std::vector<common::MarketOrder> allOrders;
-    for (const auto &tradedCoin : coinSettings.tradedCurrencies_) {
-      std::vector<common::MarketOrder> orders =
-          query->getAccountOpenOrders(coinSettings.baseCurrency_, tradedCoin);
-      std::copy(orders.begin(), orders.end(), std::back_inserter(allOrders));
-    }
+    openOrders = getOrdersForMarkets(query->getAllAccountOpenOrders(), coinSettings);
+    return true;
+  } catch (std::exception &exception) {
+    messageSender_.setDefaultPrefix();
+    messageSender_.sendMessage(exception.what());
+  }
+
+  return false;
+}
 
-    auto ordersToBuy = getOrdersForType(allOrders, common::OrderType::BUY);
+void TradingManager::prepareBuying(const std::vector<common::MarketOrder> &openOrders) {
+  try {
+    messageSender_.setBuyingPrefix();
+    auto ordersToBuy = getOrdersForType(openOrders, common::OrderType::BUY);
     auto updatedOrders = updateManuallyOpenedBuyingOrders(ordersToBuy);
 
     updateClosedBuyingOrders(updatedOrders);
@@ -182,7 +289,7 @@ void TradingManager::prepareBuying() {
 
 void TradingManager::cancelOutdatedBuyingOrders(
     const std::set<auto_trader::common::MarketOrder> &openOrders) {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
   auto query = queryProcessor_.getQuery(stockExchangeType);
 
@@ -196,6 +303,7 @@ void TradingManager::cancelOutdatedBuyingOrders(
 
     if (currentDate > outdatedOrderDate) {
       bool orderCanceled = query->cancelOrder(order.fromCurrency_, order.toCurrency_, order.uuid_);
+      query->invalidateBalances();
       if (orderCanceled) {
         const std::string message = "Cancel outdated order : [ " + order.toString() + " ]";
         messageSender_.sendMessage(message);
@@ -212,12 +320,16 @@ void TradingManager::cancelOutdatedBuyingOrders(
 }
 
 void TradingManager::updateClosedBuyingOrders(const std::set<common::MarketOrder> &openOrders) {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
 
   std::set<common::MarketOrder> difference = tradeOrdersHolder_.getBuyOrdersDiff(openOrders);
   std::lock_guard<std::mutex> lock(locker_);
 
+  if (!difference.empty()) {
+    queryProcessor_.getQuery(stockExchangeType)->invalidateBalances();
+  }
+
   for (auto &order : difference) {
     if (isOrderManuallyCanceled(order)) {
       tradeOrdersHolder_.removeBuyOrder(order);
@@ -245,7 +357,7 @@ void TradingManager::updateClosedBuyingOrders(const std::set<common::MarketOrder
 
 const std::set<common::MarketOrder> TradingManager::updateManuallyOpenedBuyingOrders(
     const std::set<common::MarketOrder> &openOrders) {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto &coinSettings = currentTradeConfiguration.getCoinSettings();
   std::set<common::MarketOrder> updatedOrders;
 
@@ -256,8 +368,7 @@ const std::set<common::MarketOrder> TradingManager::updateManuallyOpenedBuyingOr
           (tradedCurrency == order.toCurrency_)) {
         auto marketOrder = order;
         marketOrder.opened_ = common::Date::getCurrentTime();
-        databaseProvider_.insertMarketOrder(marketOrder);
-        marketOrder.databaseId_ = databaseProvider_.getLastInsertRowId();
+        marketOrder.databaseId_ = databaseProvider_.insertMarketOrder(marketOrder);
         tradeOrdersHolder_.addBuyOrder(marketOrder);
         updatedOrders.insert(marketOrder);
         messageSender_.sendMessage("Manually opened order : [ " + marketOrder.toString() +
@@ -283,32 +394,22 @@ void TradingManager::uploadBuyingOrders() {
   try {
     messageSender_.setBuyingPrefix();
 
-    auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+    auto &currentTradeConfiguration = takeTradeConfiguration();
     TradingBuyingStrategyProcessor processor(
-        queryProcessor_, strategyFacade_, databaseProvider_, appListener_,
+        queryProcessor_, strategyPool_, databaseProvider_, appListener_,
         strategiesSettingsHolder_, tradeOrdersHolder_, tradeSignaledStrategyMarketHolder_,
-        currentTradeConfiguration, messageSender_, currencyLotsHolder_, *this);
+        currentTradeConfiguration, messageSender_, currencyLotsHolder_, *this, workerPool_,
+        marketHistories_, resultCache_);
     processor.run();
   } catch (std::exception &exception) {
     messageSender_.sendMessage(exception.what());
   }
 }
 
-void TradingManager::prepareSelling() {
+void TradingManager::prepareSelling(const std::vector<common::MarketOrder> &openOrders) {
   try {
     messageSender_.setSellingPrefix();
-    auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
-    auto stockExchangeType =
-        currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
-    auto query = queryProcessor_.getQuery(stockExchangeType);
-    auto coinSettings = currentTradeConfiguration.getCoinSettings();
-    std::vector<common::MarketOrder> allOrders;
-    for (const auto &tradedCoin : coinSettings.tradedCurrencies_) {
-      std::vector<common::MarketOrder> orders =
-          query->getAccountOpenOrders(coinSettings.baseCurrency_, tradedCoin);
-      std::copy(orders.begin(), orders.end(), std::back_inserter(allOrders));
-    }
-    auto ordersToSell = getOrdersForType(allOrders, common::OrderType::SELL);
+    auto ordersToSell = getOrdersForType(openOrders, common::OrderType::SELL);
     auto updatedSellOrders = updateManuallyOpenedSellingOrders(ordersToSell);
 
     cancelOutdatedSellingOrders(updatedSellOrders);
@@ -322,10 +423,14 @@ void TradingManager::prepareSelling() {
 void TradingManager::updateClosedSellingOrders(
     const std::set<auto_trader::common::MarketOrder> &orders) {
   auto difference = tradeOrdersHolder_.getSellOrdersDiff(orders);
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
   auto &orderMatching = tradeOrdersHolder_.takeOrderMatching();
 
+  if (!difference.empty()) {
+    queryProcessor_.getQuery(stockExchangeType)->invalidateBalances();
+  }
+
   for (auto &sellOrder : difference) {
     if (isOrderManuallyCanceled(sellOrder)) {
       tradeOrdersHolder_.removeSellOrder(sellOrder);
@@ -369,7 +474,7 @@ void TradingManager::updateClosedSellingOrders(
 void TradingManager::cancelOutdatedSellingOrders(const std::set<common::MarketOrder> &orders) {
   std::lock_guard<std::mutex> lock(locker_);
 
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
   auto query = queryProcessor_.getQuery(stockExchangeType);
   auto &orderMatching = tradeOrdersHolder_.takeOrderMatching();
@@ -384,6 +489,7 @@ void TradingManager::cancelOutdatedSellingOrders(const std::set<common::MarketOr
     auto currentDate = QDateTime::currentDateTime();
     if (currentDate > outdatedOrderDate) {
       bool canceledOrder = query->cancelOrder(order.fromCurrency_, order.toCurrency_, order.uuid_);
+      query->invalidateBalances();
       if (canceledOrder) {
         const std::string message = "Cancel outdated order : [ " + order.toString() + " ]";
         messageSender_.sendMessage(message);
@@ -418,10 +524,10 @@ void TradingManager::cancelOutdatedSellingOrders(const std::set<common::MarketOr
   }
 }
 
-void TradingManager::uploadSellOrders() {
+void TradingManager::uploadSellOrders(bool isStrategyDue) {
   try {
     messageSender_.setSellingPrefix();
-    auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+    auto &currentTradeConfiguration = takeTradeConfiguration();
     auto &stockExchangeSettings = currentTradeConfiguration.getStockExchangeSettings();
     auto &sellSettings = currentTradeConfiguration.getSellSettings();
     auto &coinSettings = currentTradeConfiguration.getCoinSettings();
@@ -431,16 +537,16 @@ void TradingManager::uploadSellOrders() {
     std::lock_guard<std::mutex> lock(locker_);
 
     TradingSellStrategyProcessor processor(
-        queryProcessor_, strategyFacade_, databaseProvider_, appListener_,
+        queryProcessor_, strategyPool_, databaseProvider_, appListener_,
         strategiesSettingsHolder_, tradeOrdersHolder_, tradeConfigsHolder_,
         tradeSignaledStrategyMarketHolder_, currentTradeConfiguration, messageSender_,
-        currencyLotsHolder_, *this);
+        currencyLotsHolder_, *this, workerPool_, marketHistories_, resultCache_);
 
     if (sellSettings.sellUsingProfit_) {
       processor.runTakeProfitProcessor();
     }
 
-    if (sellSettings.sellUsingStrategy_) {
+    if (sellSettings.sellUsingStrategy_ && isStrategyDue) {
       processor.runStrategyProcessor();
     }
 
@@ -452,14 +558,14 @@ void TradingManager::uploadSellOrders() {
 void TradingManager::runStopLoss() {
   try {
     messageSender_.setSellingPrefix();
-    auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+    auto &currentTradeConfiguration = takeTradeConfiguration();
     std::lock_guard<std::mutex> lock(locker_);
 
     TradingSellStrategyProcessor processor(
-        queryProcessor_, strategyFacade_, databaseProvider_, appListener_,
+        queryProcessor_, strategyPool_, databaseProvider_, appListener_,
         strategiesSettingsHolder_, tradeOrdersHolder_, tradeConfigsHolder_,
         tradeSignaledStrategyMarketHolder_, currentTradeConfiguration, messageSender_,
-        currencyLotsHolder_, *this);
+        currencyLotsHolder_, *this, workerPool_, marketHistories_, resultCache_);
 
     processor.runStopLossProcessor();
 
@@ -487,7 +593,7 @@ const std::set<common::MarketOrder> TradingManager::updateManuallyOpenedSellingO
 }
 
 bool TradingManager::isOrderManuallyCanceled(const common::MarketOrder &order) const {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto stockExchangeType = currentTradeConfiguration.getStockExchangeSettings().stockExchangeType_;
   auto query = queryProcessor_.getQuery(stockExchangeType);
   auto marketOrder = query->getAccountOrder(order.fromCurrency_, order.toCurrency_, order.uuid_);
@@ -497,7 +603,7 @@ bool TradingManager::isOrderManuallyCanceled(const common::MarketOrder &order) c
 void TradingManager::loadOrders() {
   tradeOrdersHolder_.clear();
   tradeSignaledStrategyMarketHolder_.clear();
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto &stockExchangeSettings = currentTradeConfiguration.getStockExchangeSettings();
   auto query = queryProcessor_.getQuery(stockExchangeSettings.stockExchangeType_);
   auto &coinSettings = currentTradeConfiguration.getCoinSettings();
@@ -580,7 +686,7 @@ void TradingManager::loadOrders() {
 }
 
 bool TradingManager::isDataExists() const {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto &stockExchangeSettings = currentTradeConfiguration.getStockExchangeSettings();
   auto &coinSettings = currentTradeConfiguration.getCoinSettings();
 
@@ -606,7 +712,7 @@ bool TradingManager::isDataExists() const {
 }
 
 void TradingManager::resetData() {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
+  auto &currentTradeConfiguration = takeTradeConfiguration();
   auto &stockExchangeSettings = currentTradeConfiguration.getStockExchangeSettings();
   auto &coinSettings = currentTradeConfiguration.getCoinSettings();
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_market_histories.h"
+
+#include <exception>
+#include <utility>
+
+namespace auto_trader {
+namespace trader {
+
+constexpr size_t TradingMarketHistories::ALL_CANDLES;
+
+common::MarketHistoryPtr TradingMarketHistories::get(stock_exchange::Query& query,
+                                                     common::Currency::Enum baseCurrency,
+                                                     common::Currency::Enum tradedCurrency,
+                                                     common::TickInterval::Enum interval,
+                                                     size_t candlesCount) {
+  MarketKey key(baseCurrency, tradedCurrency, interval);
+  std::promise<std::shared_ptr<const common::MarketHistory>> promise;
+  std::shared_ptr<Download> download;
+  bool isDownloading = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& keyDownload = downloads_[key];
+    if (!keyDownload || keyDownload->candlesCount_ < candlesCount) {
+      keyDownload = std::make_shared<Download>();
+      keyDownload->candlesCount_ = candlesCount;
+      keyDownload->marketHistory_ = promise.get_future().share();
+      isDownloading = true;
+    }
+    download = keyDownload;
+  }
+
+  if (isDownloading) {
+    try {
+      std::shared_ptr<const common::MarketHistory> marketHistory =
+          (candlesCount == ALL_CANDLES)
+              ? query.getMarketHistory(baseCurrency, tradedCurrency, interval)
+              : query.getLatestMarketHistory(baseCurrency, tradedCurrency, interval,
+                                             candlesCount);
+      promise.set_value(std::move(marketHistory));
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto keyDownload = downloads_.find(key);
+        if (keyDownload != downloads_.end() && keyDownload->second == download) {
+          downloads_.erase(keyDownload);
+        }
+      }
+      promise.set_exception(std::current_exception());
+    }
+  }
+
+  auto marketHistory = std::make_unique<common::MarketHistory>(*download->marketHistory_.get());
+  auto& marketData = marketHistory->marketData_;
+  if (candlesCount < marketData.size()) {
+    marketData.erase(marketData.begin(), marketData.end() - candlesCount);
+  }
+
+  return marketHistory;
+}
+
+void TradingMarketHistories::load(stock_exchange::Query& query,
+                                  common::Currency::Enum baseCurrency,
+                                  const std::vector<common::Currency::Enum>& tradedCurrencies,
+                                  const CandlesLookbacks& candlesLookbacks,
+                                  TradingWorkerPool& workerPool) {
+  std::vector<std::pair<common::Currency::Enum, CandlesLookbacks::value_type>> requests;
+  for (auto tradedCurrency : tradedCurrencies) {
+    for (const auto& candlesLookback : candlesLookbacks) {
+      requests.emplace_back(tradedCurrency, candlesLookback);
+    }
+  }
+
+  // A failed download is not kept; the strategy pass requests it again and reports the error
+  // for its market.
+  workerPool.run(requests.size(), query.getParallelRequestsLimit(), [&](size_t index) {
+    const auto& request = requests[index];
+    try {
+      get(query, baseCurrency, request.first, request.second.first, request.second.second);
+    } catch (...) {
+    }
+  });
+}
+
+void TradingMarketHistories::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  downloads_.clear();
+}
+
+}  // namespace trader
+}  // namespace auto_trader
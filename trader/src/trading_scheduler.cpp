@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_scheduler.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace auto_trader {
+namespace trader {
+
+namespace {
+
+constexpr int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+// 1970-01-01 was a Thursday; weekly candles open on Mondays.
+constexpr int64_t FIRST_MONDAY_OFFSET = 4 * SECONDS_PER_DAY;
+
+// Days since 1970-01-01 of a proleptic Gregorian date.
+int64_t getDaysFromCivil(int64_t year, int month, int day) {
+  year -= (month <= 2) ? 1 : 0;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const int64_t yearOfEra = year - era * 400;
+  const int64_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  const int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+void getCivilFromDays(int64_t days, int64_t& year, int& month) {
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const int64_t dayOfEra = days - era * 146097;
+  const int64_t yearOfEra =
+      (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+  const int64_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+  const int64_t monthIndex = (5 * dayOfYear + 2) / 153;
+  month = static_cast<int>(monthIndex < 10 ? monthIndex + 3 : monthIndex - 9);
+  year = yearOfEra + era * 400 + ((month <= 2) ? 1 : 0);
+}
+
+int64_t getCandleCloseTime(common::TickInterval::Enum interval, int64_t time) {
+  switch (interval) {
+    case common::TickInterval::ONE_MONTH: {
+      int64_t year = 0;
+      int month = 0;
+      getCivilFromDays(time / SECONDS_PER_DAY, year, month);
+      int64_t nextMonthDays =
+          (month == 12) ? getDaysFromCivil(year + 1, 1, 1) : getDaysFromCivil(year, month + 1, 1);
+      return nextMonthDays * SECONDS_PER_DAY;
+    }
+    case common::TickInterval::ONE_YEAR: {
+      int64_t year = 0;
+      int month = 0;
+      getCivilFromDays(time / SECONDS_PER_DAY, year, month);
+      return getDaysFromCivil(year + 1, 1, 1) * SECONDS_PER_DAY;
+    }
+    case common::TickInterval::ONE_WEEK:
+    case common::TickInterval::TWO_WEEKS: {
+      int64_t seconds = common::TickInterval::toSeconds(interval);
+      return ((time - FIRST_MONDAY_OFFSET) / seconds + 1) * seconds + FIRST_MONDAY_OFFSET;
+    }
+    default: {
+      int64_t seconds = common::TickInterval::toSeconds(interval);
+      if (seconds == 0) {
+        return time;
+      }
+      return (time / seconds + 1) * seconds;
+    }
+  }
+}
+
+}  // namespace
+
+const std::chrono::seconds TradingScheduler::DEFAULT_SETTLEMENT_DELAY{3};
+
+TradingScheduler::TradingScheduler(std::chrono::seconds ordersPollingPeriod,
+                                   std::chrono::seconds settlementDelay,
+                                   std::chrono::seconds candlesUtcOffset)
+    : ordersPollingPeriod_(ordersPollingPeriod),
+      settlementDelay_(settlementDelay),
+      candlesUtcOffset_(candlesUtcOffset),
+      nextOrdersPolling_(Clock::time_point::min()),
+      isFirstStep_(true) {}
+
+void TradingScheduler::setIntervals(const std::set<common::TickInterval::Enum>& intervals,
+                                    Clock::time_point now) {
+  for (auto candlesSettlement = candlesSettlements_.begin();
+       candlesSettlement != candlesSettlements_.end();) {
+    if (intervals.count(candlesSettlement->first) == 0) {
+      candlesSettlement = candlesSettlements_.erase(candlesSettlement);
+    } else {
+      ++candlesSettlement;
+    }
+  }
+
+  for (auto interval : intervals) {
+    if (common::TickInterval::toSeconds(interval) == 0 || candlesSettlements_.count(interval)) {
+      continue;
+    }
+    candlesSettlements_[interval] =
+        getCandleClose(interval, now, candlesUtcOffset_) + settlementDelay_;
+  }
+}
+
+bool TradingScheduler::takeStep(Clock::time_point now) {
+  bool isCandleClosed = false;
+  for (auto& candlesSettlement : candlesSettlements_) {
+    if (candlesSettlement.second <= now) {
+      candlesSettlement.second =
+          getCandleClose(candlesSettlement.first, now, candlesUtcOffset_) + settlementDelay_;
+      isCandleClosed = true;
+    }
+  }
+
+  nextOrdersPolling_ = now + ordersPollingPeriod_;
+
+  bool isStrategyDue = isFirstStep_ || isCandleClosed || ordersPollingPeriod_.count() == 0;
+  isFirstStep_ = false;
+  return isStrategyDue;
+}
+
+TradingScheduler::Clock::time_point TradingScheduler::getNextWakeUp() const {
+  auto nextWakeUp = nextOrdersPolling_;
+  for (const auto& candlesSettlement : candlesSettlements_) {
+    nextWakeUp = std::min(nextWakeUp, candlesSettlement.second);
+  }
+
+  return nextWakeUp;
+}
+
+TradingScheduler::Clock::time_point TradingScheduler::getCandleClose(
+    common::TickInterval::Enum interval, Clock::time_point time,
+    std::chrono::seconds candlesUtcOffset) {
+  // Candles are cut at multiples of the interval in the exchange time zone, so the close is found
+  // on the local clock and shifted back to UTC.
+  auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time.time_since_epoch());
+  auto localTime = seconds.count() + candlesUtcOffset.count();
+  auto closeTime = getCandleCloseTime(interval, localTime);
+  if (closeTime == localTime) {
+    return time;
+  }
+
+  return Clock::time_point(std::chrono::seconds(closeTime - candlesUtcOffset.count()));
+}
+
+}  // namespace trader
+}  // namespace auto_trader
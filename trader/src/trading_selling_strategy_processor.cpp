@@ -26,6 +26,8 @@
 
 #include "include/trading_selling_strategy_processor.h"
 
+#include <cmath>
+
 #include "features/include/stop_loss_announcer.h"
 #include "features/include/telegram_announcer.h"
 #include "model/include/settings/strategies_settings/bollinger_bands_advanced_settings.h"
@@ -43,15 +45,16 @@ namespace auto_trader {
 namespace trader {
 
 TradingSellStrategyProcessor::TradingSellStrategyProcessor(
-    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyFacade &strategiesLibrary,
+    stock_exchange::QueryProcessor &queryProcessor, strategies::StrategyPool &strategyPool,
     database::Database &databaseProvider, common::AppListener &appListener,
     const model::StrategiesSettingsHolder &strategiesSettingsHolder,
     model::TradeOrdersHolder &tradeOrdersHolder, model::TradeConfigsHolder &tradeConfigsHolder,
     model::TradeSignaledStrategyMarketHolder &tradeSignaledStrategyMarketHolder,
     const model::TradeConfiguration &tradeConfiguration, TradingMessageSender &messageSender,
-    const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager)
+    const stock_exchange::CurrencyLotsHolder &lotsHolder, const TradingManager &tradingManager,
+    TradingWorkerPool &workerPool, TradingMarketHistories &marketHistories,
+    strategies::StrategyResultCache &resultCache)
     : queryProcessor_(queryProcessor),
-      strategiesLibrary_(strategiesLibrary),
       databaseProvider_(databaseProvider),
       appListener_(appListener),
       tradeConfiguration_(tradeConfiguration),
@@ -62,6 +65,9 @@ TradingSellStrategyProcessor::TradingSellStrategyProcessor(
       messageSender_(messageSender),
       lotsHolder_(lotsHolder),
       tradingManager_(tradingManager),
+      workerPool_(workerPool),
+      marketHistories_(marketHistories),
+      strategyEvaluator_(strategyPool, resultCache, workerPool, tradeConfiguration),
       processingResult(true) {}
 
 void TradingSellStrategyProcessor::runStrategyProcessor() {
@@ -71,8 +77,21 @@ void TradingSellStrategyProcessor::runStrategyProcessor() {
   const auto &stockExchangeSettings = tradeConfiguration_.getStockExchangeSettings();
   auto query = queryProcessor_.getQuery(stockExchangeSettings.stockExchangeType_);
   auto &orderMatching = tradeOrdersHolder_.takeOrderMatching();
+  candlesLookbacks_ = TradingLookbackPlanner().plan(strategySettings);
 
-  auto currentTick = query->getCurrencyTick(coinSettings.baseCurrency_, currentTradedCurrency_);
+  std::vector<common::Currency::Enum> profitCurrencies;
+  for (auto tradedCurrency : coinSettings.tradedCurrencies_) {
+    if (tradeOrdersHolder_.containOrdersProfit(tradedCurrency)) {
+      profitCurrencies.push_back(tradedCurrency);
+    }
+  }
+  marketHistories_.load(*query, coinSettings.baseCurrency_, profitCurrencies, candlesLookbacks_,
+                        workerPool_);
+  strategyEvaluator_.evaluateMarkets(
+      strategySettings, profitCurrencies,
+      [this](common::Currency::Enum tradedCurrency, common::TickInterval::Enum interval) {
+        return getMarketHistory(tradedCurrency, interval);
+      });
 
   for (int index = 0; index < coinSettings.tradedCurrencies_.size(); ++index) {
     auto tradedCurrency = coinSettings.tradedCurrencies_[index];
@@ -97,6 +116,7 @@ void TradingSellStrategyProcessor::runStrategyProcessor() {
 
     strategySettings.accept(*this);
 
+    auto currentTick = query->getTickFromAllTicks(coinSettings.baseCurrency_, tradedCurrency);
     for (auto &order : orders) {
       double quantity = calculateOrderQuantity(order, ordersProfit);
       if (quantity == 0) {
@@ -133,7 +153,7 @@ void TradingSellStrategyProcessor::runTakeProfitProcessor() {
     for (const auto &order : sellOrders) {
       double profitDelta = order.price_ * (sellSettings.profitPercentage_ / 100);
       double boughtPrice = order.price_ + profitDelta;
-      auto currentTick = query->getCurrencyTick(order.fromCurrency_, order.toCurrency_);
+      auto currentTick = query->getTickFromAllTicks(order.fromCurrency_, order.toCurrency_);
       if (currentTick.bid_ >= boughtPrice) {
         double quantity = calculateOrderQuantity(order, ordersProfit);
         if (quantity == 0) {
@@ -167,7 +187,7 @@ void TradingSellStrategyProcessor::runStopLossProcessor() {
             [&](const common::MarketOrder &order) { stopLossOrders.insert(order); });
 
     for (const auto &order : stopLossOrders) {
-      auto currentTick = query->getCurrencyTick(order.fromCurrency_, order.toCurrency_);
+      auto currentTick = query->getTickFromAllTicks(order.fromCurrency_, order.toCurrency_);
       auto &stopLossAnnounces = features::stop_loss_announcer::StopLossAnnouncer::instance();
       double stopLossPercentage = stopLossAnnounces.getValue() / 100;
       double stopLossEdge = order.price_ * (1 - stopLossPercentage);
@@ -196,14 +216,10 @@ void TradingSellStrategyProcessor::visit(const model::BollingerBandsSettings &ba
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getBollingerBandStrategy();
-  currentStrategy->createLines(marketHistory->marketData_, bandsSettings.period_,
-                               bandsSettings.bbInputType_, bandsSettings.standardDeviations_,
-                               bandsSettings.crossingInterval_, bandsSettings.lastBuyCrossingPoint_,
-                               bandsSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, bandsSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToSell())
-                                             : (processingResult & currentStrategy->isNeedToSell());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToSell_)
+                                             : (processingResult & signal.isNeedToSell_);
 }
 
 void TradingSellStrategyProcessor::visit(
@@ -219,17 +235,11 @@ void TradingSellStrategyProcessor::visit(
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getBollingerBandAdvanceStrategy();
-  currentStrategy->setPercentageForBottomLine(bandsAdvancedSettings.bottomLinePercentage_);
-  currentStrategy->setPercentageForTopLine(bandsAdvancedSettings.topLinePercentage_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, bandsAdvancedSettings,
+                                            *marketHistory);
 
-  currentStrategy->createLines(
-      marketHistory->marketData_, bandsAdvancedSettings.period_, bandsAdvancedSettings.bbInputType_,
-      bandsAdvancedSettings.standardDeviations_, bandsAdvancedSettings.crossingInterval_,
-      bandsAdvancedSettings.lastBuyCrossingPoint_, bandsAdvancedSettings.lastSellCrossingPoint_);
-
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToSell())
-                                             : (processingResult & currentStrategy->isNeedToSell());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToSell_)
+                                             : (processingResult & signal.isNeedToSell_);
 }
 
 void TradingSellStrategyProcessor::visit(const model::RsiSettings &rsiSettings) {
@@ -244,16 +254,10 @@ void TradingSellStrategyProcessor::visit(const model::RsiSettings &rsiSettings)
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getRsiStrategy();
-  currentStrategy->setTopRsiIndex(rsiSettings.topLevel_);
-  currentStrategy->setBottomRsiIndex(rsiSettings.bottomLevel_);
-
-  currentStrategy->createLine(marketHistory->marketData_, rsiSettings.period_,
-                              rsiSettings.crossingInterval_, rsiSettings.lastBuyCrossingPoint_,
-                              rsiSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, rsiSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 }
 
 void TradingSellStrategyProcessor::visit(const model::EmaSettings &emaSettings) {
@@ -268,13 +272,10 @@ void TradingSellStrategyProcessor::visit(const model::EmaSettings &emaSettings)
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getEmaStrategy();
-  currentStrategy->createLine(marketHistory->marketData_, emaSettings.period_,
-                              emaSettings.crossingInterval_, emaSettings.lastBuyCrossingPoint_,
-                              emaSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, emaSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 }
 
 void TradingSellStrategyProcessor::visit(const model::SmaSettings &smaSettings) {
@@ -289,13 +290,10 @@ void TradingSellStrategyProcessor::visit(const model::SmaSettings &smaSettings)
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getSmaStrategy();
-  currentStrategy->createLine(marketHistory->marketData_, smaSettings.period_,
-                              smaSettings.crossingInterval_, smaSettings.lastBuyCrossingPoint_,
-                              smaSettings.lastSellCrossingPoint_);
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, smaSettings, *marketHistory);
 
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 }
 
 void TradingSellStrategyProcessor::visit(
@@ -310,17 +308,11 @@ void TradingSellStrategyProcessor::visit(
     processingResult = (anyIndicatorTriggered) ? (processingResult | false) : (false);
     return;
   }
-  auto currentStrategy = strategiesLibrary_.getMACrossingStrategy();
-  currentStrategy->setCrossingInterval(movingAveragesCrossingSettings.crossingInterval_);
-  currentStrategy->createLines(marketHistory->marketData_,
-                               movingAveragesCrossingSettings.smallerPeriod_,
-                               movingAveragesCrossingSettings.biggerPeriod_,
-                               movingAveragesCrossingSettings.lastBuyCrossingPoint_,
-                               movingAveragesCrossingSettings.lastSellCrossingPoint_,
-                               movingAveragesCrossingSettings.movingAverageType_);
-
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, movingAveragesCrossingSettings,
+                                            *marketHistory);
+
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 }
 
 void TradingSellStrategyProcessor::visit(
@@ -336,21 +328,11 @@ void TradingSellStrategyProcessor::visit(
     return;
   }
 
-  auto currentStrategy = strategiesLibrary_.getStochasticOscillatorStrategy();
-  currentStrategy->setBottomLevel(stochasticOscillatorSettings.bottomLevel);
-  currentStrategy->setTopLevel(stochasticOscillatorSettings.topLevel);
-
-  currentStrategy->createLines(marketHistory->marketData_,
-                               stochasticOscillatorSettings.stochasticType_,
-                               stochasticOscillatorSettings.periodsForClassicLine_,
-                               stochasticOscillatorSettings.smoothFastPeriod_,
-                               stochasticOscillatorSettings.smoothSlowPeriod_,
-                               stochasticOscillatorSettings.crossingInterval_,
-                               stochasticOscillatorSettings.lastBuyCrossingPoint_,
-                               stochasticOscillatorSettings.lastSellCrossingPoint_);
-
-  processingResult = (anyIndicatorTriggered) ? (processingResult | currentStrategy->isNeedToBuy())
-                                             : (processingResult & currentStrategy->isNeedToBuy());
+  auto signal = strategyEvaluator_.evaluate(currentTradedCurrency_, stochasticOscillatorSettings,
+                                            *marketHistory);
+
+  processingResult = (anyIndicatorTriggered) ? (processingResult | signal.isNeedToBuy_)
+                                             : (processingResult & signal.isNeedToBuy_);
 }
 
 void TradingSellStrategyProcessor::visit(
@@ -366,13 +348,22 @@ void TradingSellStrategyProcessor::visit(
 
 common::MarketHistoryPtr TradingSellStrategyProcessor::getMarketHistory(
     common::TickInterval::Enum interval) const {
+  return getMarketHistory(currentTradedCurrency_, interval);
+}
+
+common::MarketHistoryPtr TradingSellStrategyProcessor::getMarketHistory(
+    common::Currency::Enum tradedCurrency, common::TickInterval::Enum interval) const {
   auto &coinSettings = tradeConfiguration_.getCoinSettings();
   auto &stockExchangeSettings = tradeConfiguration_.getStockExchangeSettings();
   auto query = queryProcessor_.getQuery(stockExchangeSettings.stockExchangeType_);
 
-  auto marketHistory =
-      query->getMarketHistory(coinSettings.baseCurrency_, currentTradedCurrency_, interval);
-  return marketHistory;
+  auto candlesLookback = candlesLookbacks_.find(interval);
+  size_t candlesCount = (candlesLookback == candlesLookbacks_.end())
+                            ? TradingMarketHistories::ALL_CANDLES
+                            : candlesLookback->second;
+
+  return marketHistories_.get(*query, coinSettings.baseCurrency_, tradedCurrency, interval,
+                              candlesCount);
 }
 
 common::MarketOrder TradingSellStrategyProcessor::openOrder(const common::MarketOrder &order,
@@ -391,6 +382,7 @@ common::MarketOrder TradingSellStrategyProcessor::openOrder(const common::Market
 
   common::MarketOrder currentOrder =
       query->sellOrder(coinSettings.baseCurrency_, currentTradedCurrency_, quantity, price);
+  query->invalidateBalances();
 
   const std::string fullMessage = message + " : [ " + currentOrder.toString() + " ]";
   messageSender_.sendMessage(message);
@@ -400,8 +392,7 @@ common::MarketOrder TradingSellStrategyProcessor::openOrder(const common::Market
     telegramAnnouncer.sendMessage(message);
   }
 
-  databaseProvider_.insertMarketOrder(currentOrder);
-  currentOrder.databaseId_ = databaseProvider_.getLastInsertRowId();
+  currentOrder.databaseId_ = databaseProvider_.insertMarketOrder(currentOrder);
 
   auto currencyPair = common::Currency::toString(order.fromCurrency_) +
                       common::Currency::toString(order.toCurrency_);
@@ -476,8 +467,7 @@ double TradingSellStrategyProcessor::calculateOrderQuantity(const common::Market
 }
 
 void TradingSellStrategyProcessor::resetOrderProfit(model::OrdersProfit &orderProfit) {
-  auto &currentTradeConfiguration = tradeConfigsHolder_.takeCurrentTradeConfiguration();
-  auto &stockExchangeSettings = currentTradeConfiguration.getStockExchangeSettings();
+  auto &stockExchangeSettings = tradeConfiguration_.getStockExchangeSettings();
   common::Currency::Enum tradedCurrency = orderProfit.getCurrency();
 
   databaseProvider_.removeCurrencyProfit(tradedCurrency, stockExchangeSettings.stockExchangeType_);
@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_strategy_evaluator.h"
+
+#include <algorithm>
+#include <exception>
+
+#include "common/exceptions/strategy_exception/strategy_exception.h"
+#include "model/include/settings/strategies_settings/bollinger_bands_advanced_settings.h"
+#include "model/include/settings/strategies_settings/bollinger_bands_settings.h"
+#include "model/include/settings/strategies_settings/custom_strategy_settings.h"
+#include "model/include/settings/strategies_settings/ema_settings.h"
+#include "model/include/settings/strategies_settings/ma_crossing_settings.h"
+#include "model/include/settings/strategies_settings/rsi_settings.h"
+#include "model/include/settings/strategies_settings/sma_settings.h"
+#include "model/include/settings/strategies_settings/stochastic_oscillator_settings.h"
+
+namespace auto_trader {
+namespace trader {
+
+TradingStrategyEvaluator::TradingStrategyEvaluator(
+    strategies::StrategyPool& strategyPool, strategies::StrategyResultCache& resultCache,
+    TradingWorkerPool& workerPool, const model::TradeConfiguration& tradeConfiguration)
+    : strategyPool_(strategyPool),
+      resultCache_(resultCache),
+      workerPool_(workerPool),
+      tradeConfiguration_(tradeConfiguration) {}
+
+void TradingStrategyEvaluator::evaluateMarkets(
+    const model::StrategySettings& strategySettings,
+    const std::vector<common::Currency::Enum>& tradedCurrencies,
+    const MarketHistoryGetter& getMarketHistory) {
+  tradedCurrencies_ = &tradedCurrencies;
+  getMarketHistory_ = &getMarketHistory;
+  strategySettings.accept(*this);
+  tradedCurrencies_ = nullptr;
+  getMarketHistory_ = nullptr;
+}
+
+strategies::StrategySignal TradingStrategyEvaluator::evaluate(
+    common::Currency::Enum tradedCurrency, const model::StrategySettings& strategySettings,
+    const common::MarketHistory& marketHistory) {
+  strategySettings.accept(*this);
+
+  auto key = createKey(tradedCurrency, strategySettings, marketHistory);
+  strategies::StrategySignal signal;
+  if (!resultCache_.find(key, signal)) {
+    auto strategies = strategyPool_.acquire();
+    auto& batch = strategies->getBatch();
+    signal = batch.evaluate(strategyType_, {&marketHistory.marketData_}, createLines_).front();
+    resultCache_.insert(key, signal);
+  }
+
+  if (!signal.isEvaluated_) {
+    throw common::exceptions::StrategyException(signal.error_);
+  }
+
+  return signal;
+}
+
+void TradingStrategyEvaluator::visit(const model::BollingerBandsSettings& bandsSettings) {
+  bindIndicator(bandsSettings, common::StrategiesType::BOLLINGER_BANDS,
+                [&bandsSettings](strategies::TradeStrategy& strategy,
+                                 const common::CandleSeries& candles) {
+                  auto& bands = static_cast<strategies::BollingerBandsBase&>(strategy);
+                  bands.createLines(candles, bandsSettings.period_, bandsSettings.bbInputType_,
+                                    bandsSettings.standardDeviations_,
+                                    bandsSettings.crossingInterval_,
+                                    bandsSettings.lastBuyCrossingPoint_,
+                                    bandsSettings.lastSellCrossingPoint_);
+                });
+}
+
+void TradingStrategyEvaluator::visit(
+    const model::BollingerBandsAdvancedSettings& bandsAdvancedSettings) {
+  bindIndicator(bandsAdvancedSettings, common::StrategiesType::BOLLINGER_BANDS_ADVANCED,
+                [&bandsAdvancedSettings](strategies::TradeStrategy& strategy,
+                                         const common::CandleSeries& candles) {
+                  auto& bands = static_cast<strategies::BollingerBandsBase&>(strategy);
+                  bands.setPercentageForBottomLine(bandsAdvancedSettings.bottomLinePercentage_);
+                  bands.setPercentageForTopLine(bandsAdvancedSettings.topLinePercentage_);
+                  bands.createLines(candles, bandsAdvancedSettings.period_,
+                                    bandsAdvancedSettings.bbInputType_,
+                                    bandsAdvancedSettings.standardDeviations_,
+                                    bandsAdvancedSettings.crossingInterval_,
+                                    bandsAdvancedSettings.lastBuyCrossingPoint_,
+                                    bandsAdvancedSettings.lastSellCrossingPoint_);
+                });
+}
+
+void TradingStrategyEvaluator::visit(const model::RsiSettings& rsiSettings) {
+  bindIndicator(
+      rsiSettings, common::StrategiesType::RSI,
+      [&rsiSettings](strategies::TradeStrategy& strategy, const common::CandleSeries& candles) {
+        auto& rsi = static_cast<strategies::RsiBase&>(strategy);
+        rsi.setTopRsiIndex(rsiSettings.topLevel_);
+        rsi.setBottomRsiIndex(rsiSettings.bottomLevel_);
+        rsi.setSmoothingType(rsiSettings.smoothingType_);
+        rsi.createLine(candles, rsiSettings.period_, rsiSettings.crossingInterval_,
+                       rsiSettings.lastBuyCrossingPoint_, rsiSettings.lastSellCrossingPoint_);
+      });
+}
+
+void TradingStrategyEvaluator::visit(const model::EmaSettings& emaSettings) {
+  bindIndicator(
+      emaSettings, common::StrategiesType::EMA,
+      [&emaSettings](strategies::TradeStrategy& strategy, const common::CandleSeries& candles) {
+        auto& ema = static_cast<strategies::ExponentialMovingAverage&>(strategy);
+        ema.createLine(candles, emaSettings.period_, emaSettings.crossingInterval_,
+                       emaSettings.lastBuyCrossingPoint_, emaSettings.lastSellCrossingPoint_);
+      });
+}
+
+void TradingStrategyEvaluator::visit(const model::SmaSettings& smaSettings) {
+  bindIndicator(
+      smaSettings, common::StrategiesType::SMA,
+      [&smaSettings](strategies::TradeStrategy& strategy, const common::CandleSeries& candles) {
+        auto& sma = static_cast<strategies::SimpleMovingAverage&>(strategy);
+        sma.createLine(candles, smaSettings.period_, smaSettings.crossingInterval_,
+                       smaSettings.lastBuyCrossingPoint_, smaSettings.lastSellCrossingPoint_);
+      });
+}
+
+void TradingStrategyEvaluator::visit(
+    const model::MovingAveragesCrossingSettings& movingAveragesCrossingSettings) {
+  bindIndicator(movingAveragesCrossingSettings, common::StrategiesType::MA_CROSSING,
+                [&movingAveragesCrossingSettings](strategies::TradeStrategy& strategy,
+                                                  const common::CandleSeries& candles) {
+                  auto& crossing = static_cast<strategies::MovingAveragesCrossing&>(strategy);
+                  crossing.setCrossingInterval(movingAveragesCrossingSettings.crossingInterval_);
+                  crossing.createLines(candles, movingAveragesCrossingSettings.smallerPeriod_,
+                                       movingAveragesCrossingSettings.biggerPeriod_,
+                                       movingAveragesCrossingSettings.lastBuyCrossingPoint_,
+                                       movingAveragesCrossingSettings.lastSellCrossingPoint_,
+                                       movingAveragesCrossingSettings.movingAverageType_);
+                });
+}
+
+void TradingStrategyEvaluator::visit(
+    const model::StochasticOscillatorSettings& stochasticOscillatorSettings) {
+  bindIndicator(stochasticOscillatorSettings, common::StrategiesType::STOCHASTIC_OSCILLATOR,
+                [&stochasticOscillatorSettings](strategies::TradeStrategy& strategy,
+                                                const common::CandleSeries& candles) {
+                  auto& oscillator = static_cast<strategies::StochasticOscillator&>(strategy);
+                  oscillator.setBottomLevel(stochasticOscillatorSettings.bottomLevel);
+                  oscillator.setTopLevel(stochasticOscillatorSettings.topLevel);
+                  oscillator.createLines(candles, stochasticOscillatorSettings.stochasticType_,
+                                         stochasticOscillatorSettings.periodsForClassicLine_,
+                                         stochasticOscillatorSettings.smoothFastPeriod_,
+                                         stochasticOscillatorSettings.smoothSlowPeriod_,
+                                         stochasticOscillatorSettings.crossingInterval_,
+                                         stochasticOscillatorSettings.lastBuyCrossingPoint_,
+                                         stochasticOscillatorSettings.lastSellCrossingPoint_);
+                });
+}
+
+void TradingStrategyEvaluator::visit(const model::CustomStrategySettings& customStrategySettings) {
+  size_t strategiesCount = customStrategySettings.getStrategiesCount();
+  for (int index = 0; index < strategiesCount; ++index) {
+    customStrategySettings.getStrategy(index)->accept(*this);
+  }
+}
+
+void TradingStrategyEvaluator::bindIndicator(
+    const model::StrategySettings& strategySettings, common::StrategiesType strategyType,
+    strategies::StrategyBatch::CreateFunction createLines) {
+  strategyType_ = strategyType;
+  createLines_ = std::move(createLines);
+
+  if (tradedCurrencies_) {
+    evaluateBoundIndicator(strategySettings);
+  }
+}
+
+void TradingStrategyEvaluator::evaluateBoundIndicator(
+    const model::StrategySettings& strategySettings) {
+  std::vector<common::MarketHistoryPtr> marketHistories;
+  std::vector<strategies::StrategyResultKey> keys;
+  strategies::StrategyBatch::Markets markets;
+
+  for (auto tradedCurrency : *tradedCurrencies_) {
+    common::MarketHistoryPtr marketHistory;
+    try {
+      marketHistory = (*getMarketHistory_)(tradedCurrency, strategySettings.tickInterval_);
+    } catch (const std::exception&) {
+      continue;
+    }
+    if (!marketHistory || marketHistory->marketData_.empty()) continue;
+
+    auto key = createKey(tradedCurrency, strategySettings, *marketHistory);
+    strategies::StrategySignal signal;
+    if (resultCache_.find(key, signal)) continue;
+
+    keys.push_back(std::move(key));
+    markets.push_back(&marketHistory->marketData_);
+    marketHistories.push_back(std::move(marketHistory));
+  }
+
+  if (markets.empty()) return;
+
+  const size_t rangesCount = std::min(workerPool_.getWorkersCount(), markets.size());
+  std::vector<strategies::StrategySignal> marketSignals(markets.size());
+  workerPool_.run(rangesCount, rangesCount, [&](size_t rangeIndex) {
+    evaluateRange(markets, rangeIndex * markets.size() / rangesCount,
+                  (rangeIndex + 1) * markets.size() / rangesCount, marketSignals);
+  });
+
+  for (size_t index = 0; index < marketSignals.size(); ++index) {
+    resultCache_.insert(keys[index], marketSignals[index]);
+  }
+}
+
+void TradingStrategyEvaluator::evaluateRange(
+    const strategies::StrategyBatch::Markets& markets, size_t begin, size_t end,
+    std::vector<strategies::StrategySignal>& marketSignals) {
+  // Runs on a worker, where nothing may throw; a range that cannot start stays unevaluated and
+  // is built again, with its error, by evaluate().
+  try {
+    auto strategies = strategyPool_.acquire();
+    auto& batch = strategies->getBatch();
+    batch.evaluate(strategyType_, markets, begin, end, createLines_, marketSignals);
+  } catch (const std::exception& exception) {
+    for (size_t index = begin; index < end; ++index) {
+      marketSignals[index].error_ = exception.what();
+    }
+  }
+}
+
+strategies::StrategyResultKey TradingStrategyEvaluator::createKey(
+    common::Currency::Enum tradedCurrency, const model::StrategySettings& strategySettings,
+    const common::MarketHistory& marketHistory) const {
+  strategies::StrategyResultKey key;
+  key.stockExchangeType_ = tradeConfiguration_.getStockExchangeSettings().stockExchangeType_;
+  key.baseCurrency_ = tradeConfiguration_.getCoinSettings().baseCurrency_;
+  key.tradedCurrency_ = tradedCurrency;
+  key.tickInterval_ = strategySettings.tickInterval_;
+  key.lastCandleTime_ = strategies::StrategyResultKey::getLastCandleTime(marketHistory.marketData_);
+  key.strategyType_ = strategyType_;
+  key.settings_ = strategySettings.getResultKey();
+  return key;
+}
+
+}  // namespace trader
+}  // namespace auto_trader
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "include/trading_worker_pool.h"
+
+#include <algorithm>
+
+namespace auto_trader {
+namespace trader {
+
+TradingWorkerPool::TradingWorkerPool(size_t workersCount) {
+  workersCount = std::max<size_t>(1, workersCount);
+  for (size_t index = 0; index < workersCount; ++index) {
+    queues_.push_back(std::make_unique<TaskQueue>());
+  }
+
+  for (size_t index = 1; index < workersCount; ++index) {
+    threads_.emplace_back(&TradingWorkerPool::work, this, index);
+  }
+}
+
+TradingWorkerPool::~TradingWorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    isStopping_ = true;
+  }
+  batchStarted_.notify_all();
+
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t TradingWorkerPool::getDefaultWorkersCount() {
+  return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+void TradingWorkerPool::run(size_t tasksCount, size_t parallelism,
+                            const std::function<void(size_t)>& task) {
+  if (tasksCount == 0) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> runLock(runMutex_);
+
+  size_t participantsCount = std::min({std::max<size_t>(1, parallelism), getWorkersCount(),
+                                       tasksCount});
+  for (size_t queueIndex = 0; queueIndex < participantsCount; ++queueIndex) {
+    auto& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> queueLock(queue.mutex_);
+    queue.indices_.clear();
+    for (size_t taskIndex = tasksCount * queueIndex / participantsCount;
+         taskIndex < tasksCount * (queueIndex + 1) / participantsCount; ++taskIndex) {
+      queue.indices_.push_back(taskIndex);
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(batchMutex_);
+    task_ = &task;
+    participantsCount_ = participantsCount;
+    busyWorkersCount_ = participantsCount - 1;
+    ++batchId_;
+  }
+  batchStarted_.notify_all();
+
+  processTasks(0);
+
+  std::unique_lock<std::mutex> lock(batchMutex_);
+  batchFinished_.wait(lock, [this]() { return busyWorkersCount_ == 0; });
+  task_ = nullptr;
+}
+
+void TradingWorkerPool::work(size_t threadIndex) {
+  size_t lastBatchId = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(batchMutex_);
+      batchStarted_.wait(lock, [&]() { return isStopping_ || batchId_ != lastBatchId; });
+      if (isStopping_) {
+        return;
+      }
+
+      lastBatchId = batchId_;
+      if (threadIndex >= participantsCount_) {
+        continue;
+      }
+    }
+
+    processTasks(threadIndex);
+
+    {
+      std::lock_guard<std::mutex> lock(batchMutex_);
+      --busyWorkersCount_;
+    }
+    batchFinished_.notify_one();
+  }
+}
+
+void TradingWorkerPool::processTasks(size_t queueIndex) {
+  size_t taskIndex = 0;
+  while (takeTask(queueIndex, taskIndex)) {
+    (*task_)(taskIndex);
+  }
+}
+
+bool TradingWorkerPool::takeTask(size_t queueIndex, size_t& taskIndex) {
+  {
+    auto& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    if (!queue.indices_.empty()) {
+      taskIndex = queue.indices_.front();
+      queue.indices_.pop_front();
+      return true;
+    }
+  }
+
+  // No task is added once a batch has started, so empty queues stay empty.
+  for (size_t offset = 1; offset < participantsCount_; ++offset) {
+    auto& queue = *queues_[(queueIndex + offset) % participantsCount_];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    if (!queue.indices_.empty()) {
+      taskIndex = queue.indices_.back();
+      queue.indices_.pop_back();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace trader
+}  // namespace auto_trader
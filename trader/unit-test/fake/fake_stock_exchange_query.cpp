@@ -153,6 +153,10 @@ std::vector<common::MarketOrder> FakeStockExchangeQuery::getMarketOpenOrders(
 
 std::vector<common::MarketOrder> FakeStockExchangeQuery::getAccountOpenOrders(
     common::Currency::Enum fromCurrency, common::Currency::Enum toCurrency) {
+  return getAllAccountOpenOrders();
+}
+
+std::vector<common::MarketOrder> FakeStockExchangeQuery::getAllAccountOpenOrders() {
   std::vector<common::MarketOrder> orders;
   for (auto accountOrderPair : accountOpenOrders_) {
     orders.push_back(accountOrderPair.second);
@@ -173,6 +177,16 @@ common::CurrencyTick FakeStockExchangeQuery::getCurrencyTick(common::Currency::E
   throw common::exceptions::NoDataFoundException("No currency tick.");
 }
 
+stock_exchange::CurrencyTicks FakeStockExchangeQuery::getAllTicks(
+    common::Currency::Enum baseCurrency) {
+  auto it = allTicks_.find(baseCurrency);
+  if (it != allTicks_.end()) {
+    return it->second;
+  }
+
+  return stock_exchange::CurrencyTicks();
+}
+
 double FakeStockExchangeQuery::getBalance(common::Currency::Enum currency) {
   auto it = currenciesBalance_.find(currency);
   if (it != currenciesBalance_.end()) {
@@ -182,6 +196,10 @@ double FakeStockExchangeQuery::getBalance(common::Currency::Enum currency) {
   throw common::exceptions::NoDataFoundException("Account balance.");
 }
 
+stock_exchange::CurrencyBalances FakeStockExchangeQuery::getBalances() {
+  return currenciesBalance_;
+}
+
 stock_exchange::CurrencyLotsHolder FakeStockExchangeQuery::getCurrencyLotsHolder() {
   return lotsHolder_;
 }
@@ -204,6 +222,7 @@ void FakeStockExchangeQuery::setCurrencyTick(common::Currency::Enum fromCurrency
   std::string currencyPair =
       common::Currency::toString(fromCurrency) + common::Currency::toString(toCurrency);
   currenciesTick_[currencyPair] = currencyTick;
+  allTicks_[fromCurrency][toCurrency] = currencyTick;
 }
 
 void FakeStockExchangeQuery::setBalance(common::Currency::Enum currency, double balance) {
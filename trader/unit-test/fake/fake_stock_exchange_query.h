@@ -67,11 +67,14 @@ class FakeStockExchangeQuery : public stock_exchange::Query {
 
   std::vector<common::MarketOrder> getAccountOpenOrders(common::Currency::Enum fromCurrency,
                                                         common::Currency::Enum toCurrency) override;
+  std::vector<common::MarketOrder> getAllAccountOpenOrders() override;
 
   common::CurrencyTick getCurrencyTick(common::Currency::Enum fromCurrency,
                                        common::Currency::Enum toCurrency) override;
+  stock_exchange::CurrencyTicks getAllTicks(common::Currency::Enum baseCurrency) override;
 
   double getBalance(common::Currency::Enum currency) override;
+  stock_exchange::CurrencyBalances getBalances() override;
 
   stock_exchange::CurrencyLotsHolder getCurrencyLotsHolder() override;
   stock_exchange::CurrencyLotsHolder& takeCurrencyLotsHolder();
@@ -96,6 +99,7 @@ class FakeStockExchangeQuery : public stock_exchange::Query {
  private:
   std::map<common::Currency::Enum, double> currenciesBalance_;
   std::map<std::string, common::CurrencyTick> currenciesTick_;
+  std::map<common::Currency::Enum, stock_exchange::CurrencyTicks> allTicks_;
   std::map<std::string, common::MarketOrder> accountOpenOrders_;
   std::map<std::string, common::MarketOrder> allOrders_;
 
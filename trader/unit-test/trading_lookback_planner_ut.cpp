@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "gtest/gtest.h"
+#include "include/trading_lookback_planner.h"
+#include "model/include/settings/strategies_settings/custom_strategy_settings.h"
+#include "model/include/settings/strategies_settings/ema_settings.h"
+#include "model/include/settings/strategies_settings/ma_crossing_settings.h"
+#include "model/include/settings/strategies_settings/rsi_settings.h"
+#include "model/include/settings/strategies_settings/sma_settings.h"
+#include "model/include/settings/strategies_settings/stochastic_oscillator_settings.h"
+
+namespace auto_trader {
+namespace trader {
+namespace unit_test {
+
+TEST(TradingLookbackPlanner, IndicatorWindowWithCrossingIntervalAndOpenCandle) {
+  model::CustomStrategySettings customSettings;
+
+  auto smaSettings = std::make_unique<model::SmaSettings>();
+  smaSettings->tickInterval_ = common::TickInterval::ONE_HOUR;
+  smaSettings->period_ = 20;
+  smaSettings->crossingInterval_ = 2;
+  customSettings.strategies_.push_back(std::move(smaSettings));
+
+  auto stochasticSettings = std::make_unique<model::StochasticOscillatorSettings>();
+  stochasticSettings->tickInterval_ = common::TickInterval::FIVE_MIN;
+  stochasticSettings->periodsForClassicLine_ = 14;
+  stochasticSettings->smoothFastPeriod_ = 3;
+  stochasticSettings->smoothSlowPeriod_ = 3;
+  customSettings.strategies_.push_back(std::move(stochasticSettings));
+
+  auto lookbacks = TradingLookbackPlanner().plan(customSettings);
+
+  ASSERT_EQ(2u, lookbacks.size());
+  EXPECT_EQ(23u, lookbacks[common::TickInterval::ONE_HOUR]);
+  EXPECT_EQ(21u, lookbacks[common::TickInterval::FIVE_MIN]);
+}
+
+TEST(TradingLookbackPlanner, LongestLookbackPerInterval) {
+  model::CustomStrategySettings customSettings;
+
+  auto rsiSettings = std::make_unique<model::RsiSettings>();
+  rsiSettings->tickInterval_ = common::TickInterval::THIRTY_MIN;
+  rsiSettings->period_ = 14;
+  customSettings.strategies_.push_back(std::move(rsiSettings));
+
+  auto crossingSettings = std::make_unique<model::MovingAveragesCrossingSettings>();
+  crossingSettings->tickInterval_ = common::TickInterval::THIRTY_MIN;
+  crossingSettings->smallerPeriod_ = 9;
+  crossingSettings->biggerPeriod_ = 26;
+  customSettings.strategies_.push_back(std::move(crossingSettings));
+
+  auto lookbacks = TradingLookbackPlanner().plan(customSettings);
+
+  ASSERT_EQ(1u, lookbacks.size());
+  EXPECT_EQ(27u, lookbacks[common::TickInterval::THIRTY_MIN]);
+}
+
+TEST(TradingLookbackPlanner, ExponentialAveragesGetWarmUp) {
+  model::CustomStrategySettings customSettings;
+
+  auto emaSettings = std::make_unique<model::EmaSettings>();
+  emaSettings->tickInterval_ = common::TickInterval::ONE_DAY;
+  emaSettings->period_ = 10;
+  customSettings.strategies_.push_back(std::move(emaSettings));
+
+  auto rsiSettings = std::make_unique<model::RsiSettings>();
+  rsiSettings->tickInterval_ = common::TickInterval::ONE_HOUR;
+  rsiSettings->period_ = 14;
+  rsiSettings->smoothingType_ = common::RsiSmoothingType::WILDER;
+  customSettings.strategies_.push_back(std::move(rsiSettings));
+
+  auto lookbacks = TradingLookbackPlanner(2.5).plan(customSettings);
+
+  EXPECT_EQ(26u, lookbacks[common::TickInterval::ONE_DAY]);
+  EXPECT_EQ(37u, lookbacks[common::TickInterval::ONE_HOUR]);
+}
+
+}  // namespace unit_test
+}  // namespace trader
+}  // namespace auto_trader
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "fake/fake_stock_exchange_query.h"
+#include "gtest/gtest.h"
+#include "include/trading_market_histories.h"
+
+namespace auto_trader {
+namespace trader {
+namespace unit_test {
+
+namespace {
+
+class CountingStockExchangeQuery : public FakeStockExchangeQuery {
+ public:
+  common::MarketHistoryPtr getMarketHistory(common::Currency::Enum fromCurrency,
+                                            common::Currency::Enum toCurrency,
+                                            common::TickInterval::Enum interval) override {
+    ++requestsCount_;
+    std::this_thread::sleep_for(delay_);
+    if (isFailing_) {
+      throw std::runtime_error("Market history");
+    }
+
+    auto marketHistory = std::make_unique<common::MarketHistory>();
+    marketHistory->toSell_ = fromCurrency;
+    marketHistory->toBuy_ = toCurrency;
+    marketHistory->marketData_.resize(candlesCount_);
+    for (size_t index = 0; index < candlesCount_; ++index) {
+      marketHistory->marketData_[index].closePrice_ = static_cast<double>(index);
+    }
+
+    return marketHistory;
+  }
+
+  size_t getParallelRequestsLimit() const override { return 4; }
+
+  std::atomic<size_t> requestsCount_{0};
+  std::atomic<bool> isFailing_{false};
+  size_t candlesCount_{10};
+  std::chrono::milliseconds delay_{0};
+};
+
+}  // namespace
+
+TEST(TradingMarketHistories, RepeatedRequestsShareOneDownload) {
+  CountingStockExchangeQuery query;
+  TradingMarketHistories marketHistories;
+
+  auto first = marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                                   common::TickInterval::ONE_HOUR, 10);
+  auto second = marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                                    common::TickInterval::ONE_HOUR, 4);
+
+  EXPECT_EQ(1u, query.requestsCount_);
+  ASSERT_EQ(10u, first->marketData_.size());
+  ASSERT_EQ(4u, second->marketData_.size());
+  EXPECT_EQ(6.0, second->marketData_.front().closePrice_);
+  EXPECT_EQ(9.0, second->marketData_.back().closePrice_);
+
+  marketHistories.get(query, common::Currency::BTC, common::Currency::LTC,
+                      common::TickInterval::ONE_HOUR, 10);
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::FIVE_MIN, 10);
+  EXPECT_EQ(3u, query.requestsCount_);
+}
+
+TEST(TradingMarketHistories, ConcurrentRequestsShareOneDownload) {
+  CountingStockExchangeQuery query;
+  query.delay_ = std::chrono::milliseconds(50);
+  TradingMarketHistories marketHistories;
+
+  std::vector<size_t> candlesCounts(4);
+  std::vector<std::thread> threads;
+  for (size_t index = 0; index < candlesCounts.size(); ++index) {
+    threads.emplace_back([&, index]() {
+      auto marketHistory = marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                                               common::TickInterval::ONE_HOUR, 10);
+      candlesCounts[index] = marketHistory->marketData_.size();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(1u, query.requestsCount_);
+  EXPECT_EQ(std::vector<size_t>(4, 10u), candlesCounts);
+}
+
+TEST(TradingMarketHistories, LongerRequestDownloadsAgain) {
+  CountingStockExchangeQuery query;
+  TradingMarketHistories marketHistories;
+
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::ONE_HOUR, 5);
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::ONE_HOUR, TradingMarketHistories::ALL_CANDLES);
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::ONE_HOUR, 8);
+
+  EXPECT_EQ(2u, query.requestsCount_);
+}
+
+TEST(TradingMarketHistories, FailedDownloadIsNotKept) {
+  CountingStockExchangeQuery query;
+  TradingMarketHistories marketHistories;
+
+  query.isFailing_ = true;
+  EXPECT_THROW(marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                                   common::TickInterval::ONE_HOUR, 10),
+               std::runtime_error);
+
+  query.isFailing_ = false;
+  auto marketHistory = marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                                           common::TickInterval::ONE_HOUR, 10);
+
+  EXPECT_EQ(2u, query.requestsCount_);
+  EXPECT_EQ(10u, marketHistory->marketData_.size());
+}
+
+TEST(TradingMarketHistories, ClearStartsNewCycle) {
+  CountingStockExchangeQuery query;
+  TradingMarketHistories marketHistories;
+
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::ONE_HOUR, 10);
+  marketHistories.clear();
+  marketHistories.get(query, common::Currency::BTC, common::Currency::ETH,
+                      common::TickInterval::ONE_HOUR, 10);
+
+  EXPECT_EQ(2u, query.requestsCount_);
+}
+
+TEST(TradingMarketHistories, LoadDownloadsEveryMarketOnce) {
+  CountingStockExchangeQuery query;
+  TradingMarketHistories marketHistories;
+  TradingWorkerPool workerPool(4);
+
+  std::vector<common::Currency::Enum> tradedCurrencies = {
+      common::Currency::ETH, common::Currency::LTC, common::Currency::XRP};
+  CandlesLookbacks candlesLookbacks = {{common::TickInterval::ONE_HOUR, 10},
+                                       {common::TickInterval::FIVE_MIN, 10}};
+
+  marketHistories.load(query, common::Currency::BTC, tradedCurrencies, candlesLookbacks,
+                       workerPool);
+  EXPECT_EQ(6u, query.requestsCount_);
+
+  // The same markets requested by the other processors of the cycle reuse the downloads.
+  marketHistories.load(query, common::Currency::BTC, tradedCurrencies, candlesLookbacks,
+                       workerPool);
+  for (auto tradedCurrency : tradedCurrencies) {
+    marketHistories.get(query, common::Currency::BTC, tradedCurrency,
+                        common::TickInterval::FIVE_MIN, 10);
+  }
+  EXPECT_EQ(6u, query.requestsCount_);
+}
+
+}  // namespace unit_test
+}  // namespace trader
+}  // namespace auto_trader
@@ -28,8 +28,10 @@
 
 #include <thread>
 
+#include "common/exceptions/model_exception/trading_model_exception.h"
 #include "common/exceptions/no_data_found_exception.h"
 #include "common/market_history.h"
+#include "include/trading_engine.h"
 #include "include/trading_manager.h"
 #include "model/include/settings/strategies_settings/custom_strategy_settings.h"
 #include "model/include/settings/strategies_settings/strategy_settings.h"
@@ -74,6 +76,9 @@ namespace unit_test {
  *  31. Reset order profit.
  *  32. Sell order be lower if balance is not enough to cover closed buy order.
  *  33. Lots holder should correlate orders.
+ *  34. Trading engine trades several configurations.
+ *  35. Trading engine rejects configurations sharing a market.
+ *  36. Trading engine stopped before its run.
  */
 
 constexpr int MAX_TICK_COUNT = 60;
@@ -142,9 +147,10 @@ TEST_F(TradingUIFixture, BuyOrderTrigger_1) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -228,9 +234,10 @@ TEST_F(TradingUIFixture, CheckClosedBuyOrders_2) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -313,9 +320,10 @@ TEST_F(TradingUIFixture, SellOrderTrigger_3) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -420,9 +428,10 @@ TEST_F(TradingUIFixture, CheckClosedSellOrders_4) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -530,9 +539,10 @@ TEST_F(TradingUIFixture, CustomerOpenBuyOrderManually_5) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -630,9 +640,10 @@ TEST_F(TradingUIFixture, CustomerCancelBuyOrder_6) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -731,9 +742,10 @@ TEST_F(TradingUIFixture, CustomerWithdrawFundsFromBaseCurrency_7) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -828,9 +840,10 @@ TEST_F(TradingUIFixture, CustomerWidthrawFundsFromTradedCurrency_8) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -918,9 +931,10 @@ TEST_F(TradingUIFixture, CustomerOpenSellOrderManually_9) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1018,9 +1032,10 @@ TEST_F(TradingUIFixture, CustomerCancelSellOrderManually_10) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1139,9 +1154,10 @@ TEST_F(TradingUIFixture, OrdersTheSameAfterRestart_11) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1267,9 +1283,10 @@ TEST_F(TradingUIFixture, CustomerClosedBuyOrderDuringRestart_12) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1381,9 +1398,10 @@ TEST_F(TradingUIFixture, CustomerCloseSellOrderDuringRestart_13) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1505,9 +1523,10 @@ TEST_F(TradingUIFixture, CloseOutdatedBuyOrders_14) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1595,9 +1614,10 @@ TEST_F(TradingUIFixture, CloseOutdatedSellOrders_15) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1697,9 +1717,10 @@ TEST_F(TradingUIFixture, MaxOpenOrdersCountForBuyingOrders_16) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1773,9 +1794,10 @@ TEST_F(TradingUIFixture, CheckOpenPositionsAmountPerCoinForBuyingOrders_17) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1848,9 +1870,10 @@ TEST_F(TradingUIFixture, CheckMinCoinAmountForBuyingOrder_18) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1920,9 +1943,10 @@ TEST_F(TradingUIFixture, CheckSeveralIndicatorSignal_19) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -1986,9 +2010,10 @@ TEST_F(TradingUIFixture, StopLossSignal_20) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2112,9 +2137,10 @@ TEST_F(TradingUIFixture, ChangeConfigurationSettings_21) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2206,9 +2232,10 @@ TEST_F(TradingUIFixture, RestartTradingWithClosedBuyOrders_22) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2354,9 +2381,10 @@ TEST_F(TradingUIFixture, CrossingInterval_23) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   getAppSettings().tradingTimeout_ = 0;
 
@@ -2436,9 +2464,10 @@ TEST_F(TradingUIFixture, OneMarketHistoryCannotBeAnalyzedSeveralTimes_24) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2554,9 +2583,10 @@ TEST_F(TradingUIFixture, AnyIndicatorShouldWork_25) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2640,9 +2670,10 @@ TEST_F(TradingUIFixture, InvalidAmountOfMoney_26) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2722,9 +2753,10 @@ TEST_F(TradingUIFixture, RestartTradingAndResetPreviousData_27) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2823,9 +2855,10 @@ TEST_F(TradingUIFixture, RestartTradingAndSavePreviousData_28) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -2926,9 +2959,10 @@ TEST_F(TradingUIFixture, StrategyMarket_Strategy_MarketData_Exists_29) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -3010,9 +3044,10 @@ TEST_F(TradingUIFixture, StrategyMarket_Strategy_MarketData_Save_And_Restore_30)
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -3101,9 +3136,10 @@ TEST_F(TradingUIFixture, Reset_Order_Profit_31) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -3206,9 +3242,10 @@ TEST_F(TradingUIFixture, Sell_Order_Lower_If_Balannce_Is_Not_Big_Enough_32) {
   TradingMessageSender sender(getFakeGuiProcessor(), getAppSettings());
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -3326,9 +3363,10 @@ TEST_F(TradingUIFixture, Lots_Holder_Should_Correlate_Buy_Orders_33) {
   lotsHolder.addLot("USD-LTC", currentLotSize);
 
   auto tradingManager = std::make_unique<TradingManager>(
-      getFakeQueryProcessor(), getStrategyFacade(), getDatabase(), getFakeAppController(),
+      getFakeQueryProcessor(), getStrategyPool(), getDatabase(), getFakeAppController(),
       getFakeGuiProcessor(), getAppSettings(), sender, getStrategySettingsHolder(),
-      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder());
+      getTradeOrdersHolder(), getTradeConfigsHolder(), getTradeSignaledStrategyMarketHolder(),
+      getWorkerPool());
 
   std::thread tradingThread(&TradingManager::startTradingSlot, std::ref(*tradingManager));
 
@@ -3391,6 +3429,104 @@ TEST_F(TradingUIFixture, Lots_Holder_Should_Correlate_Buy_Orders_33) {
   EXPECT_EQ(ordersMatched, true);
 }
 
+static void addEngineTradeConfig(model::TradeConfigsHolder &tradeConfigsHolder,
+                                 const std::string &name, common::Currency::Enum tradedCurrency) {
+  auto tradeConfig = std::make_unique<model::TradeConfiguration>();
+  tradeConfig->setName(name);
+  tradeConfig->setStrategyName("CUSTOM");
+
+  TradingUIFixture::createStockExchangeSettings(*tradeConfig, common::StockExchangeType::Bittrex,
+                                                "api", "secret");
+  TradingUIFixture::createBuySettings(*tradeConfig, 3, 3, 1, 50, 0.1, 4);
+  TradingUIFixture::createSellSettings(*tradeConfig, 3, 5);
+  TradingUIFixture::createCoinSettings(*tradeConfig, common::Currency::USD, {tradedCurrency});
+
+  tradeConfigsHolder.addTradeConfig(std::move(tradeConfig));
+}
+
+TEST_F(TradingUIFixture, TradingEngineSeveralConfigurations_34) {
+  auto smaSettings = TradingUIFixture::createSmaSettings(10, 0);
+  auto customSettings = std::make_unique<model::CustomStrategySettings>();
+  customSettings->name_ = "CUSTOM";
+  customSettings->strategies_.emplace_back(std::move(smaSettings));
+  getStrategySettingsHolder().addCustomStrategySettings(std::move(customSettings));
+
+  addEngineTradeConfig(getTradeConfigsHolder(), "LTC_CONFIG", common::Currency::LTC);
+  addEngineTradeConfig(getTradeConfigsHolder(), "ETH_CONFIG", common::Currency::ETH);
+
+  auto query = getFakeQueryProcessor().getQuery(common::StockExchangeType::Bittrex);
+  auto fakeQuery = std::dynamic_pointer_cast<FakeStockExchangeQuery>(query);
+
+  for (auto tradedCurrency : {common::Currency::LTC, common::Currency::ETH}) {
+    auto marketHistoryPtr = std::make_shared<common::MarketHistory>();
+    marketHistoryPtr->toBuy_ = tradedCurrency;
+    marketHistoryPtr->toSell_ = common::Currency::USD;
+    marketHistoryPtr->marketData_ = smaCandlesBuySignal;
+    fakeQuery->addMarketHistory(common::Currency::USD, tradedCurrency, marketHistoryPtr);
+
+    common::CurrencyTick currencyTick{1, 0.9, common::Currency::USD, tradedCurrency};
+    fakeQuery->setCurrencyTick(common::Currency::USD, tradedCurrency, currencyTick);
+  }
+
+  fakeQuery->setBalance(common::Currency::USD, 4);
+
+  getAppSettings().tradingTimeout_ = 0;
+
+  TradingEngine tradingEngine(getFakeQueryProcessor(), getDatabase(), getFakeAppController(),
+                              getFakeGuiProcessor(), getAppSettings(),
+                              getStrategySettingsHolder(), getTradeConfigsHolder(),
+                              getWorkerPool(), getStrategyPool());
+
+  std::thread engineThread(&TradingEngine::run, std::ref(tradingEngine),
+                           std::vector<std::string>{"LTC_CONFIG", "ETH_CONFIG"});
+
+  waitCallbackEvent([&]() -> bool {
+    return !fakeQuery->getAccountOpenOrders(common::Currency::USD, common::Currency::LTC)
+                .empty() &&
+           !fakeQuery->getAccountOpenOrders(common::Currency::USD, common::Currency::ETH).empty();
+  });
+
+  EXPECT_TRUE(tradingEngine.isRunning());
+  EXPECT_TRUE(getTradeConfigsHolder().getTradeConfiguration("LTC_CONFIG").isRunning());
+  EXPECT_TRUE(getTradeConfigsHolder().getTradeConfiguration("ETH_CONFIG").isRunning());
+
+  tradingEngine.stop();
+  engineThread.join();
+
+  EXPECT_FALSE(tradingEngine.isRunning());
+  EXPECT_FALSE(getTradeConfigsHolder().getTradeConfiguration("LTC_CONFIG").isRunning());
+  EXPECT_FALSE(getTradeConfigsHolder().getTradeConfiguration("ETH_CONFIG").isRunning());
+}
+
+TEST_F(TradingUIFixture, TradingEngineSharedMarket_35) {
+  addEngineTradeConfig(getTradeConfigsHolder(), "FIRST_CONFIG", common::Currency::LTC);
+  addEngineTradeConfig(getTradeConfigsHolder(), "SECOND_CONFIG", common::Currency::LTC);
+
+  TradingEngine tradingEngine(getFakeQueryProcessor(), getDatabase(), getFakeAppController(),
+                              getFakeGuiProcessor(), getAppSettings(),
+                              getStrategySettingsHolder(), getTradeConfigsHolder(),
+                              getWorkerPool(), getStrategyPool());
+
+  EXPECT_THROW(tradingEngine.run({"FIRST_CONFIG", "SECOND_CONFIG"}),
+               common::exceptions::TradingModelException);
+  EXPECT_FALSE(tradingEngine.isRunning());
+}
+
+TEST_F(TradingUIFixture, TradingEngineStopBeforeRun_36) {
+  addEngineTradeConfig(getTradeConfigsHolder(), "LTC_CONFIG", common::Currency::LTC);
+
+  TradingEngine tradingEngine(getFakeQueryProcessor(), getDatabase(), getFakeAppController(),
+                              getFakeGuiProcessor(), getAppSettings(),
+                              getStrategySettingsHolder(), getTradeConfigsHolder(),
+                              getWorkerPool(), getStrategyPool());
+
+  tradingEngine.stop();
+  tradingEngine.run({"LTC_CONFIG"});
+
+  EXPECT_FALSE(tradingEngine.isRunning());
+  EXPECT_FALSE(getTradeConfigsHolder().getTradeConfiguration("LTC_CONFIG").isRunning());
+}
+
 }  // namespace unit_test
 }  // namespace trader
 }  // namespace auto_trader
\ No newline at end of file
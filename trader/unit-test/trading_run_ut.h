@@ -37,6 +37,7 @@
 #include "fake/fake_gui_processor.h"
 #include "fake/fake_query_processor.h"
 #include "fake/fake_stock_exchange_query.h"
+#include "include/trading_worker_pool.h"
 #include "model/include/holders/strategies_settings_holder.h"
 #include "model/include/holders/trade_configs_holder.h"
 #include "model/include/holders/trade_orders_holder.h"
@@ -47,7 +48,7 @@
 #include "model/include/settings/strategies_settings/sma_settings.h"
 #include "stocks_exchange/include/query_factory.h"
 #include "stocks_exchange/include/query_processor.h"
-#include "strategies/include/strategy_facade.h"
+#include "strategies/include/strategy_pool.h"
 
 namespace auto_trader {
 namespace trader {
@@ -116,7 +117,7 @@ class TradingUIFixture : public ::testing::Test {
     factory_ = std::make_unique<stock_exchange::QueryFactory>();
     database_ = std::make_unique<database::Database>();
     queryProcessor_ = std::make_unique<FakeQueryProcessor>(*factory_);
-    strategiesFacade_ = std::make_unique<strategies::StrategyFacade>();
+    strategyPool_ = std::make_unique<strategies::StrategyPool>();
     appController_ = std::make_unique<FakeAppController>();
     guiProcessor_ = std::make_unique<FakeGuiProcessor>();
     strategySettingsHolder_ = std::make_unique<model::StrategiesSettingsHolder>();
@@ -126,16 +127,18 @@ class TradingUIFixture : public ::testing::Test {
         std::make_unique<model::TradeSignaledStrategyMarketHolder>();
 
     appSettings_ = std::make_unique<model::AppSettings>();
+    workerPool_ = std::make_unique<TradingWorkerPool>();
   }
 
   void TearDown() override {
     database_.reset();
     queryProcessor_.reset();
-    strategiesFacade_.reset();
+    strategyPool_.reset();
     strategySettingsHolder_.reset();
     tradeConfigurationsHolder_.reset();
     tradeSignaledStrategyMarketHolder_.reset();
     appSettings_.reset();
+    workerPool_.reset();
   }
 
   database::Database& getDatabase() const {
@@ -158,9 +161,9 @@ class TradingUIFixture : public ::testing::Test {
     return *queryProcessor_;
   }
 
-  strategies::StrategyFacade& getStrategyFacade() const {
-    EXPECT_TRUE(strategiesFacade_);
-    return *strategiesFacade_;
+  strategies::StrategyPool& getStrategyPool() const {
+    EXPECT_TRUE(strategyPool_);
+    return *strategyPool_;
   }
 
   model::StrategiesSettingsHolder& getStrategySettingsHolder() const {
@@ -188,6 +191,11 @@ class TradingUIFixture : public ::testing::Test {
     return *appSettings_;
   }
 
+  TradingWorkerPool& getWorkerPool() {
+    EXPECT_TRUE(workerPool_);
+    return *workerPool_;
+  }
+
   static model::BuySettings& createBuySettings(model::TradeConfiguration& tradeConfiguration,
                                                unsigned int maxOpenOrders,
                                                unsigned int maxOpenOrderTime, double maxCoinAmount,
@@ -271,12 +279,13 @@ class TradingUIFixture : public ::testing::Test {
   std::unique_ptr<FakeQueryProcessor> queryProcessor_;
   std::unique_ptr<FakeGuiProcessor> guiProcessor_;
   std::unique_ptr<FakeAppController> appController_;
-  std::unique_ptr<strategies::StrategyFacade> strategiesFacade_;
+  std::unique_ptr<strategies::StrategyPool> strategyPool_;
   std::unique_ptr<model::StrategiesSettingsHolder> strategySettingsHolder_;
   std::unique_ptr<model::TradeConfigsHolder> tradeConfigurationsHolder_;
   std::unique_ptr<model::TradeOrdersHolder> tradeOrdersHolder_;
   std::unique_ptr<model::TradeSignaledStrategyMarketHolder> tradeSignaledStrategyMarketHolder_;
   std::unique_ptr<model::AppSettings> appSettings_;
+  std::unique_ptr<TradingWorkerPool> workerPool_;
 };
 
 }  // namespace unit_test
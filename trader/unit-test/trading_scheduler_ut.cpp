@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/tick_interval_ratio.h"
+#include "gtest/gtest.h"
+#include "include/trading_scheduler.h"
+
+namespace auto_trader {
+namespace trader {
+namespace unit_test {
+
+namespace {
+
+TradingScheduler::Clock::time_point toTimePoint(int64_t seconds) {
+  return TradingScheduler::Clock::time_point(std::chrono::seconds(seconds));
+}
+
+// 2021-03-10 10:17:05 UTC, a Wednesday.
+const int64_t NOW = 1615371425;
+
+}  // namespace
+
+TEST(TradingScheduler, CandleCloseIsAlignedToInterval) {
+  auto now = toTimePoint(NOW);
+
+  EXPECT_EQ(toTimePoint(1615372200),
+            TradingScheduler::getCandleClose(common::TickInterval::FIFTEEN_MIN, now));
+  EXPECT_EQ(toTimePoint(1615374000),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_HOUR, now));
+  EXPECT_EQ(toTimePoint(1615420800),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_DAY, now));
+  EXPECT_EQ(toTimePoint(1615766400),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_WEEK, now));
+  EXPECT_EQ(toTimePoint(1617235200),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_MONTH, now));
+  EXPECT_EQ(toTimePoint(1640995200),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_YEAR, now));
+  EXPECT_EQ(toTimePoint(1640995200), TradingScheduler::getCandleClose(
+                                         common::TickInterval::ONE_MONTH, toTimePoint(1639958400)));
+}
+
+TEST(TradingScheduler, CandleCloseFollowsExchangeTimeZone) {
+  auto now = toTimePoint(NOW);
+  auto huobiOffset = common::getStockExchangeCandlesUtcOffset(common::StockExchangeType::Huobi);
+
+  // Huobi daily klines open at 16:00 UTC, e.g. its 1day candle with id 1576771200.
+  EXPECT_EQ(std::chrono::hours(8), huobiOffset);
+  EXPECT_EQ(toTimePoint(1615374000),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_HOUR, now, huobiOffset));
+  EXPECT_EQ(toTimePoint(1615392000),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_DAY, now, huobiOffset));
+  EXPECT_EQ(toTimePoint(1615737600),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_WEEK, now, huobiOffset));
+  EXPECT_EQ(toTimePoint(1617206400),
+            TradingScheduler::getCandleClose(common::TickInterval::ONE_MONTH, now, huobiOffset));
+
+  for (auto type : {common::StockExchangeType::Binance, common::StockExchangeType::Bittrex,
+                    common::StockExchangeType::Kraken, common::StockExchangeType::Poloniex}) {
+    EXPECT_EQ(std::chrono::seconds(0), common::getStockExchangeCandlesUtcOffset(type));
+  }
+}
+
+TEST(TradingScheduler, StrategyRunsOnceExchangeDayIsSettled) {
+  TradingScheduler scheduler(std::chrono::hours(1), std::chrono::seconds(3),
+                             std::chrono::hours(8));
+  scheduler.setIntervals({common::TickInterval::ONE_DAY}, toTimePoint(NOW));
+  scheduler.takeStep(toTimePoint(NOW));
+
+  EXPECT_FALSE(scheduler.takeStep(toTimePoint(1615391999)));
+  EXPECT_EQ(toTimePoint(1615392003), scheduler.getNextWakeUp());
+  EXPECT_TRUE(scheduler.takeStep(toTimePoint(1615392003)));
+}
+
+TEST(TradingScheduler, StrategyRunsOnceCandleIsSettled) {
+  TradingScheduler scheduler(std::chrono::seconds(60), std::chrono::seconds(3));
+  scheduler.setIntervals({common::TickInterval::FIVE_MIN}, toTimePoint(NOW));
+
+  EXPECT_TRUE(scheduler.takeStep(toTimePoint(NOW)));
+  EXPECT_EQ(toTimePoint(NOW + 60), scheduler.getNextWakeUp());
+
+  EXPECT_FALSE(scheduler.takeStep(toTimePoint(NOW + 60)));
+  EXPECT_EQ(toTimePoint(NOW + 120), scheduler.getNextWakeUp());
+
+  EXPECT_FALSE(scheduler.takeStep(toTimePoint(NOW + 120)));
+  EXPECT_EQ(toTimePoint(1615371603), scheduler.getNextWakeUp());
+
+  EXPECT_FALSE(scheduler.takeStep(toTimePoint(1615371602)));
+  EXPECT_TRUE(scheduler.takeStep(toTimePoint(1615371603)));
+  EXPECT_EQ(toTimePoint(1615371663), scheduler.getNextWakeUp());
+}
+
+TEST(TradingScheduler, WakesUpAtEarliestCandleClose) {
+  TradingScheduler scheduler(std::chrono::minutes(30), std::chrono::seconds(3));
+  scheduler.setIntervals({common::TickInterval::ONE_HOUR, common::TickInterval::FIVE_MIN},
+                         toTimePoint(NOW));
+  scheduler.takeStep(toTimePoint(NOW));
+
+  EXPECT_EQ(toTimePoint(1615371603), scheduler.getNextWakeUp());
+  EXPECT_TRUE(scheduler.takeStep(scheduler.getNextWakeUp()));
+  EXPECT_EQ(toTimePoint(1615371903), scheduler.getNextWakeUp());
+}
+
+TEST(TradingScheduler, ChangedIntervalsKeepScheduledCloses) {
+  TradingScheduler scheduler(std::chrono::hours(1), std::chrono::seconds(0));
+  scheduler.setIntervals({common::TickInterval::ONE_HOUR}, toTimePoint(NOW));
+  scheduler.takeStep(toTimePoint(NOW));
+
+  scheduler.setIntervals({common::TickInterval::ONE_HOUR, common::TickInterval::FIFTEEN_MIN},
+                         toTimePoint(NOW + 60));
+  EXPECT_EQ(toTimePoint(1615372200), scheduler.getNextWakeUp());
+
+  scheduler.setIntervals({common::TickInterval::ONE_HOUR}, toTimePoint(NOW + 120));
+  EXPECT_EQ(toTimePoint(1615374000), scheduler.getNextWakeUp());
+}
+
+TEST(TradingScheduler, ZeroPollingPeriodRunsEveryStep) {
+  TradingScheduler scheduler(std::chrono::seconds(0));
+  scheduler.setIntervals({common::TickInterval::ONE_DAY}, toTimePoint(NOW));
+
+  EXPECT_TRUE(scheduler.takeStep(toTimePoint(NOW)));
+  EXPECT_TRUE(scheduler.takeStep(toTimePoint(NOW + 1)));
+  EXPECT_EQ(toTimePoint(NOW + 1), scheduler.getNextWakeUp());
+}
+
+}  // namespace unit_test
+}  // namespace trader
+}  // namespace auto_trader
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2020, Rapprise.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <set>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "include/trading_worker_pool.h"
+
+namespace auto_trader {
+namespace trader {
+namespace unit_test {
+
+TEST(TradingWorkerPool, RunsEveryTaskOnce) {
+  TradingWorkerPool workerPool(4);
+  std::vector<std::atomic<int>> calls(100);
+  for (auto& callsCount : calls) {
+    callsCount = 0;
+  }
+
+  for (int batch = 0; batch < 20; ++batch) {
+    workerPool.run(calls.size(), 4, [&](size_t index) { ++calls[index]; });
+  }
+
+  for (auto& callsCount : calls) {
+    EXPECT_EQ(20, callsCount);
+  }
+}
+
+TEST(TradingWorkerPool, ParallelismIsBounded) {
+  TradingWorkerPool workerPool(4);
+  std::atomic<int> runningCount{0};
+  std::atomic<int> maxRunningCount{0};
+
+  workerPool.run(16, 2, [&](size_t) {
+    int running = ++runningCount;
+    int maxRunning = maxRunningCount;
+    while (running > maxRunning && !maxRunningCount.compare_exchange_weak(maxRunning, running)) {
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    --runningCount;
+  });
+
+  EXPECT_LE(maxRunningCount, 2);
+}
+
+TEST(TradingWorkerPool, IdleWorkersStealTasks) {
+  TradingWorkerPool workerPool(2);
+  std::mutex mutex;
+  std::set<std::thread::id> threads;
+  std::atomic<bool> isFirstTaskTaken{false};
+  std::atomic<int> otherTasksCount{0};
+
+  // The first task holds its worker until the other one has taken the rest of both queues.
+  workerPool.run(8, 2, [&](size_t) {
+    if (!isFirstTaskTaken.exchange(true)) {
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (otherTasksCount < 7 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    } else {
+      ++otherTasksCount;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  });
+
+  EXPECT_EQ(7, otherTasksCount);
+  EXPECT_EQ(2u, threads.size());
+}
+
+TEST(TradingWorkerPool, SingleWorkerRunsInline) {
+  TradingWorkerPool workerPool(1);
+  std::vector<size_t> order;
+  auto callerThread = std::this_thread::get_id();
+
+  workerPool.run(5, 8, [&](size_t index) {
+    EXPECT_EQ(callerThread, std::this_thread::get_id());
+    order.push_back(index);
+  });
+
+  EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3, 4}), order);
+}
+
+}  // namespace unit_test
+}  // namespace trader
+}  // namespace auto_trader